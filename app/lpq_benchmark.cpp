@@ -0,0 +1,128 @@
+// Std Imports
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+
+// TPIE Imports
+#include <tpie/tpie.h>
+
+// ADIAR Imports
+#include <adiar/adiar.h>
+
+#include <adiar/internal/data_structures/priority_queue.h>
+#include <adiar/internal/data_structures/radix_priority_queue.h>
+#include <adiar/internal/data_types/ptr.h>
+#include <adiar/internal/data_types/request.h>
+#include <adiar/internal/memory.h>
+
+using namespace adiar::internal;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// The requests of the Product Construction's priority queue for the first target, i.e. the queue
+// where a radix heap replaces the binary heap as the overflow queue in the 'Internal' memory mode.
+using request_t      = request_data<2, with_parent, 0>;
+using request_comp_t = request_data_first_lt<request_t>;
+
+using binary_heap_t = priority_queue<memory_mode::Internal, request_t, request_comp_t>;
+using radix_heap_t  = radix_priority_queue<request_t, request_comp_t, request_first_key<request_t>>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+// Similar to a top-down sweep, each popped request is followed by up to two requests on deeper
+// levels. The queue is first filled with `size` many requests. The checksum over the popped
+// requests ensures both queues output the same order.
+template <typename PriorityQueue>
+void
+run(const std::string& name, const size_t size, const size_t pops, const size_t window)
+{
+  const size_t max_size = 2u * size + 2u;
+  PriorityQueue pq(memory_available(), max_size);
+
+  std::mt19937_64 rng(42);
+  const auto random_ptr = [&rng](const uint64_t min_level, const uint64_t window) {
+    const ptr_uint64::label_type level =
+      std::min<uint64_t>(min_level + rng() % window, ptr_uint64::max_label);
+    return ptr_uint64(level, rng() % (ptr_uint64::max_id + 1u));
+  };
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < size; ++i) {
+    const ptr_uint64 t0 = random_ptr(0u, window);
+    const ptr_uint64 t1 = random_ptr(0u, window);
+    pq.push({ { t0, t1 }, {}, { ptr_uint64::nil() } });
+  }
+
+  uint64_t checksum = 0u;
+  size_t popped     = 0u;
+
+  while (!pq.empty() && popped < pops) {
+    const request_t r = pq.top();
+    pq.pop();
+    popped += 1u;
+
+    checksum = checksum * 31u + r.target.first().id() + r.target.second().id();
+
+    const uint64_t next_level = r.level() + 1u;
+    if (ptr_uint64::max_label <= next_level) { continue; }
+
+    const size_t children = pq.size() < size ? 2u : 1u;
+    for (size_t c = 0; c < children && pq.size() < max_size; ++c) {
+      const ptr_uint64 t0 = random_ptr(next_level, window);
+      const ptr_uint64 t1 = random_ptr(next_level, window);
+      pq.push({ { t0, t1 }, {}, { r.target[0] } });
+    }
+  }
+
+  const auto end = std::chrono::steady_clock::now();
+  const auto ms  = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+  std::cout << "  " << name << "\n"
+            << "  | popped:   " << popped << "\n"
+            << "  | time:     " << ms << " ms\n"
+            << "  | checksum: " << checksum << "\n"
+            << "\n";
+}
+
+int
+main(int argc, char* argv[])
+{
+  std::cout << "-------------------------------------------------------------------------------\n"
+            << "  Adiar " << adiar::version_string << " : Overflow Queue Benchmark \n"
+            << "-------------------------------------------------------------------------------\n"
+            << "\n";
+
+  size_t M      = 1024;
+  size_t size   = 1000000;
+  size_t pops   = 20000000;
+  size_t window = 64;
+
+  try {
+    if (argc > 1) { M = std::stoi(argv[1]); }
+    if (argc > 2) { size = std::stoull(argv[2]); }
+    if (argc > 3) { pops = std::stoull(argv[3]); }
+    if (argc > 4) { window = std::max<size_t>(1u, std::stoull(argv[4])); }
+  } catch (const std::invalid_argument& ex) {
+    std::cerr << "Invalid number\n";
+    return -1;
+  } catch (const std::out_of_range& ex) {
+    std::cerr << "Number out of range\n";
+    return -1;
+  }
+
+  adiar::adiar_init(M * 1024 * 1024);
+
+  {
+    std::cout << "  requests: " << size << " (initially)\n"
+              << "  pops:     " << pops << "\n"
+              << "  window:   " << window << " levels\n"
+              << "\n";
+
+    run<binary_heap_t>("Binary Heap", size, pops, window);
+    run<radix_heap_t>("Radix Heap", size, pops, window);
+  }
+
+  adiar::adiar_deinit();
+  return 0;
+}
@@ -1,3 +1,4 @@
+#include <cstdio>
 #include <iostream>
 #include <string>
 
@@ -160,6 +161,22 @@ void exists(const adiar::bdd &f)
   print(_, "Operation [bdd_exists]");
 }
 
+void replace(const adiar::bdd &f)
+{
+  /// [replace]
+  adiar::bdd _ = adiar::bdd_replace(f, [](int x) { return 2 - x; }); // x2 & x1
+  /// [replace]
+  print(_, "Operation [bdd_replace]");
+}
+
+void reorder(const adiar::bdd &f)
+{
+  /// [reorder]
+  auto [_, m] = adiar::bdd_reorder(f); // m[i] is the new level of x_i
+  /// [reorder]
+  print(_, "Operation [bdd_reorder]");
+}
+
 void satcount(const adiar::bdd &f)
 {
   /// [satcount]
@@ -314,6 +331,20 @@ void dot(const adiar::bdd &f)
   /// [dot]
 }
 
+void save_load(const adiar::bdd &f)
+{
+  /// [save]
+  adiar::bdd_save(f, "./f.adiar");
+  /// [save]
+  {
+    /// [load]
+    adiar::bdd _ = adiar::bdd_load("./f.adiar");
+    /// [load]
+    print(_, "Files [bdd_load]");
+  }
+  std::remove("./f.adiar");
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main() {
   adiar::adiar_init(adiar::minimum_memory);
@@ -333,6 +364,8 @@ int main() {
     const adiar::bdd g     = ite(x0, x1, x2);
     restrict(f);
     exists(f);
+    replace(f);
+    reorder(g);
     satcount(f);
     const adiar::bdd f_min = satmin(f);
     const adiar::bdd f_max = satmax(f);
@@ -352,6 +385,7 @@ int main() {
     topvar(f);
     maxvar(f);
     dot(f);
+    save_load(f);
   }
 
   adiar::adiar_deinit();
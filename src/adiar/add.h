@@ -0,0 +1,375 @@
+#ifndef ADIAR_ADD_H
+#define ADIAR_ADD_H
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \defgroup module__add Algebraic Decision Diagrams
+///
+/// \brief An Algebraic Decision Diagram (ADD), also known as a Multi-Terminal Binary Decision
+///        Diagram (MTBDD), represents a function \f$ f: \{0,1\}^n \rightarrow V \f$ where \f$ V \f$
+///        is a set of numeric values.
+///
+/// The values of an \ref add are unsigned 32-bit integers and all arithmetic on them wraps around
+/// as for `uint32_t`. The value `0` and `1` coincide with the `false` and `true` terminal of a
+/// \ref bdd, respectively.
+///
+/// The \ref add class takes care of reference counting and optimal garbage collection of the
+/// underlying files. To ensure the most disk-space is available, try to garbage collect the \ref
+/// add objects as quickly as possible and/or minimise the number of lvalues of said type.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <adiar/add/add.h>
+#include <adiar/bdd/bdd.h>
+#include <adiar/exec_policy.h>
+#include <adiar/functional.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__add Basic Constructors
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The ADD of only a single terminal with the given value.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add
+  add_const(add::value_type value);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The function that is `1` if the variable is true and `0` otherwise.
+  ///
+  /// \param var The label of the desired variable.
+  ///
+  /// \throws invalid_argument If `var` is a too large value.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add
+  add_ithvar(add::label_type var);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__add Basic Operations
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a function to every terminal value.
+  ///
+  /// \param f  ADD to map
+  ///
+  /// \param op Function to apply to each value of `f`
+  ///
+  /// \returns The ADD of \f$ \mathit{op} \circ f \f$
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_map(const add& f, const function<add::value_type(add::value_type)>& op);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a function to every terminal value.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_map(const exec_policy& ep,
+          const add& f,
+          const function<add::value_type(add::value_type)>& op);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator on the values of two ADDs.
+  ///
+  /// \param f  ADD for the left-hand-side of the operator
+  ///
+  /// \param g  ADD for the right-hand-side of the operator
+  ///
+  /// \param op Binary operator to be applied
+  ///
+  /// \returns The product construction of `f` and `g` where each pair of values are combined with
+  ///          `op`, i.e. \f$ \lambda x . \mathit{op}(f(x), g(x)) \f$.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_apply(const add& f,
+            const add& g,
+            const function<add::value_type(add::value_type, add::value_type)>& op);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator on the values of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_apply(const exec_policy& ep,
+            const add& f,
+            const add& g,
+            const function<add::value_type(add::value_type, add::value_type)>& op);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) sum of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_plus(const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) sum of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_plus(const exec_policy& ep, const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) product of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_times(const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) product of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_times(const exec_policy& ep, const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) minimum of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_min(const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) minimum of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_min(const exec_policy& ep, const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) maximum of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_max(const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The (point-wise) maximum of two ADDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_max(const exec_policy& ep, const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sum abstraction of a single variable.
+  ///
+  /// \param f   ADD to abstract
+  ///
+  /// \param var Variable to abstract away
+  ///
+  /// \returns \f$ f[x_{\mathit{var}} / 0] + f[x_{\mathit{var}} / 1] \f$
+  ///
+  /// \remark If `f` does not depend on `var`, then the result is \f$ 2 \cdot f \f$.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_exists(const add& f, add::label_type var);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sum abstraction of a single variable.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_exists(const exec_policy& ep, const add& f, add::label_type var);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sum abstraction of multiple variables.
+  ///
+  /// \param f    ADD to abstract
+  ///
+  /// \param vars Generator of the variables to abstract away in \em descending order. Unlike for the
+  ///             other abstractions, a predicate does not suffice since each variable also
+  ///             contributes when `f` does not depend on it.
+  ///
+  /// \throws invalid_argument If `vars` are not in descending order.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_exists(const add& f, const generator<add::label_type>& vars);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sum abstraction of multiple variables.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_exists(const exec_policy& ep, const add& f, const generator<add::label_type>& vars);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Max abstraction of a single variable.
+  ///
+  /// \param f   ADD to abstract
+  ///
+  /// \param var Variable to abstract away
+  ///
+  /// \returns \f$ \max(f[x_{\mathit{var}} / 0], f[x_{\mathit{var}} / 1]) \f$
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_maxabstract(const add& f, add::label_type var);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Max abstraction of a single variable.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_maxabstract(const exec_policy& ep, const add& f, add::label_type var);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Max abstraction of all variables that satisfy the given predicate.
+  ///
+  /// \remark This is computed with repeated single-variable sweeps, i.e. the quantification
+  ///         algorithm in the execution policy is ignored.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_maxabstract(const add& f, const predicate<add::label_type>& vars);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Max abstraction of all variables that satisfy the given predicate.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_maxabstract(const exec_policy& ep, const add& f, const predicate<add::label_type>& vars);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Max abstraction of all variables provided by a generator in \em descending order.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_maxabstract(const add& f, const generator<add::label_type>& vars);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Max abstraction of all variables provided by a generator in \em descending order.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_maxabstract(const exec_policy& ep, const add& f, const generator<add::label_type>& vars);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__add Predicates
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether this ADD is a single terminal.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  add_isconst(const add& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether they represent the same function.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  add_equal(const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether they represent the same function.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  add_equal(const exec_policy& ep, const add& f, const add& g);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \see add_equal
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  operator==(const add& lhs, const add& rhs);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether they represent two different functions.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  operator!=(const add& lhs, const add& rhs);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__add Counting Operations
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The number of (internal) nodes used to represent the function.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  size_t
+  add_nodecount(const add& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The number of variables that influence the outcome of the function, i.e. the number of
+  ///        levels present in the ADD.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add::label_type
+  add_varcount(const add& f);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__add Input Variables
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Get the root's variable label.
+  ///
+  /// \throws invalid_argument If `f` is a terminal.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add::label_type
+  add_topvar(const add& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The value of a constant ADD.
+  ///
+  /// \throws invalid_argument If `f` is not a terminal.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add::value_type
+  add_valueof(const add& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Evaluate an ADD according to an assignment to its variables.
+  ///
+  /// \param f  The ADD to evaluate
+  ///
+  /// \param af A function from variables to their assigned values
+  ///
+  /// \returns The value of `f` for the assignment `af`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add::value_type
+  add_eval(const add& f, const predicate<add::label_type>& af);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__add Conversion
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the ADD of a BDD, i.e. its `false` and `true` terminal become `0` and `1`.
+  ///
+  /// \details If the BDD is neither negated nor shifted, then this takes no time or space, since
+  ///          the underlying file is shared.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add
+  add_from(const bdd& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the BDD of all assignments for which an ADD is non-zero.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_from(const add& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the BDD of all assignments for which an ADD is non-zero.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_from(const exec_policy& ep, const add& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the BDD of all assignments for which the value of an ADD satisfies a predicate.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_from(const add& f, const predicate<add::value_type>& pred);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the BDD of all assignments for which the value of an ADD satisfies a predicate.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_from(const exec_policy& ep, const add& f, const predicate<add::value_type>& pred);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+#endif // ADIAR_ADD_H
@@ -0,0 +1,185 @@
+#include "add.h"
+
+#include <adiar/add.h>
+#include <adiar/add/add_policy.h>
+#include <adiar/exception.h>
+
+#include <adiar/internal/algorithms/pred.h>
+#include <adiar/internal/assert.h>
+#include <adiar/internal/algorithms/reduce.h>
+#include <adiar/internal/algorithms/traverse.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/dd_func.h>
+#include <adiar/internal/io/node_ifstream.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // '__add' Constructors
+  __add::__add()
+    : internal::__dd()
+  {}
+
+  __add::__add(const shared_node_file_type& f)
+    : internal::__dd(f)
+  {}
+
+  __add::__add(const shared_arc_file_type& f, const exec_policy& ep)
+    : internal::__dd(f, ep)
+  {}
+
+  __add::__add(const add& dd)
+    : internal::__dd(dd)
+  {}
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // 'add' Constructors
+  add::add()
+    : add(add_const(0u))
+  {}
+
+  add::add(value_type v)
+    : add(add_const(v))
+  {}
+
+  add::add(const shared_node_file_type& f, bool negate, signed_label_type shift)
+    : internal::dd(f, negate, shift)
+  {
+    adiar_assert(!negate, "An ADD cannot be negated");
+  }
+
+  add::add(const add& f)
+    : internal::dd(f)
+  {}
+
+  add::add(add&& f)
+    : internal::dd(f)
+  {}
+
+  add::add(__add&& f)
+    : internal::dd(internal::reduce<add_policy>(std::move(f)))
+  {}
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Operators (Assignment)
+  add&
+  add::operator=(const add& other)
+  {
+    this->_negate = other._negate;
+    this->_file   = other._file;
+    this->_shift  = other._shift;
+    return *this;
+  }
+
+  add&
+  add::operator=(__add&& other)
+  {
+    deref();
+    return (*this = internal::reduce<add_policy>(std::move(other)));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Predicates
+  bool
+  add_isconst(const add& f)
+  {
+    return internal::dd_isterminal(f);
+  }
+
+  add::value_type
+  add_valueof(const add& f)
+  {
+    if (!add_isconst(f)) { throw invalid_argument("Cannot obtain value of a non-constant ADD"); }
+
+    internal::node_ifstream<> in(f);
+    return in.pull().numeric_value();
+  }
+
+  bool
+  add_equal(const exec_policy& ep, const add& f, const add& g)
+  {
+    return internal::is_isomorphic(ep, f, g);
+  }
+
+  bool
+  add_equal(const add& f, const add& g)
+  {
+    return add_equal(exec_policy(), f, g);
+  }
+
+  bool
+  operator==(const add& lhs, const add& rhs)
+  {
+    return add_equal(lhs, rhs);
+  }
+
+  bool
+  operator!=(const add& lhs, const add& rhs)
+  {
+    return !add_equal(lhs, rhs);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Counting Operations
+  size_t
+  add_nodecount(const add& f)
+  {
+    return internal::dd_nodecount(f);
+  }
+
+  add::label_type
+  add_varcount(const add& f)
+  {
+    return internal::dd_varcount(f);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Evaluation
+  class add_eval_func_visitor
+  {
+    const predicate<add::label_type>& af;
+    add::pointer_type result = add::pointer_type::numeric_terminal(0u);
+
+  public:
+    add_eval_func_visitor(const predicate<add::label_type>& f)
+      : af(f)
+    {}
+
+    inline add::pointer_type
+    visit(const add::node_type& n)
+    {
+      // The terminal given to 'visit(bool)' below only carries whether it is non-zero. Hence, the
+      // last target is remembered here instead.
+      result = af(n.label()) ? n.high() : n.low();
+      return result;
+    }
+
+    inline void
+    visit(const bool /*s*/)
+    {}
+
+    inline add::value_type
+    get_result()
+    {
+      return result.numeric_value();
+    }
+  };
+
+  add::value_type
+  add_eval(const add& f, const predicate<add::label_type>& af)
+  {
+    if (add_isconst(f)) { return add_valueof(f); }
+
+    add_eval_func_visitor v(af);
+    internal::traverse(f, v);
+    return v.get_result();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Input variables
+  add::label_type
+  add_topvar(const add& f)
+  {
+    return internal::dd_topvar(f);
+  }
+}
@@ -0,0 +1,135 @@
+#ifndef ADIAR_ADD_ADD_H
+#define ADIAR_ADD_ADD_H
+
+#include <adiar/internal/dd.h>
+
+namespace adiar
+{
+  class add;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \ingroup module__add
+  ///
+  /// \brief A (possibly) unreduced Algebraic Decision Diagram.
+  ///
+  /// \relates add
+  ///
+  /// \copydetails adiar::internal::__dd
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class __add : public internal::__dd
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Default constructor with an empty result.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    __add();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Wrapper for an algorithm's already reduced output.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    __add(const shared_node_file_type& f);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Wrapper for an algorithm's unreduced output.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    __add(const shared_arc_file_type& f, const exec_policy& ep);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion constructor from an `add` to pass along a prior value.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    __add(const add& add);
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \ingroup module__add
+  ///
+  /// \brief A reduced Algebraic Decision Diagram.
+  ///
+  /// \details Unlike a `bdd`, the terminals of an `add` are numeric values, i.e. of `value_type`.
+  ///          The terminals `false` and `true` of a `bdd` coincide with the numeric terminals `0`
+  ///          and `1`.
+  ///
+  /// \copydetails adiar::internal::dd
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class add : public internal::dd
+  {
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Friends
+    // |- classes
+    friend __add;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the numeric terminal values.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using value_type = pointer_type::numeric_type;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether terminals are numeric values rather than only `false` and `true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool numeric_terminals = true;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Constructors
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Default construction, creating the `0` terminal.
+    ///
+    /// \see add_const
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Implicit conversion from a numeric value to construct its terminal.
+    ///
+    /// \see add_const
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add(value_type v);
+
+    /// \cond
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor to wrap the node-based result of an algorithm.
+    ///
+    /// \pre `negate == false`, since the terminals of an ADD are not Boolean values.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add(const shared_node_file_type& f, bool negate = false, signed_label_type shift = 0);
+    /// \endcond
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Copy construction, incrementing the reference count on the file underneath.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add(const add& f);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move construction, taking over ownership of the files underneath.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add(add&& f);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Implicit move conversion from a possibly to-be reduced result from an algorithm to
+    ///          an `add`.
+    ///
+    /// \details Since the `adiar::internal::reduce` algorithm is run as part of this constructor,
+    ///          the scoping rules ensure we garbage collect irrelevant files as early as possible.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add(__add&& f);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // Assignment operator overloadings
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Assigns new `add`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add&
+    operator=(const add& other);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Assigns new `add` to a variable; the content is derefenced before the given `__add`
+    ///        is reduced into an `add`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    add&
+    operator=(__add&& other);
+  };
+}
+
+#endif // ADIAR_ADD_ADD_H
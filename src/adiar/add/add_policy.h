@@ -0,0 +1,33 @@
+#ifndef ADIAR_ADD_ADD_POLICY_H
+#define ADIAR_ADD_ADD_POLICY_H
+
+#include <adiar/add/add.h>
+
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/data_types/tuple.h>
+#include <adiar/internal/data_types/uid.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Logic related to being an 'Algebraic' Decision Diagram.
+  //////////////////////////////////////////////////////////////////////////////
+  using add_policy = internal::dd_policy<add, __add>;
+
+  template <>
+  inline add::pointer_type
+  add_policy::reduction_rule(const add::node_type& n)
+  {
+    if (essential(n.low()) == essential(n.high())) { return n.low(); }
+    return n.uid();
+  }
+
+  template <>
+  inline add_policy::children_type
+  add_policy::reduction_rule_inv(const add::pointer_type& child)
+  {
+    return { child, child };
+  }
+}
+
+#endif // ADIAR_ADD_ADD_POLICY_H
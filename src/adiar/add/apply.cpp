@@ -0,0 +1,259 @@
+#include <algorithm>
+
+#include <adiar/add.h>
+#include <adiar/add/add_policy.h>
+
+#include <adiar/internal/algorithms/prod2b.h>
+#include <adiar/internal/algorithms/select.h>
+#include <adiar/internal/assert.h>
+#include <adiar/internal/cut.h>
+#include <adiar/internal/data_types/tuple.h>
+#include <adiar/internal/dd_func.h>
+#include <adiar/internal/unreachable.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // ADD terminal mapping policy
+  class add_map_select_policy : public add_policy
+  {
+  private:
+    const function<add::value_type(add::value_type)>& _op;
+
+  public:
+    add_map_select_policy(const function<add::value_type(add::value_type)>& op)
+      : _op(op)
+    {}
+
+  private:
+    inline add::pointer_type
+    __map(const add::pointer_type& p) const
+    {
+      if (!p.is_terminal()) { return p; }
+      return add::pointer_type::numeric_terminal(this->_op(p.numeric_value()));
+    }
+
+  public:
+    internal::select_rec
+    process(const add::node_type& n) const
+    {
+      return add::node_type(n.uid(), this->__map(n.low()), this->__map(n.high()));
+    }
+
+    void
+    setup_level(const add::label_type /*level*/) const
+    {}
+
+    // LCOV_EXCL_START
+    add
+    terminal(const bool /*terminal_val*/) const
+    {
+      // Nodes are never skipped, so we never reach a terminal from the root.
+      adiar_unreachable();
+    }
+
+    // LCOV_EXCL_STOP
+
+    static constexpr bool skip_reduce = true;
+  };
+
+  __add
+  add_map(const exec_policy& ep,
+          const add& f,
+          const function<add::value_type(add::value_type)>& op)
+  {
+    if (add_isconst(f)) { return add_const(op(add_valueof(f))); }
+
+    add_map_select_policy policy(op);
+    return internal::select(ep, f, policy);
+  }
+
+  __add
+  add_map(const add& f, const function<add::value_type(add::value_type)>& op)
+  {
+    return add_map(exec_policy(), f, op);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // ADD product construction policy
+  class add_apply_prod2b_policy
+    : public add_policy
+    , public internal::prod2b_mixed_level_merger<add_policy>
+  {
+  private:
+    /// \brief Operator
+    const function<add::value_type(add::value_type, add::value_type)>& _op;
+
+    /// \brief Whether the arguments to the operator are to be swapped.
+    bool _flipped = false;
+
+    /// \brief Execution policy for the trivial cases.
+    const exec_policy& _ep;
+
+  public:
+    add_apply_prod2b_policy(const exec_policy& ep,
+                            const function<add::value_type(add::value_type, add::value_type)>& op)
+      : _op(op)
+      , _ep(ep)
+    {}
+
+  public:
+    void
+    setup_next_level(const add::label_type /*next_level*/) const
+    {}
+
+  public:
+    /// \brief Flip internal copy of operator
+    void
+    flip()
+    {
+      this->_flipped = !this->_flipped;
+    }
+
+  private:
+    /// \brief Apply the operator with respect to the (possibly flipped) argument order.
+    inline add::value_type
+    __apply(const add::value_type a, const add::value_type b) const
+    {
+      return this->_flipped ? this->_op(b, a) : this->_op(a, b);
+    }
+
+  public:
+    /// \brief Hook for case of two ADDs with the same node file.
+    __add
+    resolve_same_file(const add& add_1, const add& /*add_2*/) const
+    {
+      return add_map(this->_ep, add_1, [this](const add::value_type v) {
+        return this->__apply(v, v);
+      });
+    }
+
+    /// \brief Hook for either of the two ADDs being a terminal.
+    __add
+    resolve_terminal_root(const add& add_1, const add& add_2) const
+    {
+      adiar_assert(add_isconst(add_1) || add_isconst(add_2));
+
+      if (add_isconst(add_1) && add_isconst(add_2)) {
+        return add_const(this->__apply(add_valueof(add_1), add_valueof(add_2)));
+      }
+
+      // Unlike for BDDs, there is no shortcutting or idempotence known for an arbitrary operator.
+      // Hence, we resort to the product construction.
+      return __add();
+    }
+
+  public:
+    /// \brief Hook for changing the targets of a new node's children.
+    internal::prod2b_rec
+    resolve_request(const internal::tuple<add::pointer_type>& r_low,
+                    const internal::tuple<add::pointer_type>& r_high) const
+    {
+      return internal::prod2b_rec_output{ r_low, r_high };
+    }
+
+    /// \brief Hook for applying an operator to a pair of terminals.
+    add::pointer_type
+    operator()(const add::pointer_type& a, const add::pointer_type& b) const
+    {
+      return add::pointer_type::numeric_terminal(
+        this->__apply(a.numeric_value(), b.numeric_value()));
+    }
+
+  public:
+    /// \brief Hook for deriving the cut type of the left-hand-side.
+    internal::cut
+    left_cut() const
+    {
+      return internal::cut::All;
+    }
+
+    /// \brief Hook for deriving the cut type of the right-hand-side.
+    internal::cut
+    right_cut() const
+    {
+      return internal::cut::All;
+    }
+
+    /// \brief Whether this policy may introduce skipping of nodes.
+    ///
+    /// \detail This variable can be used at compile-time to prune conditional statements.
+    static constexpr bool no_skip = true;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_apply(const exec_policy& ep,
+            const add& f,
+            const add& g,
+            const function<add::value_type(add::value_type, add::value_type)>& op)
+  {
+    add_apply_prod2b_policy policy(ep, op);
+    return internal::prod2b(ep, f, g, policy);
+  }
+
+  __add
+  add_apply(const add& f,
+            const add& g,
+            const function<add::value_type(add::value_type, add::value_type)>& op)
+  {
+    return add_apply(exec_policy(), f, g, op);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __add
+  add_plus(const exec_policy& ep, const add& f, const add& g)
+  {
+    return add_apply(ep, f, g, [](const add::value_type a, const add::value_type b) {
+      return a + b;
+    });
+  }
+
+  __add
+  add_plus(const add& f, const add& g)
+  {
+    return add_plus(exec_policy(), f, g);
+  }
+
+  __add
+  add_times(const exec_policy& ep, const add& f, const add& g)
+  {
+    return add_apply(ep, f, g, [](const add::value_type a, const add::value_type b) {
+      return a * b;
+    });
+  }
+
+  __add
+  add_times(const add& f, const add& g)
+  {
+    return add_times(exec_policy(), f, g);
+  }
+
+  __add
+  add_min(const exec_policy& ep, const add& f, const add& g)
+  {
+    return add_apply(ep, f, g, [](const add::value_type a, const add::value_type b) {
+      return std::min(a, b);
+    });
+  }
+
+  __add
+  add_min(const add& f, const add& g)
+  {
+    return add_min(exec_policy(), f, g);
+  }
+
+  __add
+  add_max(const exec_policy& ep, const add& f, const add& g)
+  {
+    return add_apply(ep, f, g, [](const add::value_type a, const add::value_type b) {
+      return std::max(a, b);
+    });
+  }
+
+  __add
+  add_max(const add& f, const add& g)
+  {
+    return add_max(exec_policy(), f, g);
+  }
+}
@@ -0,0 +1,22 @@
+#include <adiar/add.h>
+#include <adiar/add/add_policy.h>
+
+#include <adiar/internal/algorithms/build.h>
+#include <adiar/internal/data_types/ptr.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////
+  add
+  add_const(add::value_type value)
+  {
+    return internal::build_terminal<add_policy>(add::pointer_type::numeric_terminal(value));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  add
+  add_ithvar(add::label_type label)
+  {
+    return internal::build_ithvar<add_policy>(label);
+  }
+}
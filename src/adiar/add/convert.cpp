@@ -0,0 +1,55 @@
+#include <adiar/add.h>
+#include <adiar/add/add_policy.h>
+#include <adiar/bdd.h>
+
+#include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/io/node_ofstream.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  add
+  add_from(const bdd& f)
+  {
+    // The terminals `false` and `true` already coincide with `0` and `1`.
+    if (!f.is_negated() && f.shift() == 0) { return add(f.file_ptr()); }
+
+    // Otherwise, the negation and shift have to be applied while copying the nodes.
+    add::shared_node_file_type nf;
+    {
+      internal::node_ofstream out(nf);
+      internal::node_ifstream<true> in(f);
+      while (in.can_pull()) { out << in.pull(); }
+    }
+    return nf;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_from(const exec_policy& ep, const add& f, const predicate<add::value_type>& pred)
+  {
+    // An ADD with only the terminals `0` and `1` is (when reduced) also a reduced BDD.
+    const add g = add_map(ep, f, [&pred](const add::value_type v) -> add::value_type {
+      return pred(v) ? 1u : 0u;
+    });
+    return bdd(g.file_ptr());
+  }
+
+  bdd
+  bdd_from(const add& f, const predicate<add::value_type>& pred)
+  {
+    return bdd_from(exec_policy(), f, pred);
+  }
+
+  bdd
+  bdd_from(const exec_policy& ep, const add& f)
+  {
+    return bdd_from(ep, f, [](const add::value_type v) { return v != 0u; });
+  }
+
+  bdd
+  bdd_from(const add& f)
+  {
+    return bdd_from(exec_policy(), f);
+  }
+}
@@ -0,0 +1,343 @@
+#include <algorithm>
+#include <limits>
+
+#include <adiar/add.h>
+#include <adiar/add/add_policy.h>
+
+#include <adiar/internal/algorithms/intercut.h>
+#include <adiar/internal/algorithms/quantify.h>
+#include <adiar/internal/algorithms/select.h>
+#include <adiar/internal/assert.h>
+#include <adiar/internal/cut.h>
+#include <adiar/internal/data_structures/vector.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/unreachable.h>
+#include <adiar/internal/util.h>
+
+namespace adiar
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Sum abstraction
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Policy to restrict a single variable of an ADD to a constant value.
+  class add_cofactor_policy : public add_policy
+  {
+  private:
+    const add::label_type _var;
+    const bool _value;
+
+  public:
+    add_cofactor_policy(const add::label_type var, const bool value)
+      : _var(var)
+      , _value(value)
+    {}
+
+  public:
+    internal::select_rec
+    process(const add::node_type& n) const
+    {
+      if (n.label() == this->_var) { return n.child(this->_value); }
+      return n;
+    }
+
+    void
+    setup_level(const add::label_type /*level*/) const
+    {}
+
+    // LCOV_EXCL_START
+    add
+    terminal(const bool /*terminal_val*/) const
+    {
+      // Only the root can be restricted to a terminal, which is resolved before the sweep.
+      adiar_unreachable();
+    }
+
+    // LCOV_EXCL_STOP
+
+    static constexpr bool skip_reduce = true;
+  };
+
+  __add
+  __add_cofactor(const exec_policy& ep, const add& f, const add::label_type var, const bool value)
+  {
+    if (add_isconst(f) || !internal::has_level(f, var)) { return f; }
+
+    // The select sweep only reports the truth value of a terminal reached from the root. Hence, the
+    // case of the root being restricted to a terminal is resolved here.
+    if (add_topvar(f) == var) {
+      internal::node_ifstream<> in(f);
+      const add::pointer_type root_child = in.pull().child(value);
+
+      if (root_child.is_terminal()) { return add_const(root_child.numeric_value()); }
+    }
+
+    add_cofactor_policy policy(var, value);
+    return internal::select(ep, f, policy);
+  }
+
+  __add
+  add_exists(const exec_policy& ep, const add& f, add::label_type var)
+  {
+    // If `f` does not depend on `var`, then both cofactors share the same file and the sum is
+    // resolved as a single sweep that doubles every terminal.
+    return add_plus(ep, __add_cofactor(ep, f, var, false), __add_cofactor(ep, f, var, true));
+  }
+
+  __add
+  add_exists(const add& f, add::label_type var)
+  {
+    return add_exists(exec_policy(), f, var);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Policy to add a node on each to-be summed level to every path of an ADD.
+  ///
+  /// \details Quantification skips the levels an ADD does not depend on, whereas the sum doubles
+  ///          the function for each of them. Hence, a redundant node is added on every such level.
+  class add_sum_intercut_policy : public add_policy
+  {
+  public:
+    static constexpr bool may_skip = false;
+
+    static constexpr bool cut_true_terminal  = true;
+    static constexpr bool cut_false_terminal = true;
+
+    static constexpr size_t mult_factor = 2u;
+
+  public:
+    static add
+    on_empty_labels(const add& dd)
+    {
+      return dd;
+    }
+
+    // LCOV_EXCL_START
+    static add
+    on_terminal_input(const bool /*terminal_value*/,
+                      const add& /*dd*/,
+                      const internal::internal_vector<add::label_type>& /*vars*/)
+    {
+      // Constant ADDs are resolved before the sweep.
+      adiar_unreachable();
+    }
+
+    static add
+    terminal(const bool /*terminal_value*/)
+    {
+      adiar_unreachable();
+    }
+
+    // LCOV_EXCL_STOP
+
+    static inline internal::intercut_rec
+    hit_existing(const add::node_type& n)
+    {
+      return internal::intercut_rec_output{ n.low(), n.high() };
+    }
+
+    static inline internal::intercut_rec_output
+    hit_cut(const add::pointer_type& target)
+    {
+      return internal::intercut_rec_output{ target, target };
+    }
+
+    static inline internal::intercut_rec_output
+    miss_existing(const add::node_type& n)
+    {
+      return internal::intercut_rec_output{ n.low(), n.high() };
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Policy to quantify variables by combining both children with `+`.
+  ///
+  /// \details Unlike `max`, the sum is not idempotent: a node with two identical children results
+  ///          in twice its child rather than the child itself.
+  class add_sum_policy : public add_policy
+  {
+  public:
+    static inline add::pointer_type
+    resolve_root(const add::node_type& r)
+    {
+      // Sum up two terminals right away.
+      if (r.low().is_terminal() && r.high().is_terminal()) {
+        return resolve_terminals(essential(r.low()), essential(r.high()));
+      }
+
+      // Otherwise return 'nothing'
+      return r.uid();
+    }
+
+  public:
+    static constexpr bool
+    keep_terminal(const add::pointer_type& /*p*/)
+    {
+      return true;
+    }
+
+    static constexpr bool
+    collapse_to_terminal(const add::pointer_type& /*p*/)
+    {
+      return false;
+    }
+
+    static inline add::pointer_type
+    resolve_terminals(const add::pointer_type& a, const add::pointer_type& b)
+    {
+      return add::pointer_type::numeric_terminal(a.numeric_value() + b.numeric_value());
+    }
+
+  public:
+    static inline internal::cut
+    cut_with_terminals()
+    {
+      return internal::cut::All;
+    }
+
+  public:
+    static constexpr bool quantify_onset = true;
+
+    static constexpr bool idempotent = false;
+  };
+
+  __add
+  add_exists(const exec_policy& ep, const add& f, const generator<add::label_type>& vars)
+  {
+    // Copy the variables, since they are needed both in ascending and in descending order.
+    internal::internal_vector<add::label_type> xs;
+    for (optional<add::label_type> x = vars(); x; x = vars()) {
+      if (!xs.empty() && xs.back() <= x.value()) {
+        throw invalid_argument("Variables are not in descending order");
+      }
+      xs.push_back(x.value());
+    }
+
+    if (xs.empty()) { return f; }
+
+    // Each variable doubles the value of a constant (which overflows to 0 at some point).
+    if (add_isconst(f)) {
+      const bool overflow = std::numeric_limits<add::value_type>::digits <= xs.size();
+      return add_const(overflow ? 0u : add_valueof(f) << xs.size());
+    }
+
+    // Add a node on each to-be summed level to every path and then sum over all of them in a single
+    // Nested Sweep. Repeated single-variable sweeps would not work, since the Reduce of each sweep
+    // removes the added nodes again.
+    __add g = internal::intercut<add_sum_intercut_policy>(
+      ep, f, make_generator(xs.rbegin(), xs.rend()));
+
+    return internal::quantify<add_sum_policy>(
+      ep & exec_policy::quantify::Nested, std::move(g), make_generator(xs.begin(), xs.end()));
+  }
+
+  __add
+  add_exists(const add& f, const generator<add::label_type>& vars)
+  {
+    return add_exists(exec_policy(), f, vars);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Max abstraction
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Policy to quantify variables by combining both children with `max`.
+  class add_maxabstract_policy : public add_policy
+  {
+  private:
+    static constexpr add::pointer_type shortcutting_terminal =
+      add::pointer_type::numeric_terminal(std::numeric_limits<add::value_type>::max());
+
+    static constexpr add::pointer_type irrelevant_terminal =
+      add::pointer_type::numeric_terminal(0u);
+
+  public:
+    static inline add::pointer_type
+    resolve_root(const add::node_type& r)
+    {
+      // Return shortcutting terminal (including its tainting flag).
+      if (essential(r.low()) == shortcutting_terminal) { return r.low(); }
+      if (essential(r.high()) == shortcutting_terminal) { return r.high(); }
+
+      // Return other child (including its tainting flag) for irrelevant terminals.
+      if (essential(r.low()) == irrelevant_terminal) { return r.high(); }
+      if (essential(r.high()) == irrelevant_terminal) { return r.low(); }
+
+      // Otherwise return 'nothing'
+      return r.uid();
+    }
+
+  public:
+    static inline bool
+    keep_terminal(const add::pointer_type& p)
+    {
+      return essential(p) != irrelevant_terminal;
+    }
+
+    static inline bool
+    collapse_to_terminal(const add::pointer_type& p)
+    {
+      return essential(p) == shortcutting_terminal;
+    }
+
+    static inline add::pointer_type
+    resolve_terminals(const add::pointer_type& a, const add::pointer_type& b)
+    {
+      return add::pointer_type::numeric_terminal(std::max(a.numeric_value(), b.numeric_value()));
+    }
+
+  public:
+    static inline internal::cut
+    cut_with_terminals()
+    {
+      return internal::cut::All;
+    }
+
+  public:
+    static constexpr bool quantify_onset = true;
+
+    static constexpr bool idempotent = true;
+  };
+
+  __add
+  add_maxabstract(const exec_policy& ep, const add& f, add::label_type var)
+  {
+    return internal::quantify<add_maxabstract_policy>(ep, f, var);
+  }
+
+  __add
+  add_maxabstract(const add& f, add::label_type var)
+  {
+    return add_maxabstract(exec_policy(), f, var);
+  }
+
+  // The pruning sweep before Nested Sweeping assumes Boolean terminals when it collapses to a
+  // terminal. Hence, multiple variables are quantified with repeated single-variable sweeps.
+
+  __add
+  add_maxabstract(const exec_policy& ep, const add& f, const predicate<add::label_type>& vars)
+  {
+    return internal::quantify<add_maxabstract_policy>(
+      ep & exec_policy::quantify::Singleton, f, vars);
+  }
+
+  __add
+  add_maxabstract(const add& f, const predicate<add::label_type>& vars)
+  {
+    return add_maxabstract(exec_policy(), f, vars);
+  }
+
+  __add
+  add_maxabstract(const exec_policy& ep, const add& f, const generator<add::label_type>& vars)
+  {
+    return internal::quantify<add_maxabstract_policy>(
+      ep & exec_policy::quantify::Singleton, f, vars);
+  }
+
+  __add
+  add_maxabstract(const add& f, const generator<add::label_type>& vars)
+  {
+    return add_maxabstract(exec_policy(), f, vars);
+  }
+}
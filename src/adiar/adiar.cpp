@@ -1,6 +1,8 @@
 #include "adiar.h"
 
+#include <atomic>
 #include <exception>
+#include <mutex>
 
 #include <tpie/memory.h>
 #include <tpie/tempname.h>
@@ -8,16 +10,31 @@
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/block_size.h>
+#include <adiar/internal/data_structures/result_cache.h>
+#include <adiar/internal/io/file.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar
 {
   /// \brief Whether Adiar is initialized.
-  bool _adiar_initialized = false;
+  std::atomic<bool> _adiar_initialized = false;
 
   /// \brief Whether TPIE is initialized.
   bool _tpie_initialized = false;
 
+  /// \brief Guard for (de)initialising Adiar and partitioning its memory.
+  std::mutex _adiar_mutex;
+
+  /// \brief Sum of all memory set aside for specific threads.
+  size_t _partitioned_memory = 0u;
+
+  /// \brief Memory set aside for the result cache.
+  size_t _cache_memory = 0u;
+
+  /// \brief Memory set aside for in-memory files.
+  size_t _memfile_memory = 0u;
+
   /// \brief Subsystems of TPIE to be enabled
   const tpie::flags<tpie::subsystem> _tpie_subsystems =
     // Enable subsystems we use directly from Adiar
@@ -52,9 +69,20 @@ namespace adiar
   dev_null _devnull;
 #endif
 
+  namespace internal
+  {
+    thread_local size_t thread_memory_limit = 0u;
+
+    std::atomic<size_t> memory_epoch = 0u;
+
+    thread_local size_t thread_memory_epoch = 0u;
+  }
+
   void
   adiar_init(size_t memory_limit_bytes, std::string temp_dir)
   {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
     if (_adiar_initialized) {
 #ifndef NDEBUG
       std::cerr << "Adiar has already been initialized! Skipping 'adiar_init()'" << std::endl;
@@ -126,10 +154,27 @@ namespace adiar
   void
   adiar_deinit()
   {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
     if (!_adiar_initialized) return;
 
     domain_unset();
 
+    internal::global_result_cache.set_capacity(0u);
+    internal::global_result_cache.clear();
+    tpie::get_memory_manager().register_decreased_usage(_cache_memory);
+    _cache_memory = 0u;
+
+    internal::global_memory_file_pool.set_capacity(0u, 0u);
+    tpie::get_memory_manager().register_decreased_usage(_memfile_memory);
+    _memfile_memory = 0u;
+
+    internal::global_file_codec = false;
+
+    // Invalidate the partitions of all threads (not only the calling one).
+    _partitioned_memory = 0u;
+    internal::memory_epoch += 1u;
+
     tpie::tpie_finish(_tpie_subsystems);
     _adiar_initialized = false;
 
@@ -138,4 +183,127 @@ namespace adiar
     //
     // See: 'https://github.com/thomasmoelhave/tpie/issues/265'
   }
+
+  void
+  adiar_thread_init(size_t memory_limit_bytes)
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    if (!_adiar_initialized) {
+      throw runtime_error("Adiar must be initialized before calling 'adiar_thread_init()'");
+    }
+    if (memory_limit_bytes < minimum_memory) {
+      throw invalid_argument("Adiar requires at least "
+                             + std::to_string(minimum_memory / 1024 / 1024)
+                             + " MiB of memory per thread");
+    }
+
+    // Release the previous partition of this thread (if any)
+    const size_t partitioned_memory = _partitioned_memory - internal::thread_memory_partition();
+
+    if (tpie::get_memory_manager().limit() < partitioned_memory + memory_limit_bytes) {
+      throw invalid_argument("Memory of all threads exceeds the limit given to 'adiar_init()'");
+    }
+
+    _partitioned_memory           = partitioned_memory + memory_limit_bytes;
+    internal::thread_memory_limit = memory_limit_bytes;
+    internal::thread_memory_epoch = internal::memory_epoch;
+
+    internal::statistics_reset_thread();
+  }
+
+  void
+  adiar_thread_deinit()
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    _partitioned_memory -= internal::thread_memory_partition();
+    internal::thread_memory_limit = 0u;
+  }
+
+  void
+  adiar_cache_init(size_t memory_limit_bytes)
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    if (!_adiar_initialized) {
+      throw runtime_error("Adiar must be initialized before calling 'adiar_cache_init()'");
+    }
+    if (internal::result_cache::memory_fits(memory_limit_bytes) == 0u) {
+      throw invalid_argument("Memory for result cache is too small to fit a single entry");
+    }
+    // Release the previous memory of the cache (if any)
+    if (tpie::get_memory_manager().available() + _cache_memory < memory_limit_bytes) {
+      throw invalid_argument("Memory for result cache exceeds the memory available");
+    }
+
+    tpie::get_memory_manager().register_decreased_usage(_cache_memory);
+    tpie::get_memory_manager().register_increased_usage(memory_limit_bytes);
+    _cache_memory = memory_limit_bytes;
+
+    internal::global_result_cache.set_capacity(
+      internal::result_cache::memory_fits(memory_limit_bytes));
+  }
+
+  void
+  adiar_cache_deinit()
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    internal::global_result_cache.set_capacity(0u);
+    internal::global_result_cache.clear();
+
+    tpie::get_memory_manager().register_decreased_usage(_cache_memory);
+    _cache_memory = 0u;
+  }
+
+  void
+  adiar_memfile_init(size_t memory_limit_bytes, size_t file_limit_bytes)
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    if (!_adiar_initialized) {
+      throw runtime_error("Adiar must be initialized before calling 'adiar_memfile_init()'");
+    }
+    // Release the previous memory of the files (if any)
+    if (tpie::get_memory_manager().available() + _memfile_memory < memory_limit_bytes) {
+      throw invalid_argument("Memory for in-memory files exceeds the memory available");
+    }
+
+    tpie::get_memory_manager().register_decreased_usage(_memfile_memory);
+    tpie::get_memory_manager().register_increased_usage(memory_limit_bytes);
+    _memfile_memory = memory_limit_bytes;
+
+    internal::global_memory_file_pool.set_capacity(memory_limit_bytes, file_limit_bytes);
+  }
+
+  void
+  adiar_memfile_deinit()
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    internal::global_memory_file_pool.set_capacity(0u, 0u);
+
+    tpie::get_memory_manager().register_decreased_usage(_memfile_memory);
+    _memfile_memory = 0u;
+  }
+
+  void
+  adiar_compression_init()
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    if (!_adiar_initialized) {
+      throw runtime_error("Adiar must be initialized before calling 'adiar_compression_init()'");
+    }
+    internal::global_file_codec = true;
+  }
+
+  void
+  adiar_compression_deinit()
+  {
+    const std::lock_guard<std::mutex> lock(_adiar_mutex);
+
+    internal::global_file_codec = false;
+  }
 }
@@ -24,6 +24,7 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// Decision Diagrams
+#include <adiar/add.h>
 #include <adiar/bdd.h>
 #include <adiar/builder.h>
 #include <adiar/zdd.h>
@@ -89,6 +90,9 @@ namespace adiar
   ///          That is, any \ref bdd \ref bdd_builder, \ref zdd \ref zdd_builder or any \ref
   ///          shared_file objects you may be using.
   ///
+  /// \remark  This also releases the memory partitions of *all* threads, i.e. not only the one of
+  ///          the calling thread.
+  ///
   /// \throws runtime_error
   ///   If compiled with *debug* and one of Adiar's objects have *not* been destructed.
   //////////////////////////////////////////////////////////////////////////////
@@ -98,6 +102,174 @@ namespace adiar
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \name Multi-threading
+  ///
+  /// Multiple threads may run Adiar's operations at the same time, as long as they do not modify
+  /// the same \ref bdd or \ref zdd objects. Each thread gathers its own \ref statistics (which are
+  /// added to a shared total when it exits) while the \ref module__domain is shared between all
+  /// threads.
+  ///
+  /// Since all of Adiar's algorithms assume to have all of the memory at their disposal, each
+  /// thread should set aside its own partition of the memory given to `adiar_init()`.
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Restrict the calling thread to only use a partition of Adiar's memory.
+  ///
+  /// \details Calling this function a second time on the same thread replaces its prior partition.
+  ///          The statistics of the calling thread are reset.
+  ///
+  /// \param memory_limit_bytes
+  ///   The amount of internal memory (in bytes) that this thread is allowed to use. This has to be
+  ///   at least minimum_memory.
+  ///
+  /// \throws invalid_argument
+  ///   If `memory_limit_bytes` is set to a value less than the `minimum_memory` required or if the
+  ///   partitions of all threads together exceed the memory given to `adiar_init()`.
+  ///
+  /// \throws runtime_error
+  ///   If Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_thread_init(size_t memory_limit_bytes);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Release the partition of memory of the calling thread.
+  ///
+  /// \see adiar_thread_init
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_thread_deinit();
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \name Result Cache
+  ///
+  /// Adiar can remember the (reduced) result of its operations. If the very same operation is
+  /// applied to the very same diagrams again, then the previous result is returned immediately.
+  /// The cache only holds weak references: it never prevents a diagram from being garbage
+  /// collected and entries are dropped when any of the involved diagrams has been.
+  ///
+  /// The cache is disabled by default. Operations where the result is piped into the next one (see
+  /// \ref exec_policy::chain) bypass the cache.
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Enable the cache of previously computed results.
+  ///
+  /// \details Calling this function a second time replaces the prior memory limit of the cache. If
+  ///          the new limit is smaller, then the least recently used entries are evicted.
+  ///
+  /// \param memory_limit_bytes
+  ///   The amount of internal memory (in bytes) set aside for the cache. This memory is taken from
+  ///   the memory given to `adiar_init()`.
+  ///
+  /// \throws invalid_argument
+  ///   If `memory_limit_bytes` is too small to fit a single entry or exceeds the memory still
+  ///   available.
+  ///
+  /// \throws runtime_error
+  ///   If Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_cache_init(size_t memory_limit_bytes);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Disable the cache and release its memory.
+  ///
+  /// \see adiar_cache_init
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_cache_deinit();
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \name In-memory Files
+  ///
+  /// Every temporary file is by default created on disk. For small diagrams, the cost of creating,
+  /// opening, closing, and removing these files can dominate the running time. Instead, Adiar can
+  /// keep new temporary files in internal memory. Such a file is moved to disk only when it grows
+  /// too large or when the memory set aside for these files runs out.
+  ///
+  /// In-memory files are disabled by default.
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Enable keeping small temporary files in internal memory.
+  ///
+  /// \details Calling this function a second time replaces the prior memory limits. Files already
+  ///          in internal memory stay there until they are not used anymore.
+  ///
+  /// \param memory_limit_bytes
+  ///   The amount of internal memory (in bytes) set aside for all such files together. This memory
+  ///   is taken from the memory given to `adiar_init()`.
+  ///
+  /// \param file_limit_bytes
+  ///   The size (in bytes) beyond which a single file is moved to disk.
+  ///
+  /// \throws invalid_argument
+  ///   If `memory_limit_bytes` exceeds the memory still available.
+  ///
+  /// \throws runtime_error
+  ///   If Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_memfile_init(size_t memory_limit_bytes, size_t file_limit_bytes = 1024 * 1024);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Create all new temporary files on disk again and release the memory set aside.
+  ///
+  /// \see adiar_memfile_init
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_memfile_deinit();
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \name Compressed Files
+  ///
+  /// The nodes and arcs of a decision diagram are highly regular: labels are constant within a
+  /// level and identifiers are dense. Hence, Adiar can store temporary files on disk compressed
+  /// with a lightweight delta- and varint-encoding. This trades a little computation time for
+  /// less I/O, which pays off if the disk (or network storage) is slow.
+  ///
+  /// Compressed files are disabled by default. Persistent files, e.g. the ones written by
+  /// `bdd_save`, are always stored uncompressed.
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Store all new temporary files compressed on disk.
+  ///
+  /// \details Files that already exist keep their current format.
+  ///
+  /// \throws runtime_error
+  ///   If Adiar is not initialized.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_compression_init();
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Store all new temporary files uncompressed on disk again.
+  ///
+  /// \see adiar_compression_init
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  adiar_compression_deinit();
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////
 }
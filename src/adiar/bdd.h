@@ -13,8 +13,10 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <iterator>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include <adiar/bdd/bdd.h>
 #include <adiar/bool_op.h>
@@ -177,12 +179,20 @@ namespace adiar
   /// \returns \f$ \bigwedge_{x \in \mathit{begin} \dots \mathit{end}} x \f$
   ///
   /// \throws invalid_argument If the iterator does not provide values in descending order.
+  ///
+  /// \remark If `begin` provides BDDs rather than variables, then this is the conjunction of all of
+  ///         them, i.e. `bdd_and(const exec_policy&, ForwardIt, ForwardIt)`.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename ForwardIt, typename = enable_if<!is_convertible<ForwardIt, bdd>>>
+  template <typename ForwardIt,
+            typename = enable_if<!is_convertible<ForwardIt, bdd> || is_pointer<ForwardIt>>>
   bdd
   bdd_and(ForwardIt begin, ForwardIt end)
   {
-    return bdd_and(make_generator(begin, end));
+    if constexpr (is_same<typename std::iterator_traits<ForwardIt>::value_type, bdd>) {
+      return bdd_and(exec_policy(), make_generator(begin, end));
+    } else {
+      return bdd_and(make_generator(begin, end));
+    }
   }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -235,12 +245,20 @@ namespace adiar
   /// \returns \f$ \bigwedge_{x \in \mathit{begin} \dots \mathit{end}} x \f$
   ///
   /// \throws invalid_argument If the iterator does not provide values in descending order.
+  ///
+  /// \remark If `begin` provides BDDs rather than variables, then this is the disjunction of all of
+  ///         them, i.e. `bdd_or(const exec_policy&, ForwardIt, ForwardIt)`.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename ForwardIt, typename = enable_if<!is_convertible<ForwardIt, bdd>>>
+  template <typename ForwardIt,
+            typename = enable_if<!is_convertible<ForwardIt, bdd> || is_pointer<ForwardIt>>>
   bdd
   bdd_or(ForwardIt begin, ForwardIt end)
   {
-    return bdd_or(make_generator(begin, end));
+    if constexpr (is_same<typename std::iterator_traits<ForwardIt>::value_type, bdd>) {
+      return bdd_or(exec_policy(), make_generator(begin, end));
+    } else {
+      return bdd_or(make_generator(begin, end));
+    }
   }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,6 +385,93 @@ namespace adiar
   __bdd
   bdd_apply(const exec_policy& ep, const bdd& f, const bdd& g, const predicate<bool, bool>& op);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator between two (possibly unreduced) BDDs.
+  ///
+  /// \details If `exec_policy::chain::Pipe` is set in `ep` or in the execution policy that created
+  ///          an unreduced argument, then its levels are directly piped into this operation, i.e.
+  ///          it is not reduced beforehand. Without `ep`, the execution policy of such an argument
+  ///          is also used for this operation.
+  ///
+  /// \see exec_policy::chain
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_apply(const exec_policy& ep, __bdd&& f, __bdd&& g, const predicate<bool, bool>& op);
+
+  /// \cond
+  __bdd
+  bdd_apply(const exec_policy& ep, const bdd& f, __bdd&& g, const predicate<bool, bool>& op);
+  __bdd
+  bdd_apply(const exec_policy& ep, __bdd&& f, const bdd& g, const predicate<bool, bool>& op);
+  __bdd
+  bdd_apply(__bdd&& f, __bdd&& g, const predicate<bool, bool>& op);
+  __bdd
+  bdd_apply(const bdd& f, __bdd&& g, const predicate<bool, bool>& op);
+  __bdd
+  bdd_apply(__bdd&& f, const bdd& g, const predicate<bool, bool>& op);
+  /// \endcond
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator to all the given BDDs.
+  ///
+  /// \details Up to four BDDs are combined within a single n-ary product construction (fewer, if
+  ///          they do not fit into memory together). If `op` is associative, then more BDDs are
+  ///          combined in a balanced tree of such products. Otherwise, they are combined from left
+  ///          to right.
+  ///
+  /// \param fs
+  ///    Generator of BDDs \f$ f_0, f_1, \dots, f_{n-1} \f$.
+  ///
+  /// \param op
+  ///    Binary predicate on `bool` to-be applied.
+  ///
+  /// \returns \f$ (\dots((f_0 \mathbin{\mathit{op}} f_1) \mathbin{\mathit{op}} f_2) \dots)
+  ///          \mathbin{\mathit{op}} f_{n-1} \f$
+  ///
+  /// \throws invalid_argument If `fs` is empty.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_apply(const generator<bdd>& fs, const predicate<bool, bool>& op);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator to all the given BDDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_apply(const exec_policy& ep, const generator<bdd>& fs, const predicate<bool, bool>& op);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator to all the given BDDs.
+  ///
+  /// \param begin
+  ///    Single-pass forward iterator that provides the BDDs.
+  ///
+  /// \param end
+  ///    Marks the end for `begin`.
+  ///
+  /// \param op
+  ///    Binary predicate on `bool` to-be applied.
+  ///
+  /// \see bdd_apply(const generator<bdd>&, const predicate<bool, bool>&)
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename ForwardIt,
+            typename = enable_if<!is_convertible<ForwardIt, bdd> || is_pointer<ForwardIt>>>
+  __bdd
+  bdd_apply(ForwardIt begin, ForwardIt end, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(make_generator(begin, end), op);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Apply a binary operator to all the given BDDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename ForwardIt,
+            typename = enable_if<!is_convertible<ForwardIt, bdd> || is_pointer<ForwardIt>>>
+  __bdd
+  bdd_apply(const exec_policy& ep, ForwardIt begin, ForwardIt end, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(ep, make_generator(begin, end), op);
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Logical 'and' operator.
   ///
@@ -383,6 +488,45 @@ namespace adiar
   __bdd
   bdd_and(const exec_policy& ep, const bdd& f, const bdd& g);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Logical 'and' of all the given BDDs.
+  ///
+  /// \details Up to four BDDs are combined within a single n-ary product construction (fewer, if
+  ///          they do not fit into memory together) and more BDDs are combined in a balanced tree
+  ///          of such products. Compared to folding `bdd_and` pairwise, this writes and reduces
+  ///          fewer intermediate results.
+  ///
+  /// \param fs
+  ///    Generator of BDDs.
+  ///
+  /// \returns \f$ \bigwedge_{f \in \mathit{fs}} f \f$ (i.e. `bdd_top()` if `fs` is empty)
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_and(const exec_policy& ep, const generator<bdd>& fs);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Logical 'and' of all the given BDDs.
+  ///
+  /// \param begin
+  ///    Single-pass forward iterator that provides the BDDs.
+  ///
+  /// \param end
+  ///    Marks the end for `begin`.
+  ///
+  /// \returns \f$ \bigwedge_{f \in \mathit{begin} \dots \mathit{end}} f \f$
+  ///
+  /// \see bdd_and(const exec_policy&, const generator<bdd>&)
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename ForwardIt,
+            typename = enable_if<!is_convertible<ForwardIt, bdd> || is_pointer<ForwardIt>>>
+  __bdd
+  bdd_and(const exec_policy& ep, ForwardIt begin, ForwardIt end)
+  {
+    static_assert(is_same<typename std::iterator_traits<ForwardIt>::value_type, bdd>,
+                  "Iterator must provide BDDs");
+    return bdd_and(ep, make_generator(begin, end));
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \see bdd_and
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -445,6 +589,45 @@ namespace adiar
   __bdd
   bdd_or(const exec_policy& ep, const bdd& f, const bdd& g);
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Logical 'or' of all the given BDDs.
+  ///
+  /// \details Up to four BDDs are combined within a single n-ary product construction (fewer, if
+  ///          they do not fit into memory together) and more BDDs are combined in a balanced tree
+  ///          of such products. Compared to folding `bdd_or` pairwise, this writes and reduces
+  ///          fewer intermediate results.
+  ///
+  /// \param fs
+  ///    Generator of BDDs.
+  ///
+  /// \returns \f$ \bigvee_{f \in \mathit{fs}} f \f$ (i.e. `bdd_bot()` if `fs` is empty)
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_or(const exec_policy& ep, const generator<bdd>& fs);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Logical 'or' of all the given BDDs.
+  ///
+  /// \param begin
+  ///    Single-pass forward iterator that provides the BDDs.
+  ///
+  /// \param end
+  ///    Marks the end for `begin`.
+  ///
+  /// \returns \f$ \bigvee_{f \in \mathit{begin} \dots \mathit{end}} f \f$
+  ///
+  /// \see bdd_or(const exec_policy&, const generator<bdd>&)
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename ForwardIt,
+            typename = enable_if<!is_convertible<ForwardIt, bdd> || is_pointer<ForwardIt>>>
+  __bdd
+  bdd_or(const exec_policy& ep, ForwardIt begin, ForwardIt end)
+  {
+    static_assert(is_same<typename std::iterator_traits<ForwardIt>::value_type, bdd>,
+                  "Iterator must provide BDDs");
+    return bdd_or(ep, make_generator(begin, end));
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \see bdd_or
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1385,6 +1568,12 @@ namespace adiar
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Replace variables in *f* according to the mapping in *m*.
   ///
+  /// \details The mapping *m* does not need to be monotonic. If it is, then the nodes of *f* are
+  ///          relabelled in a single linear scan (or on-the-fly if *m* is a shift). Otherwise, the
+  ///          levels of *f* on a longest increasing subsequence of their targets stay in place
+  ///          and every other level is moved once, either with a few swaps of adjacent levels or
+  ///          with a single jump using \f$ O(\mathit{sort}(N)) \f$ I/Os.
+  ///
   /// \param f
   ///    BDD to replace variables within
   ///
@@ -1395,7 +1584,7 @@ namespace adiar
   ///    Guarantees on the class of variable relabelling, e.g. whether it is monotonic. By default,
   ///    this value is inferred automatically.
   ///
-  /// \throws invalid_argument if `m_type` classifies `m` as not monotonic.
+  /// \throws invalid_argument if `m` maps two levels of *f* to the same level.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   __bdd
   bdd_replace(const bdd& f,
@@ -1416,6 +1605,8 @@ namespace adiar
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Replace variables in *f* according to the mapping in *m*.
   ///
+  /// \details If *f* is unreduced and *m* is monotonic, then the variables are replaced as part of
+  ///          the Reduce algorithm. Otherwise, *f* is reduced first.
   ///
   /// \param f
   ///    Possibly unreduced BDD to replace variables within
@@ -1427,7 +1618,7 @@ namespace adiar
   ///    Guarantees on the class of variable relabelling, e.g. whether it is monotonic. By default,
   ///    this value is inferred automatically.
   ///
-  /// \throws invalid_argument if `m_type` classifies `m` as not monotonic.
+  /// \throws invalid_argument if `m` maps two levels of *f* to the same level.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   __bdd
   bdd_replace(__bdd&& f,
@@ -1445,6 +1636,48 @@ namespace adiar
 
   /// \endcond
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Search for a variable ordering of *f* with fewer nodes.
+  ///
+  /// \details The BDD is reordered by repeatedly swapping two adjacent levels, each of which is a
+  ///          single linear sweep through the BDD that only keeps the two levels in internal
+  ///          memory. Swaps of levels that are too wide for internal memory are skipped.
+  ///
+  /// \param f
+  ///    BDD to reorder
+  ///
+  /// \param r_type
+  ///    Heuristic to search for a better ordering.
+  ///
+  /// \param size_bound
+  ///    If an intermediate BDD has more nodes than this, the heuristic stops moving variables in
+  ///    that direction. By default, this is twice the size of *f*.
+  ///
+  /// \returns The reordered BDD and the permutation `m` that maps each variable of *f* to its new
+  ///          level, i.e. the result is `bdd_replace(f, m)`. The permutation has an entry for all
+  ///          variables up to the deepest level of *f*.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const bdd& f, reorder_type r_type = reorder_type::Sifting);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Search for a variable ordering of *f* with fewer nodes.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const exec_policy& ep, const bdd& f, reorder_type r_type = reorder_type::Sifting);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Search for a variable ordering of *f* with fewer nodes.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const bdd& f, reorder_type r_type, size_t size_bound);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Search for a variable ordering of *f* with fewer nodes.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const exec_policy& ep, const bdd& f, reorder_type r_type, size_t size_bound);
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -1500,7 +1733,7 @@ namespace adiar
   /// \returns \f$ (\exists x \in \{ x \mid \mathit{m}(x) = \text{None} \}
   ///                        : (\mathit{states} \land \mathit{relation}))[x' \mapsto m(x')] \f$
   ///
-  /// \throws invalid_argument if `m` is not a monotonic relabelling.
+  /// \throws invalid_argument if `m` is not an injective relabelling.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   bdd
   bdd_relnext(const bdd& states,
@@ -1594,7 +1827,7 @@ namespace adiar
   /// \returns \f$ (\exists x' \in \{ x' \mid \mathit{m}(x') = \text{None} \}
   ///                        : (\mathit{states}[x \mapsto m(x)] \land \mathit{relation})) \f$
   ///
-  /// \throws invalid_argument if `m` is not a monotonic relabelling.
+  /// \throws invalid_argument if `m` is not an injective relabelling.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   bdd
   bdd_relprev(const bdd& states,
@@ -2373,6 +2606,45 @@ namespace adiar
 
   /// \}
   //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__bdd Files
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Save a BDD to disk, such that it can be loaded again with `bdd_load`.
+  ///
+  /// \details The BDD is stored as a single file at `path`. It starts with a versioned header
+  ///          with the configuration of Adiar, the BDD's levels, cuts, terminal counts, and
+  ///          whether it is canonical. This is followed by its nodes. Everything is stored in
+  ///          little-endian byte order.
+  ///
+  /// \param path Path of the file to create.
+  ///
+  /// \throws runtime_error If a file at the given path already exists.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  bdd_save(const bdd& f, const std::string& path);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Load a BDD previously saved with `bdd_save`.
+  ///
+  /// \details The file's header is validated before it is used. If possible, the file is then
+  ///          memory-mapped and its nodes are read in-place rather than being copied. Hence, the
+  ///          file must neither be changed nor removed while the loaded BDD (or any BDD that
+  ///          shares its nodes) is in use.
+  ///
+  /// \param path Path given to `bdd_save`.
+  ///
+  /// \throws runtime_error If the file is missing or was saved with an incompatible version or
+  ///                       configuration of Adiar, e.g. a different number of level bits.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bdd
+  bdd_load(const std::string& path);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 #endif // ADIAR_BDD_H
@@ -1,10 +1,15 @@
+#include <vector>
+
 #include <adiar/bdd.h>
 #include <adiar/bdd/bdd_policy.h>
 
 #include <adiar/internal/algorithms/prod2b.h>
+#include <adiar/internal/algorithms/prodn.h>
+#include <adiar/internal/algorithms/small.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/bool_op.h>
 #include <adiar/internal/cut.h>
+#include <adiar/internal/data_structures/result_cache.h>
 #include <adiar/internal/data_types/tuple.h>
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/unreachable.h>
@@ -44,6 +49,17 @@ namespace adiar
       this->_op = this->_op.flip();
     }
 
+  public:
+    /// \brief Truth table of the operator, e.g. to identify it in the result cache.
+    uint64_t
+    truth_table() const
+    {
+      return (static_cast<uint64_t>(this->_op(false, false)) << 0u)
+        | (static_cast<uint64_t>(this->_op(false, true)) << 1u)
+        | (static_cast<uint64_t>(this->_op(true, false)) << 2u)
+        | (static_cast<uint64_t>(this->_op(true, true)) << 3u);
+    }
+
   public:
     /// \brief Hook for case of two BDDs with the same node file.
     __bdd
@@ -141,12 +157,34 @@ namespace adiar
     static constexpr bool no_skip = true;
   };
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Product construction of two reduced BDDs (or its result from the result cache).
+  template <typename BinaryOp>
+  __bdd
+  __bdd_apply(const exec_policy& ep,
+              const bdd& f,
+              const bdd& g,
+              apply_prod2b_policy<BinaryOp>& policy)
+  {
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Apply,
+      policy.truth_table(),
+      std::array<const internal::dd*, 2>{ &f, &g },
+      [&ep, &f, &g, &policy]() -> __bdd {
+        const auto small_res = internal::small_apply(ep, f, g, policy.truth_table());
+        if (small_res) { return small_res.value(); }
+
+        return internal::prod2b(ep, f, g, policy);
+      });
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   __bdd
   bdd_apply(const exec_policy& ep, const bdd& f, const bdd& g, const predicate<bool, bool>& op)
   {
     apply_prod2b_policy<internal::binary_op<predicate<bool, bool>>> policy(op);
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -155,12 +193,92 @@ namespace adiar
     return bdd_apply(exec_policy(), f, g, op);
   }
 
+  __bdd
+  bdd_apply(const exec_policy& ep, __bdd&& f, __bdd&& g, const predicate<bool, bool>& op)
+  {
+    // Nothing to pipe? Then reduce both inputs such that the result cache may be used.
+    if (!internal::__prod2b_can_pipe(ep, f) && !internal::__prod2b_can_pipe(ep, g)) {
+      return bdd_apply(ep, bdd(std::move(f)), bdd(std::move(g)), op);
+    }
+
+    apply_prod2b_policy<internal::binary_op<predicate<bool, bool>>> policy(op);
+    return internal::prod2b(ep, std::move(f), std::move(g), policy);
+  }
+
+  __bdd
+  bdd_apply(const exec_policy& ep, const bdd& f, __bdd&& g, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(ep, __bdd(f), std::move(g), op);
+  }
+
+  __bdd
+  bdd_apply(const exec_policy& ep, __bdd&& f, const bdd& g, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(ep, std::move(f), __bdd(g), op);
+  }
+
+  /// \brief Whether an argument is unreduced and its execution policy asks for it to be piped.
+  inline bool
+  __bdd_is_piped(const __bdd& f)
+  {
+    return f.has<__bdd::shared_arc_file_type>()
+      && f._policy.get<exec_policy::chain>() == exec_policy::chain::Pipe;
+  }
+
+  __bdd
+  bdd_apply(__bdd&& f, __bdd&& g, const predicate<bool, bool>& op)
+  {
+    const exec_policy ep = __bdd_is_piped(f) ? f._policy
+      : __bdd_is_piped(g)                    ? g._policy
+                                             : exec_policy();
+
+    return bdd_apply(ep, std::move(f), std::move(g), op);
+  }
+
+  __bdd
+  bdd_apply(const bdd& f, __bdd&& g, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(__bdd(f), std::move(g), op);
+  }
+
+  __bdd
+  bdd_apply(__bdd&& f, const bdd& g, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(std::move(f), __bdd(g), op);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain all BDDs provided by a generator.
+  inline std::vector<bdd>
+  __bdd_collect(const generator<bdd>& fs)
+  {
+    std::vector<bdd> result;
+    for (auto f = fs(); f; f = fs()) { result.push_back(std::move(f.value())); }
+    return result;
+  }
+
+  __bdd
+  bdd_apply(const exec_policy& ep, const generator<bdd>& fs, const predicate<bool, bool>& op)
+  {
+    std::vector<bdd> ins = __bdd_collect(fs);
+    if (ins.empty()) { throw invalid_argument("Must be given at least one BDD"); }
+
+    const apply_prod2b_policy<internal::binary_op<predicate<bool, bool>>> policy(op);
+    return internal::prodn(ep, std::move(ins), policy);
+  }
+
+  __bdd
+  bdd_apply(const generator<bdd>& fs, const predicate<bool, bool>& op)
+  {
+    return bdd_apply(exec_policy(), fs, op);
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   __bdd
   bdd_and(const exec_policy& ep, const bdd& f, const bdd& g)
   {
     apply_prod2b_policy<internal::and_op> policy;
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -169,11 +287,27 @@ namespace adiar
     return bdd_and(exec_policy(), f, g);
   }
 
+  __bdd
+  bdd_and(const exec_policy& ep, const generator<bdd>& fs)
+  {
+    std::vector<bdd> ins = __bdd_collect(fs);
+    if (ins.empty()) { return bdd_top(); }
+
+    const apply_prod2b_policy<internal::and_op> policy;
+    return internal::prodn(ep, std::move(ins), policy);
+  }
+
+  __bdd
+  bdd_and(const generator<bdd>& fs)
+  {
+    return bdd_and(exec_policy(), fs);
+  }
+
   __bdd
   bdd_nand(const exec_policy& ep, const bdd& f, const bdd& g)
   {
     apply_prod2b_policy<internal::nand_op> policy;
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -186,7 +320,7 @@ namespace adiar
   bdd_or(const exec_policy& ep, const bdd& f, const bdd& g)
   {
     apply_prod2b_policy<internal::or_op> policy;
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -195,11 +329,27 @@ namespace adiar
     return bdd_or(exec_policy(), f, g);
   }
 
+  __bdd
+  bdd_or(const exec_policy& ep, const generator<bdd>& fs)
+  {
+    std::vector<bdd> ins = __bdd_collect(fs);
+    if (ins.empty()) { return bdd_bot(); }
+
+    const apply_prod2b_policy<internal::or_op> policy;
+    return internal::prodn(ep, std::move(ins), policy);
+  }
+
+  __bdd
+  bdd_or(const generator<bdd>& fs)
+  {
+    return bdd_or(exec_policy(), fs);
+  }
+
   __bdd
   bdd_nor(const exec_policy& ep, const bdd& f, const bdd& g)
   {
     apply_prod2b_policy<internal::nor_op> policy;
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -212,7 +362,7 @@ namespace adiar
   bdd_xor(const exec_policy& ep, const bdd& f, const bdd& g)
   {
     apply_prod2b_policy<internal::xor_op> policy;
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -225,7 +375,7 @@ namespace adiar
   bdd_xnor(const exec_policy& ep, const bdd& f, const bdd& g)
   {
     apply_prod2b_policy<internal::xnor_op> policy;
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -262,7 +412,7 @@ namespace adiar
   bdd_equiv(const exec_policy& ep, const bdd& f, const bdd& g)
   {
     apply_prod2b_policy<internal::equiv_op> policy;
-    return internal::prod2b(ep, f, g, policy);
+    return __bdd_apply(ep, f, g, policy);
   }
 
   __bdd
@@ -71,6 +71,23 @@ namespace adiar
     return bdd(std::move(lhs)) op rhs;                 \
   }
 
+  // Binary operators on unreduced BDDs, which may be piped (see `exec_policy::chain`).
+#define __BDD_APPLY_OPER(op, op_pred)                          \
+  __bdd operator op(__bdd&& lhs, __bdd&& rhs)                  \
+  {                                                            \
+    return bdd_apply(std::move(lhs), std::move(rhs), op_pred); \
+  }                                                            \
+                                                               \
+  __bdd operator op(const bdd& lhs, __bdd&& rhs)               \
+  {                                                            \
+    return bdd_apply(lhs, std::move(rhs), op_pred);            \
+  }                                                            \
+                                                               \
+  __bdd operator op(__bdd&& lhs, const bdd& rhs)               \
+  {                                                            \
+    return bdd_apply(std::move(lhs), rhs, op_pred);            \
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   // Operators (Assignment)
 
@@ -130,7 +147,7 @@ namespace adiar
     return ~bdd(std::move(in));
   }
 
-  __BDD_OPER(__bdd, &);
+  __BDD_APPLY_OPER(&, and_op);
 
   __bdd
   operator&(const bdd& lhs, const bdd& rhs)
@@ -152,7 +169,7 @@ namespace adiar
     return (*this = std::move(temp));
   }
 
-  __BDD_OPER(__bdd, |);
+  __BDD_APPLY_OPER(|, or_op);
 
   __bdd
   operator|(const bdd& lhs, const bdd& rhs)
@@ -174,7 +191,7 @@ namespace adiar
     return (*this = std::move(temp));
   }
 
-  __BDD_OPER(__bdd, ^);
+  __BDD_APPLY_OPER(^, xor_op);
 
   __bdd
   operator^(const bdd& lhs, const bdd& rhs)
@@ -199,7 +216,7 @@ namespace adiar
   //////////////////////////////////////////////////////////////////////////////
   // Operators (Set/Arithmetic)
 
-  __BDD_OPER(__bdd, +);
+  __BDD_APPLY_OPER(+, or_op);
 
   bdd
   operator+(const bdd& f)
@@ -233,7 +250,7 @@ namespace adiar
     return (*this = std::move(temp));
   }
 
-  __BDD_OPER(__bdd, -);
+  __BDD_APPLY_OPER(-, diff_op);
 
   bdd
   operator-(const bdd& f)
@@ -267,7 +284,7 @@ namespace adiar
     return (*this = std::move(temp));
   }
 
-  __BDD_OPER(__bdd, *);
+  __BDD_APPLY_OPER(*, and_op);
 
   __bdd
   operator*(const bdd& lhs, const bdd& rhs)
@@ -1,11 +1,14 @@
 #include <adiar/bdd.h>
+#include <adiar/bdd/bdd_policy.h>
 #include <adiar/exec_policy.h>
 #include <adiar/statistics.h>
 
+#include <adiar/internal/algorithms/small.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
+#include <adiar/internal/data_structures/result_cache.h>
 #include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/data_types/request.h>
 #include <adiar/internal/data_types/tuple.h>
@@ -24,7 +27,7 @@ namespace adiar
 {
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Struct to hold statistics
-  statistics::prod3_t stats_prod3;
+  thread_local internal::thread_statistics<&statistics::prod3> stats_prod3;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Data structures
@@ -489,37 +492,10 @@ namespace adiar
   }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief If-Then-Else for the cases that cannot be reduced to a (simpler) Apply.
   __bdd
-  bdd_ite(const exec_policy& ep, const bdd& f, const bdd& g, const bdd& h)
+  __bdd_ite_sweep(const exec_policy& ep, const bdd& f, const bdd& g, const bdd& h)
   {
-    // ---------------------------------------------------------------------------------------------
-    // There are multiple cases, where this boils down to an Apply rather than an If-Then-Else. The
-    // bdd_apply uses tuples rather than triples and only two priority queues, so it will run
-    // considerably faster.
-    //
-    // The translations into Apply can be found in Figure 1 of "Efficient Implementation of a BDD
-    // Package" of Karl S. Brace, Richard L. Rudell, and Randal E. Bryant.
-
-    // Resolve being given the same underlying file in both cases
-    if (g.file_ptr() == h.file_ptr() && g.shift() == h.shift()) {
-      return g.is_negated() == h.is_negated() ? __bdd(g) : bdd_xnor(f, g);
-    }
-
-    // Resolve being given the same underlying file for conditional and a case
-    if (f.file_ptr() == g.file_ptr() && f.shift() == g.shift()) {
-      return f.is_negated() == g.is_negated() ? bdd_or(f, h) : bdd_less(f, h);
-    }
-    if (f.file_ptr() == h.file_ptr() && f.shift() == h.shift()) {
-      return f.is_negated() == h.is_negated() ? bdd_and(f, g) : bdd_imp(f, g);
-    }
-
-    // Resolve being given a terminal conditional
-    if (bdd_isterminal(f)) { return dd_valueof(f) ? g : h; }
-
-    // Resolve being given a terminal in one of the cases
-    if (bdd_isterminal(g)) { return dd_valueof(g) ? bdd_or(f, h) : bdd_less(f, h); }
-    if (bdd_isterminal(h)) { return dd_valueof(h) ? bdd_imp(f, g) : bdd_and(f, g); }
-
     // ---------------------------------------------------------------------------------------------
     // If the levels of 'then' and 'else' are disjoint and the 'if' BDD is above the two others,
     // then we can merely zip the 'then' and 'else' BDDs. This is only O((N1+N2+N3)/B) I/Os!
@@ -635,6 +611,29 @@ namespace adiar
                                                                           pq_3_internal_memory,
                                                                           max_pq_3_size);
 
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod3.lpq.adaptive += 1u;
+#endif
+      using PriorityQueue_1 =
+        ite_priority_queue_1_t<ADIAR_LPQ_LOOKAHEAD, internal::memory_mode::Adaptive>;
+      using PriorityQueue_2 = ite_priority_queue_2_t<internal::memory_mode::Adaptive>;
+      using PriorityQueue_3 = ite_priority_queue_3_t<internal::memory_mode::Adaptive>;
+
+      const size_t pq_1_memory = aux_available_memory / 3;
+      const size_t pq_2_memory = pq_1_memory;
+      const size_t pq_3_memory = pq_1_memory;
+
+      return __bdd_ite<PriorityQueue_1, PriorityQueue_2, PriorityQueue_3>(ep,
+                                                                          f,
+                                                                          g,
+                                                                          h,
+                                                                          pq_1_memory,
+                                                                          max_pq_1_size,
+                                                                          pq_2_memory,
+                                                                          max_pq_2_size,
+                                                                          pq_3_memory,
+                                                                          max_pq_3_size);
     } else {
 #ifdef ADIAR_STATS
       stats_prod3.lpq.external += 1u;
@@ -661,6 +660,53 @@ namespace adiar
     }
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  __bdd
+  bdd_ite(const exec_policy& ep, const bdd& f, const bdd& g, const bdd& h)
+  {
+    // ---------------------------------------------------------------------------------------------
+    // There are multiple cases, where this boils down to an Apply rather than an If-Then-Else. The
+    // bdd_apply uses tuples rather than triples and only two priority queues, so it will run
+    // considerably faster.
+    //
+    // The translations into Apply can be found in Figure 1 of "Efficient Implementation of a BDD
+    // Package" of Karl S. Brace, Richard L. Rudell, and Randal E. Bryant.
+
+    // Resolve being given the same underlying file in both cases
+    if (g.file_ptr() == h.file_ptr() && g.shift() == h.shift()) {
+      return g.is_negated() == h.is_negated() ? __bdd(g) : bdd_xnor(f, g);
+    }
+
+    // Resolve being given the same underlying file for conditional and a case
+    if (f.file_ptr() == g.file_ptr() && f.shift() == g.shift()) {
+      return f.is_negated() == g.is_negated() ? bdd_or(f, h) : bdd_less(f, h);
+    }
+    if (f.file_ptr() == h.file_ptr() && f.shift() == h.shift()) {
+      return f.is_negated() == h.is_negated() ? bdd_and(f, g) : bdd_imp(f, g);
+    }
+
+    // Resolve being given a terminal conditional
+    if (bdd_isterminal(f)) { return dd_valueof(f) ? g : h; }
+
+    // Resolve being given a terminal in one of the cases
+    if (bdd_isterminal(g)) { return dd_valueof(g) ? bdd_or(f, h) : bdd_less(f, h); }
+    if (bdd_isterminal(h)) { return dd_valueof(h) ? bdd_imp(f, g) : bdd_and(f, g); }
+
+    // ---------------------------------------------------------------------------------------------
+    // Otherwise, we have to do an actual sweep through all three BDDs (unless done so before).
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Ite,
+      0u,
+      std::array<const internal::dd*, 3>{ &f, &g, &h },
+      [&ep, &f, &g, &h]() -> __bdd {
+        const auto small_res = internal::small_ite(ep, f, g, h);
+        if (small_res) { return small_res.value(); }
+
+        return __bdd_ite_sweep(ep, f, g, h);
+      });
+  }
+
   __bdd
   bdd_ite(const bdd& f, const bdd& g, const bdd& h)
   {
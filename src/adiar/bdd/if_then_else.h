@@ -1,11 +1,13 @@
 #ifndef ADIAR_BDD_IF_THEN_ELSE_H
 #define ADIAR_BDD_IF_THEN_ELSE_H
 
+#include <adiar/internal/statistics.h>
+
 namespace adiar
 {
   //////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::prod3_t stats_prod3;
+  extern thread_local internal::thread_statistics<&statistics::prod3> stats_prod3;
 }
 
 #endif // ADIAR_BDD_IF_THEN_ELSE_H
\ No newline at end of file
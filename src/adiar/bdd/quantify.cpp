@@ -4,7 +4,9 @@
 #include <adiar/bdd/bdd_policy.h>
 
 #include <adiar/internal/algorithms/quantify.h>
+#include <adiar/internal/algorithms/small.h>
 #include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/result_cache.h>
 #include <adiar/internal/data_types/arc.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/data_types/tuple.h>
@@ -76,13 +78,48 @@ namespace adiar
 
   public:
     static constexpr bool quantify_onset = true;
+
+    static constexpr bool idempotent = true;
   };
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Quantification in internal memory if `f` is small enough (see
+  ///        `exec_policy::small_threshold`).
+  template <bool ShortcuttingValue>
+  optional<bdd::shared_node_file_type>
+  __bdd_small_quantify(const exec_policy& ep,
+                       const bdd& f,
+                       const predicate<bdd::label_type>& vars)
+  {
+    // Existential quantification combines both children with 'or' and universal quantification
+    // with 'and'.
+    constexpr uint64_t truth_table = ShortcuttingValue ? 0b1110u : 0b1000u;
+    return internal::small_quantify(ep, f, vars, truth_table);
+  }
+
+  template <bool ShortcuttingValue>
+  optional<bdd::shared_node_file_type>
+  __bdd_small_quantify(const exec_policy& ep, const bdd& f, const bdd::label_type var)
+  {
+    return __bdd_small_quantify<ShortcuttingValue>(
+      ep, f, [var](const bdd::label_type x) { return x == var; });
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   __bdd
   bdd_exists(const exec_policy& ep, const bdd& f, bdd::label_type var)
   {
-    return internal::quantify<bdd_quantify_policy<true>>(ep, f, var);
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Exists,
+      var,
+      std::array<const internal::dd*, 1>{ &f },
+      [&ep, &f, var]() -> __bdd {
+        const auto small_res = __bdd_small_quantify<true>(ep, f, var);
+        if (small_res) { return small_res.value(); }
+
+        return internal::quantify<bdd_quantify_policy<true>>(ep, f, var);
+      });
   }
 
   __bdd
@@ -98,6 +135,9 @@ namespace adiar
   __bdd
   bdd_exists(const exec_policy& ep, const bdd& f, const predicate<bdd::label_type>& vars)
   {
+    const auto small_res = __bdd_small_quantify<true>(ep, f, vars);
+    if (small_res) { return small_res.value(); }
+
     return internal::quantify<bdd_quantify_policy<true>>(ep, f, vars);
   }
 
@@ -110,6 +150,9 @@ namespace adiar
   __bdd
   bdd_exists(const exec_policy& ep, bdd&& f, const predicate<bdd::label_type>& vars)
   {
+    const auto small_res = __bdd_small_quantify<true>(ep, f, vars);
+    if (small_res) { return small_res.value(); }
+
     return internal::quantify<bdd_quantify_policy<true>>(ep, std::move(f), vars);
   }
 
@@ -172,7 +215,17 @@ namespace adiar
   __bdd
   bdd_forall(const exec_policy& ep, const bdd& f, bdd::label_type var)
   {
-    return internal::quantify<bdd_quantify_policy<false>>(ep, f, var);
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Forall,
+      var,
+      std::array<const internal::dd*, 1>{ &f },
+      [&ep, &f, var]() -> __bdd {
+        const auto small_res = __bdd_small_quantify<false>(ep, f, var);
+        if (small_res) { return small_res.value(); }
+
+        return internal::quantify<bdd_quantify_policy<false>>(ep, f, var);
+      });
   }
 
   __bdd
@@ -188,6 +241,9 @@ namespace adiar
   __bdd
   bdd_forall(const exec_policy& ep, const bdd& f, const predicate<bdd::label_type>& vars)
   {
+    const auto small_res = __bdd_small_quantify<false>(ep, f, vars);
+    if (small_res) { return small_res.value(); }
+
     return internal::quantify<bdd_quantify_policy<false>>(ep, f, vars);
   }
 
@@ -200,6 +256,9 @@ namespace adiar
   __bdd
   bdd_forall(const exec_policy& ep, bdd&& f, const predicate<bdd::label_type>& vars)
   {
+    const auto small_res = __bdd_small_quantify<false>(ep, f, vars);
+    if (small_res) { return small_res.value(); }
+
     return internal::quantify<bdd_quantify_policy<false>>(ep, std::move(f), vars);
   }
 
@@ -1,3 +1,5 @@
+#include <limits>
+
 #include <adiar/bdd.h>
 #include <adiar/bdd/bdd_policy.h>
 #include <adiar/types.h>
@@ -7,6 +9,7 @@
 #include <adiar/internal/algorithms/quantify.h>
 #include <adiar/internal/algorithms/replace.h>
 #include <adiar/internal/bool_op.h>
+#include <adiar/internal/data_structures/result_cache.h>
 
 namespace adiar
 {
@@ -249,6 +252,8 @@ namespace adiar
 
   public:
     static constexpr bool quantify_onset = true;
+
+    static constexpr bool idempotent = true;
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -309,11 +314,14 @@ namespace adiar
       adiar_unreachable();
       // LCOV_EXCL_STOP
 
-    case replace_type::Non_Monotone:
-#ifdef ADIAR_STATS
-      internal::stats_replace.nested_sweeps += 1u;
-#endif
-      throw invalid_argument("Non-monotonic variable replacement not (yet) supported.");
+    case replace_type::Non_Monotone: {
+      // Quantify and replace separately, since levels have to be swapped.
+      const bdd tmp_2 =
+        bdd_exists(ep, std::move(tmp_1), [&m](bdd::label_type x) { return !m(x).has_value(); });
+
+      return bdd_replace(
+        ep, tmp_2, [&m](bdd::label_type x) { return m(x).value(); }, replace_type::Non_Monotone);
+    }
 
     case replace_type::Monotone:
     case replace_type::Shift:
@@ -339,6 +347,10 @@ namespace adiar
     return bdd_relnext(exec_policy(), states, relation, m, m_type);
   }
 
+  /// \brief Result cache argument for the interleaved variable ordering (which is not a valid
+  ///        variable count).
+  constexpr uint64_t __relprod_interleaved = std::numeric_limits<uint64_t>::max();
+
   bdd
   bdd_relnext(const exec_policy& ep,
               const bdd& states,
@@ -348,7 +360,12 @@ namespace adiar
     const auto map = [=](const bdd::label_type x) -> adiar::optional<int> {
       return x < varcount ? adiar::make_optional<int>() : adiar::make_optional<int>(x - varcount);
     };
-    return bdd_relnext(ep, states, relation, map, replace_type::Shift);
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Relnext,
+      varcount,
+      std::array<const internal::dd*, 2>{ &states, &relation },
+      [&]() { return bdd_relnext(ep, states, relation, map, replace_type::Shift); });
   }
 
   bdd
@@ -363,7 +380,12 @@ namespace adiar
     const auto map = [](const bdd::label_type x) -> adiar::optional<int> {
       return (x % 2) == 0 ? adiar::make_optional<int>() : adiar::make_optional<int>(x - 1);
     };
-    return bdd_relnext(ep, states, relation, map, replace_type::Shift);
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Relnext,
+      __relprod_interleaved,
+      std::array<const internal::dd*, 2>{ &states, &relation },
+      [&]() { return bdd_relnext(ep, states, relation, map, replace_type::Shift); });
   }
 
   bdd
@@ -409,7 +431,12 @@ namespace adiar
     const auto map = [=](const bdd::label_type x) -> adiar::optional<int> {
       return varcount <= x ? adiar::make_optional<int>() : adiar::make_optional<int>(x + varcount);
     };
-    return bdd_relprev(ep, states, relation, map, replace_type::Shift);
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Relprev,
+      varcount,
+      std::array<const internal::dd*, 2>{ &states, &relation },
+      [&]() { return bdd_relprev(ep, states, relation, map, replace_type::Shift); });
   }
 
   bdd
@@ -424,7 +451,12 @@ namespace adiar
     const auto map = [](const bdd::label_type x) -> adiar::optional<int> {
       return (x % 2) == 1 ? adiar::make_optional<int>() : adiar::make_optional<int>(x + 1);
     };
-    return bdd_relprev(ep, states, relation, map, replace_type::Shift);
+    return internal::result_cache_or<bdd_policy>(
+      ep,
+      internal::result_cache::operation::Relprev,
+      __relprod_interleaved,
+      std::array<const internal::dd*, 2>{ &states, &relation },
+      [&]() { return bdd_relprev(ep, states, relation, map, replace_type::Shift); });
   }
 
   bdd
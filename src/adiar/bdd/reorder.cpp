@@ -0,0 +1,34 @@
+#include <vector>
+
+#include <adiar/bdd.h>
+#include <adiar/bdd/bdd_policy.h>
+#include <adiar/types.h>
+
+#include <adiar/internal/algorithms/reorder.h>
+
+namespace adiar
+{
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const exec_policy& ep, const bdd& f, reorder_type r_type, size_t size_bound)
+  {
+    return internal::reorder<bdd_policy>(ep, f, r_type, size_bound);
+  }
+
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const bdd& f, reorder_type r_type, size_t size_bound)
+  {
+    return bdd_reorder(exec_policy(), f, r_type, size_bound);
+  }
+
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const exec_policy& ep, const bdd& f, reorder_type r_type)
+  {
+    return bdd_reorder(ep, f, r_type, 2u * f.size());
+  }
+
+  pair<bdd, std::vector<bdd::label_type>>
+  bdd_reorder(const bdd& f, reorder_type r_type)
+  {
+    return bdd_reorder(exec_policy(), f, r_type);
+  }
+}
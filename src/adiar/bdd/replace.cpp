@@ -7,13 +7,38 @@
 
 namespace adiar
 {
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class bdd_replace_policy : public bdd_policy
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move the variable `x` to the level `y` and relabel all other variables with the
+    ///        monotone map `m`, i.e. compute `ite(x_y, f[x/1][m], f[x/0][m])`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static bdd
+    jump(const exec_policy& ep,
+         const bdd& f,
+         const bdd::label_type x,
+         const bdd::label_type y,
+         const function<bdd::label_type(bdd::label_type)>& m)
+    {
+      const bdd f_low  = bdd_restrict(ep, f, x, false);
+      const bdd f_high = bdd_restrict(ep, f, x, true);
+
+      return bdd_ite(ep,
+                     bdd_ithvar(y),
+                     internal::replace<bdd_replace_policy>(ep, f_high, m, replace_type::Monotone),
+                     internal::replace<bdd_replace_policy>(ep, f_low, m, replace_type::Monotone));
+    }
+  };
+
   __bdd
   bdd_replace(const exec_policy& ep,
               const bdd& f,
               const function<bdd::label_type(bdd::label_type)>& m,
               replace_type m_type)
   {
-    return internal::replace<bdd_policy>(ep, f, m, m_type);
+    return internal::replace<bdd_replace_policy>(ep, f, m, m_type);
   }
 
   __bdd
@@ -30,12 +55,12 @@ namespace adiar
               const function<bdd::label_type(bdd::label_type)>& m,
               replace_type m_type)
   {
-    return internal::replace<bdd_policy>(ep, std::move(f), m, m_type);
+    return internal::replace<bdd_replace_policy>(ep, std::move(f), m, m_type);
   }
 
   __bdd
   bdd_replace(__bdd&& f, const function<bdd::label_type(bdd::label_type)>& m, replace_type m_type)
   {
-    return internal::replace<bdd_policy>(std::move(f), m, m_type);
+    return internal::replace<bdd_replace_policy>(std::move(f), m, m_type);
   }
 }
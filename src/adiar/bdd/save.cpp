@@ -0,0 +1,18 @@
+#include <adiar/bdd.h>
+
+#include <adiar/internal/dd_func.h>
+
+namespace adiar
+{
+  void
+  bdd_save(const bdd& f, const std::string& path)
+  {
+    internal::dd_save<bdd>(f, path);
+  }
+
+  bdd
+  bdd_load(const std::string& path)
+  {
+    return internal::dd_load<bdd>(path);
+  }
+}
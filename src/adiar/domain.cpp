@@ -1,5 +1,7 @@
 #include "domain.h"
 
+#include <mutex>
+
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/io/ofstream.h>
 
@@ -10,6 +12,17 @@ namespace adiar
 
   shared_ptr<internal::file<domain_var>> domain_ptr;
 
+  // The domain is shared between all threads. Hence, all accesses to `domain_ptr` are guarded.
+  std::mutex domain_mutex;
+
+  // Obtain a copy of `domain_ptr`, such that it is not changed while it is being used.
+  inline shared_ptr<internal::file<domain_var>>
+  __domain_ptr()
+  {
+    const std::lock_guard<std::mutex> lock(domain_mutex);
+    return domain_ptr;
+  }
+
   void
   domain_set(const domain_var varcount)
   {
@@ -38,32 +51,35 @@ namespace adiar
   void
   domain_set(const internal::shared_file<domain_var>& dom)
   {
+    const std::lock_guard<std::mutex> lock(domain_mutex);
     domain_ptr = dom;
   }
 
   void
   domain_unset()
   {
+    const std::lock_guard<std::mutex> lock(domain_mutex);
     domain_ptr.reset();
   }
 
   bool
   domain_isset()
   {
-    return domain_ptr ? true : false;
+    return __domain_ptr() ? true : false;
   }
 
   internal::shared_file<domain_var>
   domain_get()
   {
-    if (!domain_isset()) { throw domain_error("Domain must be set before it can be used"); }
-
-    return domain_ptr;
+    const shared_ptr<internal::file<domain_var>> dom = __domain_ptr();
+    if (!dom) { throw domain_error("Domain must be set before it can be used"); }
+    return dom;
   }
 
   domain_var
   domain_size()
   {
-    return domain_isset() ? domain_get()->size() : 0u;
+    const shared_ptr<internal::file<domain_var>> dom = __domain_ptr();
+    return dom ? dom->size() : 0u;
   }
 }
@@ -8,6 +8,10 @@
 ///
 /// Some operations relate to the entire variable domain. Instead of passing this around explicitly,
 /// you may set it once and then Adiar will take care of using it when needed.
+///
+/// \remark The domain is shared between all threads. It is safe to set and read the domain
+///         concurrently, but an operation running on one thread may still use the domain from
+///         before another thread changed it.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <adiar/exception.h>
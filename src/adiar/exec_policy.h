@@ -2,6 +2,7 @@
 #define ADIAR_EXEC_POLICY_H
 
 #include <algorithm>
+#include <cstdint>
 #include <limits>
 
 #include <adiar/type_traits.h>
@@ -69,6 +70,9 @@ namespace adiar
     ///          auxiliary data structures can be optimised for internal memory, and so have a high
     ///          performance on very small instances, or they can be designed for external memory
     ///          such that they can handle decision diagrams much larger than the available memory.
+    ///          If the predicted size does not fit, then `Auto` still starts out in internal memory
+    ///          and only moves its data structures to external memory once they actually outgrow
+    ///          it.
     ///
     /// \note    For more details, please read "Predicting Memory Demands of BDD Operations using
     ///          Maximum Graph Cuts" ATVA 2023.
@@ -77,7 +81,8 @@ namespace adiar
     ////////////////////////////////////////////////////////////////////////////////////////////////
     enum class memory : char
     {
-      /** Pick \em internal memory as long as it is safe to do so. */
+      /** Pick \em internal memory as long as it is safe to do so and spill over to \em external
+          memory otherwise. */
       Auto,
       /** Always use \em internal memory */
       Internal,
@@ -112,6 +117,183 @@ namespace adiar
       };
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Whether the unreduced result of an operation should be reduced before being used as
+    ///          the input of a subsequent operation or piped into it as-is.
+    ///
+    /// \details Each top-down algorithm outputs an unreduced diagram, i.e. an `__bdd`, which is
+    ///          then reduced with a bottom-up sweep. If this `__bdd` is only an intermediate result
+    ///          of a longer chain of operations, e.g. `(f & g) | h`, then the next top-down sweep
+    ///          can instead directly read the levels of the unreduced diagram. This skips the
+    ///          bottom-up sweep and the temporary files of the intermediate reduced diagram.
+    ///
+    /// \remark  The unreduced diagram may be larger than its reduced counterpart and it can only be
+    ///          processed with priority queues. Hence, this is only beneficial if the intermediate
+    ///          result is not much reduced.
+    ///
+    /// \see bdd_apply
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class chain : char
+    {
+      /** Always reduce an intermediate result. */
+      Reduce,
+      /** Pipe an unreduced intermediate result directly into the next operation. */
+      Pipe
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Number of threads Adiar may use to overlap I/O and sorting with the computation of a
+    ///          single operation.
+    ///
+    /// \details With more than one thread, the inputs of the Reduce, Product Construction, and
+    ///          Count algorithms are read ahead in the background. Similarly, the outputs of the
+    ///          Reduce and Product Construction algorithms are written behind. The top-down sweeps
+    ///          and the Reduce also sort the requests for their next level in the background.
+    ///          Meanwhile, the Reduce groups the terminal arcs of its next levels. Independent of
+    ///          the number of threads used, the resulting decision diagram is the same.
+    ///
+    /// \remark  The requests of a level are still resolved one at a time by the calling thread, i.e.
+    ///          the sweeps themselves are not split across threads. Hence, this only pays off if the
+    ///          operation is bound by its I/O rather than by the computation.
+    ///
+    /// \remark  The helper threads are charged to the memory of the calling thread (see
+    ///          `adiar_thread_init`).
+    ///
+    /// \see bdd_apply zdd_binop
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    class threads
+    {
+    public:
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Type of the number of threads.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      using value_type = unsigned char;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Use as many threads as there are hardware threads available.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      static constexpr value_type Auto = 0u;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Only use the calling thread (default).
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      static constexpr value_type Sequential = 1u;
+
+    private:
+      value_type _value = Sequential;
+
+    public:
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Default construction with only a single thread.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr threads() = default;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Construction with a specific number of threads (or `Auto`).
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr explicit threads(const value_type n)
+        : _value(n)
+      {}
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief The requested number of threads (`Auto` if not fixed).
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr value_type
+      value() const
+      {
+        return this->_value;
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Check for equality of settings.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr bool
+      operator==(const threads& t) const
+      {
+        return this->_value == t._value;
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Check for inequality of settings.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr bool
+      operator!=(const threads& t) const
+      {
+        return !(*this == t);
+      }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Maximum size of decision diagrams for which Adiar may use a conventional in-memory
+    ///          algorithm, i.e. depth-first recursion with a unique table.
+    ///
+    /// \details Adiar's algorithms are designed for large decision diagrams. For very small ones,
+    ///          the overhead of setting up temporary files, priority queues, and sorters dominates
+    ///          the running time. If all inputs of an operation have at most this many nodes and
+    ///          a 2-level cut of at most this size, then the operation is instead computed in
+    ///          internal memory and the result is written as a canonical (i.e. reduced) diagram.
+    ///          If the result turns out to be much larger than this threshold, then the in-memory
+    ///          computation is aborted and Adiar's usual algorithm is used instead.
+    ///
+    /// \see bdd_apply bdd_ite bdd_exists bdd_forall
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    class small_threshold
+    {
+    public:
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Type of the threshold.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      using value_type = uint32_t;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Never use the in-memory algorithms (default).
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      static constexpr value_type Off = 0u;
+
+    private:
+      value_type _value = Off;
+
+    public:
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Default construction with the in-memory algorithms turned off.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr small_threshold() = default;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Construction with a specific maximum number of nodes (or `Off`).
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr explicit small_threshold(const value_type n)
+        : _value(n)
+      {}
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief The maximum number of nodes (`Off` if turned off).
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr value_type
+      value() const
+      {
+        return this->_value;
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Check for equality of settings.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr bool
+      operator==(const small_threshold& t) const
+      {
+        return this->_value == t._value;
+      }
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Check for inequality of settings.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      constexpr bool
+      operator!=(const small_threshold& t) const
+      {
+        return !(*this == t);
+      }
+    };
+
   private:
     // TODO: Merge all enums into a single 64 bit integer to safe on space?
 
@@ -130,6 +312,21 @@ namespace adiar
     ////////////////////////////////////////////////////////////////////////////////////////////////
     quantify::algorithm _quantify__algorithm = quantify::Nested;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of `threads` (default `Sequential`).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    threads _threads = threads();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief How to `chain` operations (default `Reduce`).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    chain _chain = chain::Reduce;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Threshold for `small_threshold` in-memory algorithms (default `Off`).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    small_threshold _small_threshold = small_threshold();
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Default constructor with all options set to their default value.
@@ -167,6 +364,27 @@ namespace adiar
       : _quantify__algorithm(qa)
     {}
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from `threads`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy(const threads& t)
+      : _threads(t)
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from `chain` enum.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy(const chain& c)
+      : _chain(c)
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Conversion construction from `small_threshold`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy(const small_threshold& st)
+      : _small_threshold(st)
+    {}
+
     // TODO: constructor with defaults for a specific 'version number'?
 
   public:
@@ -199,7 +417,8 @@ namespace adiar
     {
       // Order based from the most generic to the most specific setting.
       return this->_memory == ep._memory && this->_access == ep._access
-        && this->_quantify__algorithm == ep._quantify__algorithm;
+        && this->_quantify__algorithm == ep._quantify__algorithm && this->_threads == ep._threads
+        && this->_chain == ep._chain && this->_small_threshold == ep._small_threshold;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,6 +490,66 @@ namespace adiar
       exec_policy ep = *this;
       return ep.set(qa);
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the number of threads.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy&
+    set(const threads& t)
+    {
+      this->_threads = t;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the number of threads changed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy
+    operator&(const threads& t) const
+    {
+      exec_policy ep = *this;
+      return ep.set(t);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Set how to chain operations.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy&
+    set(const chain& c)
+    {
+      this->_chain = c;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with how to chain operations changed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy
+    operator&(const chain& c) const
+    {
+      exec_policy ep = *this;
+      return ep.set(c);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the threshold for in-memory algorithms.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy&
+    set(const small_threshold& st)
+    {
+      this->_small_threshold = st;
+      return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Create a copy with the threshold for in-memory algorithms changed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    exec_policy
+    operator&(const small_threshold& st) const
+    {
+      exec_policy ep = *this;
+      return ep.set(st);
+    }
   };
 
   ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,6 +582,36 @@ namespace adiar
     return this->_quantify__algorithm;
   }
 
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Chosen number of threads.
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  template <>
+  inline const exec_policy::threads&
+  exec_policy::get<exec_policy::threads>() const
+  {
+    return this->_threads;
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Chosen way to chain operations.
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  template <>
+  inline const exec_policy::chain&
+  exec_policy::get<exec_policy::chain>() const
+  {
+    return this->_chain;
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Chosen threshold for in-memory algorithms.
+  ////////////////////////////////////////////////////////////////////////////////////////////////
+  template <>
+  inline const exec_policy::small_threshold&
+  exec_policy::get<exec_policy::small_threshold>() const
+  {
+    return this->_small_threshold;
+  }
+
   /// \}
   //////////////////////////////////////////////////////////////////////////////////////////////////
 
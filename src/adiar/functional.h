@@ -173,10 +173,11 @@ namespace adiar
   /// \brief Wrap a `begin` and `end` iterator pair into a generator function.
   ////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename ForwardIt>
-  inline generator<typename std::remove_reference_t<ForwardIt>::value_type>
+  inline generator<typename std::iterator_traits<std::remove_reference_t<ForwardIt>>::value_type>
   make_generator(ForwardIt&& begin, ForwardIt&& end)
   {
-    using value_type = typename std::remove_reference_t<ForwardIt>::value_type;
+    using value_type =
+      typename std::iterator_traits<std::remove_reference_t<ForwardIt>>::value_type;
 
     return [_begin = std::forward<ForwardIt>(begin),
             _end   = std::forward<ForwardIt>(end)]() mutable -> optional<value_type> {
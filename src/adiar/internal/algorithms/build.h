@@ -15,24 +15,40 @@
 namespace adiar::internal
 {
   //////////////////////////////////////////////////////////////////////////////
-  /// \brief Builder for a terminal value
+  /// \brief Builder for the terminal a pointer points to, e.g. a numeric one.
   //////////////////////////////////////////////////////////////////////////////
   template <typename DdPolicy>
   inline shared_levelized_file<typename DdPolicy::node_type>
-  build_terminal(bool value)
+  build_terminal(const typename DdPolicy::pointer_type& terminal)
   {
+    adiar_assert(terminal.is_terminal());
+
     using node_type = typename DdPolicy::node_type;
     shared_levelized_file<node_type> nf;
     {
+      const bool value = terminal.value();
+
       node_ofstream nw(nf);
-      nw.unsafe_push(node_type(value));
-      nw.unsafe_set_number_of_terminals(!value, value);
+      nw.unsafe_push(node_type(typename node_type::uid_type(terminal),
+                               node_type::pointer_type::nil(),
+                               node_type::pointer_type::nil()));
+      nw.unsafe_set_number_of_terminals(!value, value, 1u < terminal.numeric_value());
       nw.unsafe_set_canonical(true);
     }
 
     return nf;
   }
 
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Builder for a terminal value
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename DdPolicy>
+  inline shared_levelized_file<typename DdPolicy::node_type>
+  build_terminal(bool value)
+  {
+    return build_terminal<DdPolicy>(typename DdPolicy::pointer_type(value));
+  }
+
   //////////////////////////////////////////////////////////////////////////////
   /// \brief Builder for a single-node with children (`false`, `true`).
   //////////////////////////////////////////////////////////////////////////////
@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::count_t stats_count;
+  thread_local thread_statistics<&statistics::count> stats_count;
 }
@@ -11,6 +11,7 @@
 #include <adiar/internal/data_types/uid.h>
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
@@ -26,7 +27,7 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::count_t stats_count;
+  extern thread_local thread_statistics<&statistics::count> stats_count;
 
   //////////////////////////////////////////////////////////////////////////////
   // Data structures
@@ -111,10 +112,12 @@ namespace adiar::internal
 
   template <typename Policy, typename PriorityQueue>
   uint64_t
-  __count(const typename Policy::dd_type& dd,
+  __count(const exec_policy& ep,
+          const typename Policy::dd_type& dd,
           const typename Policy::label_type varcount,
           const size_t pq_max_memory,
-          const size_t pq_max_size)
+          const size_t pq_max_size,
+          const size_t read_ahead)
   {
     adiar_assert(!dd->is_terminal(), "Count Algorithm does not support terminal case");
 
@@ -123,9 +126,10 @@ namespace adiar::internal
 
     // Set up input
     node_ifstream<> ns(dd);
+    ns.read_ahead(read_ahead);
 
     // Set up cross-level priority queue with a request for the root
-    PriorityQueue count_pq({ dd }, pq_max_memory, pq_max_size, stats_count.lpq);
+    PriorityQueue count_pq({ dd }, pq_max_memory, pq_max_size, stats_count.lpq, ep);
     {
       const node root = ns.peek();
 
@@ -175,8 +179,12 @@ namespace adiar::internal
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
+    //
+    // With more than one thread, the nodes are read ahead by another one.
+    const size_t read_ahead = read_ahead_blocks(ep, memory_available() / 8u);
 
-    const size_t aux_available_memory = memory_available() - node_ifstream<>::memory_usage();
+    const size_t aux_available_memory =
+      memory_available() - node_ifstream<>::memory_usage(read_ahead);
 
     const size_t pq_memory_fits =
       count_priority_queue_t<typename Policy::data_type,
@@ -198,7 +206,7 @@ namespace adiar::internal
 #endif
       return __count<Policy,
                      count_priority_queue_t<typename Policy::data_type, 0, memory_mode::Internal>>(
-        dd, varcount, aux_available_memory, max_pq_size);
+        ep, dd, varcount, aux_available_memory, max_pq_size, read_ahead);
     } else if (!external_only && max_pq_size <= pq_memory_fits) {
 #ifdef ADIAR_STATS
       stats_count.lpq.internal += 1u;
@@ -207,7 +215,16 @@ namespace adiar::internal
                      count_priority_queue_t<typename Policy::data_type,
                                             ADIAR_LPQ_LOOKAHEAD,
                                             memory_mode::Internal>>(
-        dd, varcount, aux_available_memory, max_pq_size);
+        ep, dd, varcount, aux_available_memory, max_pq_size, read_ahead);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_count.lpq.adaptive += 1u;
+#endif
+      return __count<Policy,
+                     count_priority_queue_t<typename Policy::data_type,
+                                            ADIAR_LPQ_LOOKAHEAD,
+                                            memory_mode::Adaptive>>(
+        ep, dd, varcount, aux_available_memory, max_pq_size, read_ahead);
     } else {
 #ifdef ADIAR_STATS
       stats_count.lpq.external += 1u;
@@ -216,7 +233,7 @@ namespace adiar::internal
                      count_priority_queue_t<typename Policy::data_type,
                                             ADIAR_LPQ_LOOKAHEAD,
                                             memory_mode::External>>(
-        dd, varcount, aux_available_memory, max_pq_size);
+        ep, dd, varcount, aux_available_memory, max_pq_size, read_ahead);
     }
   }
 }
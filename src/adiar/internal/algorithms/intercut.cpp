@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::intercut_t stats_intercut;
+  thread_local thread_statistics<&statistics::intercut> stats_intercut;
 }
@@ -18,6 +18,7 @@
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/ifstream.h>
 #include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
@@ -40,7 +41,7 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::intercut_t stats_intercut;
+  extern thread_local thread_statistics<&statistics::intercut> stats_intercut;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Priority queue
@@ -156,12 +157,12 @@ namespace adiar::internal
     node_ifstream<> in_nodes(dd);
     node n = in_nodes.pull();
 
-    // Copy the labels into a B-sized vector. This way, we can read it twice: once for the levels in
-    // the priority queue and secondly for a lookahead of where to cut next.
+    // Copy the labels into a vector. This way, we can read it twice: once for the levels in the
+    // priority queue and secondly for a lookahead of where to cut next.
     //
     // Alternatively, we could also hack it by wrapping `xs` with a side-effect of updating a
     // variable in this scope. But, the resulting code complexity does not seem worth it.
-    internal_vector<typename Policy::label_type> hit_levels(dd::max_label);
+    internal_vector<typename Policy::label_type> hit_levels;
     for (auto x = xs(); x; x = xs()) { hit_levels.push_back(x.value()); }
 
     typename internal_vector<typename Policy::label_type>::iterator ls = hit_levels.begin();
@@ -178,7 +179,8 @@ namespace adiar::internal
     PriorityQueue intercut_pq({ dd, make_generator(hit_levels.begin(), hit_levels.end()) },
                               pq_memory,
                               max_pq_size,
-                              stats_intercut.lpq);
+                              stats_intercut.lpq,
+                              ep);
     intercut_pq.push(intercut_request({ n.uid() }, {}, { ptr_uint64::nil(), *ls }));
 
     // Process nodes of the decision diagram in topological order
@@ -315,6 +317,13 @@ namespace adiar::internal
       return __intercut<Policy,
                         intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
         ep, dd, xs, pq_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_intercut.lpq.adaptive += 1u;
+#endif
+      return __intercut<Policy,
+                        intercut_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>>(
+        ep, dd, xs, pq_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_intercut.lpq.external += 1u;
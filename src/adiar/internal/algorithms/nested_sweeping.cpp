@@ -4,6 +4,6 @@ namespace adiar::internal
 {
   namespace nested_sweeping
   {
-    statistics::nested_sweeping_t stats;
+    thread_local thread_statistics<&statistics::nested_sweeping> stats;
   }
 }
@@ -3,8 +3,8 @@
 
 #include <adiar/exec_policy.h>
 #include <adiar/functional.h>
-#include <adiar/statistics.h>
 
+#include <adiar/internal/algorithms/build.h>
 #include <adiar/internal/algorithms/reduce.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
@@ -15,6 +15,7 @@
 #include <adiar/internal/io/iofstream.h>
 #include <adiar/internal/io/node_raccess.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/statistics.h>
 #include <adiar/internal/util.h>
 
 namespace adiar::internal
@@ -26,7 +27,7 @@ namespace adiar::internal
   {
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// Struct to hold statistics
-    extern statistics::nested_sweeping_t stats;
+    extern thread_local thread_statistics<&statistics::nested_sweeping> stats;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief   A faster alternative to `__reduce_level`.
@@ -1486,7 +1487,16 @@ namespace adiar::internal
           } else {
             const size_t unreduced_width = inner_level_info.width();
 
-            if (unreduced_width <= internal_sorter_can_fit) {
+            if (reduce_rule2__hashing::memory_usage(unreduced_width) <= inner_sorters_memory) {
+              __reduce_level__rule2<Policy, reduce_rule2__hashing>(decorated_arcs,
+                                                                   level,
+                                                                   level,
+                                                                   decorated_pq,
+                                                                   outer_ofstream,
+                                                                   inner_sorters_memory,
+                                                                   unreduced_width,
+                                                                   stats.inner_up);
+            } else if (unreduced_width <= internal_sorter_can_fit) {
               __reduce_level<Policy, internal_sorter>(decorated_arcs,
                                                       level,
                                                       decorated_pq,
@@ -1840,8 +1850,10 @@ namespace adiar::internal
 
           const node n = node_of(e_low, e_high);
 
-          // Apply Reduction rule 1?
-          const node::pointer_type reduction_rule_ret = Policy::reduction_rule(n);
+          // Apply Reduction rule 1? This is only possible, if combining a node's child with itself
+          // results in said child.
+          const node::pointer_type reduction_rule_ret =
+            Policy::idempotent ? Policy::reduction_rule(n) : n.uid();
           if (reduction_rule_ret != n.uid()) {
             // If so, preserve child in inner sweep
             if (!outer_levels.can_pull()) {
@@ -1849,7 +1861,7 @@ namespace adiar::internal
                            "Should not have any parents at top-most level");
 
               if (reduction_rule_ret.is_terminal()) {
-                return reduced_t(reduction_rule_ret.value());
+                return reduced_t(build_terminal<Policy>(essential(reduction_rule_ret)));
               }
 #ifdef ADIAR_STATS
               nested_sweeping::stats.inner_down.removed_by_rule_1 += 1u;
@@ -1876,7 +1888,9 @@ namespace adiar::internal
               adiar_assert(r.targets() > 0, "Requests are always to something");
               non_gc_request |= r.targets() > 1;
 
-              if (r.target.first().is_terminal()) { return reduced_t(r.target.first().value()); }
+              if (r.target.first().is_terminal()) {
+                return reduced_t(build_terminal<Policy>(essential(r.target.first())));
+              }
               outer_pq_decorator.push(r);
             } else {
               do {
@@ -2096,7 +2110,7 @@ namespace adiar::internal
 
     // Otherwise obtain the semi-transposed DAG (construct it if necessary)
     const shared_arc_file_type dag = input.template has<shared_arc_file_type>()
-      ? input.template get<shared_arc_file_type>()
+      ? transposed(input.template get<shared_arc_file_type>())
       : transpose(reduced_t(input.template get<shared_node_file_type>(), input._negate));
 
     // Compute amount of memory available for auxiliary data structures after having opened all
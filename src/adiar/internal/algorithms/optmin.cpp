@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::optmin_t stats_optmin;
+  thread_local thread_statistics<&statistics::optmin> stats_optmin;
 }
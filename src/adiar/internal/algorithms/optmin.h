@@ -25,6 +25,7 @@
 #include <adiar/internal/io/arc_file.h>
 #include <adiar/internal/io/arc_ofstream.h>
 #include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
@@ -40,7 +41,7 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::optmin_t stats_optmin;
+  extern thread_local thread_statistics<&statistics::optmin> stats_optmin;
 
   //////////////////////////////////////////////////////////////////////////////
   // Data structures
@@ -232,6 +233,12 @@ namespace adiar::internal
 #endif
       return __optmin<Policy, optmin_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
         policy, dd, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_optmin.lpq.adaptive += 1u;
+#endif
+      return __optmin<Policy, optmin_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>>(
+        policy, dd, aux_available_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_optmin.lpq.external += 1u;
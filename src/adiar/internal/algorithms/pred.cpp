@@ -8,7 +8,7 @@
 
 namespace adiar::internal
 {
-  statistics::equality_t stats_equality;
+  thread_local thread_statistics<&statistics::equality> stats_equality;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Slow O(sort(N)) I/Os comparison by traversing the product construction and comparing each
@@ -99,7 +99,8 @@ namespace adiar::internal
     static bool
     resolve_terminals(const dd::node_type& v1, const dd::node_type& v2, bool& ret_value)
     {
-      ret_value = v1.is_terminal() && v2.is_terminal() && v1.value() == v2.value();
+      ret_value =
+        v1.is_terminal() && v2.is_terminal() && v1.numeric_value() == v2.numeric_value();
 #ifdef ADIAR_STATS
       stats_equality.slow_check.exit_on_root += 1u;
 #endif
@@ -124,7 +125,8 @@ namespace adiar::internal
     {
       // Are they both a terminal (and the same terminal)?
       if (rp[0].is_terminal() || rp[1].is_terminal()) {
-        if (rp[0].is_terminal() && rp[1].is_terminal() && rp[0].value() == rp[1].value()) {
+        if (rp[0].is_terminal() && rp[1].is_terminal()
+            && rp[0].numeric_value() == rp[1].numeric_value()) {
           return false;
         } else {
 #ifdef ADIAR_STATS
@@ -228,6 +230,17 @@ namespace adiar::internal
       return false;
     }
 
+    // Are they trivially not the same, since the structure of their canonical form differs? This
+    // only applies if both or neither are negated: negating a diagram may change the order of its
+    // nodes, i.e. the negation of a canonical diagram is not necessarily canonical.
+    if (a_negated == b_negated && a->is_canonical() && b->is_canonical()
+        && a.fingerprint() != b.fingerprint()) {
+#ifdef ADIAR_STATS
+      stats_equality.exit_on_fingerprint += 1u;
+#endif
+      return false;
+    }
+
     // Are they trivially not the same, since they have different number of levels?
     if (a->levels() != b->levels()) {
 #ifdef ADIAR_STATS
@@ -11,12 +11,13 @@
 #include <adiar/internal/dd.h>
 #include <adiar/internal/io/levelized_file.h>
 #include <adiar/internal/io/levelized_ifstream.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics for equality checking
-  extern statistics::equality_t stats_equality;
+  extern thread_local thread_statistics<&statistics::equality> stats_equality;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Computes whether two decision diagrams are isomorphic; i.e. whether they are equivalent
@@ -249,6 +250,19 @@ namespace adiar::internal
 
       return __comparison_check<Policy, priority_queue_1_type, priority_queue_2_type>(
         in_0, in_1, pq_1_internal_memory, pq_2_internal_memory, max_pq_1_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_equality.lpq.adaptive += 1u;
+#endif
+      using priority_queue_1_type =
+        comparison_priority_queue_1_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>;
+      using priority_queue_2_type = comparison_priority_queue_2_t<memory_mode::Adaptive>;
+
+      const size_t pq_1_memory = aux_available_memory / 2;
+      const size_t pq_2_memory = pq_1_memory;
+
+      return __comparison_check<Policy, priority_queue_1_type, priority_queue_2_type>(
+        in_0, in_1, pq_1_memory, pq_2_memory, max_pq_1_size);
     } else {
 #ifdef ADIAR_STATS
       stats_equality.lpq.external += 1u;
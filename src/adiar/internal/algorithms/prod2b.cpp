@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::prod2b_t stats_prod2b;
+  thread_local thread_statistics<&statistics::prod2b> stats_prod2b;
 }
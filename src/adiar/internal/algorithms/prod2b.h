@@ -1,6 +1,7 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_PROD2B_H
 #define ADIAR_INTERNAL_ALGORITHMS_PROD2B_H
 
+#include <type_traits>
 #include <variant>
 
 #include <adiar/exec_policy.h>
@@ -12,6 +13,8 @@
 #include <adiar/internal/cnl.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
+#include <adiar/internal/data_structures/priority_queue.h>
+#include <adiar/internal/data_structures/radix_priority_queue.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/data_types/request.h>
 #include <adiar/internal/data_types/tuple.h>
@@ -20,9 +23,11 @@
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/io/arc_file.h>
 #include <adiar/internal/io/arc_ofstream.h>
+#include <adiar/internal/io/narc_ifstream.h>
 #include <adiar/internal/io/node_ifstream.h>
 #include <adiar/internal/io/node_raccess.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/statistics.h>
 #include <adiar/internal/util.h>
 
 namespace adiar::internal
@@ -42,7 +47,7 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::prod2b_t stats_prod2b;
+  extern thread_local thread_statistics<&statistics::prod2b> stats_prod2b;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Data structures
@@ -57,6 +62,20 @@ namespace adiar::internal
                                                               2,
                                                               0>;
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Overflow queue for the requests to the first target. In internal memory, the requests'
+  ///        integer key allows for a radix heap rather than a binary heap.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <memory_mode mem_mode>
+  using prod_overflow_queue_1_t =
+    std::conditional_t<mem_mode == memory_mode::Internal,
+                       radix_priority_queue<prod2b_request<0>,
+                                            request_data_first_lt<prod2b_request<0>>,
+                                            request_first_key<prod2b_request<0>>>,
+                       priority_queue<mem_mode,
+                                      prod2b_request<0>,
+                                      request_data_first_lt<prod2b_request<0>>>>;
+
   template <size_t look_ahead, memory_mode mem_mode>
   using prod_priority_queue_1_t =
     levelized_node_priority_queue<prod2b_request<0>,
@@ -64,12 +83,21 @@ namespace adiar::internal
                                   look_ahead,
                                   mem_mode,
                                   2,
-                                  0>;
+                                  0,
+                                  prod_overflow_queue_1_t<mem_mode>>;
 
   template <memory_mode mem_mode>
   using prod_priority_queue_2_t =
     priority_queue<mem_mode, prod2b_request<1>, request_data_second_lt<prod2b_request<1>>>;
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Stream of nodes for an input, i.e. reading the nodes of a reduced diagram or the ones
+  ///        of an unreduced diagram that is piped in (see `exec_policy::chain`).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Input>
+  using prod2b_ifstream_t =
+    std::conditional_t<std::is_base_of_v<dd, Input>, node_ifstream<>, narc_ifstream<>>;
+
   // TODO: turn into 'tuple<tuple<node::pointer_type>>'
   struct prod2b_rec_output
   {
@@ -188,6 +216,25 @@ namespace adiar::internal
     }
   };
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Wrap up the (unreduced) output of the product construction.
+  ///
+  /// \details If the result is to be piped into the next operation (see `exec_policy::chain`), then
+  ///          its nodes are read by the source of their arcs rather than by their target. Since no
+  ///          one else has access to the file yet, its internal arcs are sorted in-place once and
+  ///          for all.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  inline typename Policy::__dd_type
+  __prod2b_output(const exec_policy& ep, arc_ofstream& aw, shared_levelized_file<arc>& out_arcs)
+  {
+    if (ep.template get<exec_policy::chain>() == exec_policy::chain::Pipe) {
+      aw.close();
+      untranspose(*out_arcs);
+    }
+    return typename Policy::__dd_type(out_arcs, ep);
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Construct a terminal for the result of two pointers.
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -195,7 +242,7 @@ namespace adiar::internal
   inline shared_levelized_file<node>
   __prod2b_terminal(const tuple<typename Policy::pointer_type>& rp, const Policy& policy)
   {
-    return build_terminal<Policy>(policy(rp[0], rp[1]).value());
+    return build_terminal<Policy>(policy(rp[0], rp[1]));
   }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -281,7 +328,9 @@ namespace adiar::internal
               const typename Policy::dd_type& in_ra,
               Policy& policy,
               const size_t pq_memory,
-              const size_t max_pq_size)
+              const size_t max_pq_size,
+              const size_t read_ahead,
+              const size_t write_behind)
   {
     constexpr size_t pq_idx = 0;
     constexpr size_t ra_idx = 1;
@@ -289,15 +338,18 @@ namespace adiar::internal
     // Set up output
     shared_levelized_file<arc> out_arcs;
     arc_ofstream aw(out_arcs);
+    aw.write_behind(write_behind);
 
     // Set up input
     node_ifstream<> in_nodes_pq(in_pq);
+    in_nodes_pq.read_ahead(read_ahead);
+
     node_raccess in_nodes_ra(in_ra);
 
     node v_pq = in_nodes_pq.pull();
 
     // Set up cross-level priority queue
-    PriorityQueue_1 prod_pq({ in_pq, in_ra }, pq_memory, max_pq_size, stats_prod2b.lpq);
+    PriorityQueue_1 prod_pq({ in_pq, in_ra }, pq_memory, max_pq_size, stats_prod2b.lpq, ep);
     prod_pq.push({ { v_pq.uid(), in_nodes_ra.root() }, {}, { ptr_uint64::nil() } });
     // TODO: Allow using 'Policy::no_skip' when pushing; the ptr_uint64::nil() above breaks this!
 
@@ -390,39 +442,49 @@ namespace adiar::internal
                                           - out_arcs->number_of_terminals[true],
                                         out_arcs->max_1level_cut);
 
-    return typename Policy::__dd_type(out_arcs, ep);
+    return __prod2b_output<Policy>(ep, aw, out_arcs);
   }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief 2-ary Product Construction where nodes are potentially forwarded with a secondary
   ///        priority queue such that they are accessible at the same time.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename Policy, typename PriorityQueue_1, typename PriorityQueue_2>
+  template <typename Policy,
+            typename PriorityQueue_1,
+            typename PriorityQueue_2,
+            typename In_0,
+            typename In_1>
   typename Policy::__dd_type
   __prod2b_pq(const exec_policy& ep,
-              const typename Policy::dd_type& in_0,
-              const typename Policy::dd_type& in_1,
+              const In_0& in_0,
+              const In_1& in_1,
               Policy& policy,
               const size_t pq_1_memory,
               const size_t max_pq_1_size,
               const size_t pq_2_memory,
-              const size_t max_pq_2_size)
+              const size_t max_pq_2_size,
+              const size_t read_ahead,
+              const size_t write_behind)
   {
     // Set up output
     shared_levelized_file<arc> out_arcs;
     arc_ofstream aw(out_arcs);
+    aw.write_behind(write_behind);
 
     out_arcs->max_1level_cut = 0;
 
     // Set up input
-    node_ifstream<> in_nodes_0(in_0);
-    node_ifstream<> in_nodes_1(in_1);
+    prod2b_ifstream_t<In_0> in_nodes_0(in_0);
+    in_nodes_0.read_ahead(read_ahead);
+
+    prod2b_ifstream_t<In_1> in_nodes_1(in_1);
+    in_nodes_1.read_ahead(read_ahead);
 
     node v0 = in_nodes_0.pull();
     node v1 = in_nodes_1.pull();
 
     // Set up cross-level priority queue
-    PriorityQueue_1 prod_pq_1({ in_0, in_1 }, pq_1_memory, max_pq_1_size, stats_prod2b.lpq);
+    PriorityQueue_1 prod_pq_1({ in_0, in_1 }, pq_1_memory, max_pq_1_size, stats_prod2b.lpq, ep);
     prod_pq_1.push({ { v0.uid(), v1.uid() }, {}, { ptr_uint64::nil() } });
     // TODO: Allow using 'Policy::no_skip' when pushing; the ptr_uint64::nil() above breaks this!
 
@@ -539,17 +601,17 @@ namespace adiar::internal
                                           - out_arcs->number_of_terminals[true],
                                         out_arcs->max_1level_cut);
 
-    return typename Policy::__dd_type(out_arcs, ep);
+    return __prod2b_output<Policy>(ep, aw, out_arcs);
   }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Derives an upper bound on the output's maximum i-level cut based on the product of the maximum
   /// i-level cut of both inputs.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename cut, size_t const_size_inc, typename Policy>
+  template <typename cut, size_t const_size_inc, typename Policy, typename In_0, typename In_1>
   size_t
-  __prod2b_ilevel_upper_bound(const typename Policy::dd_type& in_0,
-                              const typename Policy::dd_type& in_1,
+  __prod2b_ilevel_upper_bound(const In_0& in_0,
+                              const In_1& in_1,
                               const Policy& policy)
   {
     // Cuts for left-hand side
@@ -569,14 +631,29 @@ namespace adiar::internal
                    + left_cut_internal * right_cut_terminals + const_size_inc);
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// Upper bound on the number of distinct terminal values of an input included in the cut type.
+  /// With numeric terminals, this is not bounded by the cut type but by its number of arcs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename In>
+  safe_size_t
+  __prod2b_terminal_values(const In& in, const cut& ct)
+  {
+    if constexpr (Policy::numeric_terminals) {
+      return safe_size_t(in.size()) * 2u;
+    } else {
+      return ct.number_of_terminals();
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Derives an upper bound on the output's maximum 2-level cut based on both using the max 1 and
   /// 2-level cuts and the number of relevant terminals.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename Policy>
+  template <typename Policy, typename In_0, typename In_1>
   size_t
-  __prod2b_2level_upper_bound(const typename Policy::dd_type& in_0,
-                              const typename Policy::dd_type& in_1,
+  __prod2b_2level_upper_bound(const In_0& in_0,
+                              const In_1& in_1,
                               const Policy& policy)
   {
     // Left-hand side
@@ -584,7 +661,7 @@ namespace adiar::internal
     const safe_size_t left_1level_cut = in_0.max_1level_cut(cut::Internal);
 
     const cut left_ct                    = policy.left_cut();
-    const safe_size_t left_terminal_vals = left_ct.number_of_terminals();
+    const safe_size_t left_terminal_vals = __prod2b_terminal_values<Policy>(in_0, left_ct);
 
     const safe_size_t left_terminal_arcs = in_0.max_1level_cut(left_ct) - left_1level_cut;
 
@@ -593,7 +670,7 @@ namespace adiar::internal
     const safe_size_t right_1level_cut = in_1.max_1level_cut(cut::Internal);
 
     const cut right_ct                    = policy.right_cut();
-    const safe_size_t right_terminal_vals = right_ct.number_of_terminals();
+    const safe_size_t right_terminal_vals = __prod2b_terminal_values<Policy>(in_1, right_ct);
 
     const safe_size_t right_terminal_arcs = in_1.max_1level_cut(right_ct) - right_1level_cut;
 
@@ -607,19 +684,19 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Upper bound on i-level cut based on the maximum possible number of nodes in the output.
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename Policy>
+  template <typename Policy, typename In_0, typename In_1>
   size_t
-  __prod2b_ilevel_upper_bound(const typename Policy::dd_type& in_0,
-                              const typename Policy::dd_type& in_1,
+  __prod2b_ilevel_upper_bound(const In_0& in_0,
+                              const In_1& in_1,
                               const Policy& policy)
   {
     const cut left_ct                    = policy.left_cut();
-    const safe_size_t left_terminal_vals = left_ct.number_of_terminals();
-    const safe_size_t left_size          = in_0->size();
+    const safe_size_t left_terminal_vals = __prod2b_terminal_values<Policy>(in_0, left_ct);
+    const safe_size_t left_size          = in_0.size();
 
     const cut right_ct                    = policy.right_cut();
-    const safe_size_t right_terminal_vals = right_ct.number_of_terminals();
-    const safe_size_t right_size          = in_1->size();
+    const safe_size_t right_terminal_vals = __prod2b_terminal_values<Policy>(in_1, right_ct);
+    const safe_size_t right_size          = in_1.size();
 
     return to_size((left_size + left_terminal_vals) * (right_size + right_terminal_vals) + 1u + 2u);
   }
@@ -664,13 +741,20 @@ namespace adiar::internal
     stats_prod2b.ra.max_width = std::max(stats_prod2b.ra.max_width, in_ra.width());
 #endif
 
+    // Blocks of the input stream read ahead in the background (if threads are available).
+    const size_t read_ahead = read_ahead_blocks(ep, memory_available() / 8u);
+
+    // Similarly, full blocks of the output are written to disk in the background.
+    const size_t write_behind =
+      write_behind_blocks(ep, memory_available() / 8u, file_traits<arc>::files);
+
     const size_t pq_available_memory = memory_available()
       // Input stream
-      - node_ifstream<>::memory_usage()
+      - node_ifstream<>::memory_usage(read_ahead)
       // Random access
       - node_raccess::memory_usage(in_ra)
       // Output stream
-      - arc_ofstream::memory_usage();
+      - arc_ofstream::memory_usage(write_behind);
 
     const size_t pq_memory_fits =
       prod_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(
@@ -683,28 +767,31 @@ namespace adiar::internal
       stats_prod2b.lpq.unbucketed += 1u;
 #endif
       return __prod2b_ra<Policy, prod_priority_queue_t<0, memory_mode::Internal>>(
-        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size);
+        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size, read_ahead, write_behind);
     } else if (!external_only && max_pq_size <= pq_memory_fits) {
 #ifdef ADIAR_STATS
       stats_prod2b.lpq.internal += 1u;
 #endif
       return __prod2b_ra<Policy, prod_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
-        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size);
+        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size, read_ahead, write_behind);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.adaptive += 1u;
+#endif
+      return __prod2b_ra<Policy, prod_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>>(
+        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size, read_ahead, write_behind);
     } else {
 #ifdef ADIAR_STATS
       stats_prod2b.lpq.external += 1u;
 #endif
       return __prod2b_ra<Policy, prod_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>(
-        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size);
+        ep, in_pq, in_ra, policy, pq_available_memory, max_pq_size, read_ahead, write_behind);
     }
   }
 
-  template <typename Policy>
+  template <typename Policy, typename In_0, typename In_1>
   typename Policy::__dd_type
-  __prod2b_pq(const exec_policy& ep,
-              const typename Policy::dd_type& in_0,
-              const typename Policy::dd_type& in_1,
-              Policy& policy)
+  __prod2b_pq(const exec_policy& ep, const In_0& in_0, const In_1& in_1, Policy& policy)
   {
     const bool internal_only =
       ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
@@ -716,6 +803,16 @@ namespace adiar::internal
                  __prod2b_2level_upper_bound(in_0, in_1, policy),
                  __prod2b_ilevel_upper_bound(in_0, in_1, policy) });
 
+    // Set aside (at most) another eighth of the memory for reading ahead the input streams.
+    const size_t read_ahead =
+      read_ahead_blocks(ep,
+                        memory_available() / 8u,
+                        prod2b_ifstream_t<In_0>::streams + prod2b_ifstream_t<In_1>::streams);
+
+    // ... and yet another eighth for writing the output stream behind.
+    const size_t write_behind =
+      write_behind_blocks(ep, memory_available() / 8u, file_traits<arc>::files);
+
     // Compute amount of memory available for auxiliary data structures after having opened all
     // streams.
     //
@@ -723,9 +820,10 @@ namespace adiar::internal
     // we can run them with a faster internal memory variant.
     const size_t aux_available_memory = memory_available()
       // Input streams
-      - 2 * node_ifstream<>::memory_usage()
+      - prod2b_ifstream_t<In_0>::memory_usage(read_ahead)
+      - prod2b_ifstream_t<In_1>::memory_usage(read_ahead)
       // Output stream
-      - arc_ofstream::memory_usage();
+      - arc_ofstream::memory_usage(write_behind);
 
     constexpr size_t data_structures_in_pq_1 =
       prod_priority_queue_1_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::data_structures;
@@ -768,7 +866,9 @@ namespace adiar::internal
                                                        pq_1_internal_memory,
                                                        max_pq_1_size,
                                                        pq_2_internal_memory,
-                                                       max_pq_2_size);
+                                                       max_pq_2_size,
+                                                       read_ahead,
+                                                       write_behind);
     } else if (!external_only && max_pq_1_size <= pq_1_memory_fits
                && max_pq_2_size <= pq_2_memory_fits) {
 #ifdef ADIAR_STATS
@@ -784,7 +884,29 @@ namespace adiar::internal
                                                        pq_1_internal_memory,
                                                        max_pq_1_size,
                                                        pq_2_internal_memory,
-                                                       max_pq_2_size);
+                                                       max_pq_2_size,
+                                                       read_ahead,
+                                                       write_behind);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2b.lpq.adaptive += 1u;
+#endif
+      using pq_1_type = prod_priority_queue_1_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>;
+      const size_t pq_1_memory = aux_available_memory / 2;
+
+      using pq_2_type          = prod_priority_queue_2_t<memory_mode::Adaptive>;
+      const size_t pq_2_memory = pq_1_memory;
+
+      return __prod2b_pq<Policy, pq_1_type, pq_2_type>(ep,
+                                                       in_0,
+                                                       in_1,
+                                                       policy,
+                                                       pq_1_memory,
+                                                       max_pq_1_size,
+                                                       pq_2_memory,
+                                                       max_pq_2_size,
+                                                       read_ahead,
+                                                       write_behind);
     } else {
 #ifdef ADIAR_STATS
       stats_prod2b.lpq.external += 1u;
@@ -795,8 +917,16 @@ namespace adiar::internal
       using pq_2_type          = prod_priority_queue_2_t<memory_mode::External>;
       const size_t pq_2_memory = pq_1_memory;
 
-      return __prod2b_pq<Policy, pq_1_type, pq_2_type>(
-        ep, in_0, in_1, policy, pq_1_memory, max_pq_1_size, pq_2_memory, max_pq_2_size);
+      return __prod2b_pq<Policy, pq_1_type, pq_2_type>(ep,
+                                                       in_0,
+                                                       in_1,
+                                                       policy,
+                                                       pq_1_memory,
+                                                       max_pq_1_size,
+                                                       pq_2_memory,
+                                                       max_pq_2_size,
+                                                       read_ahead,
+                                                       write_behind);
     }
   }
 
@@ -876,6 +1006,81 @@ namespace adiar::internal
 #endif
     return __prod2b_pq<Policy>(ep, in_0, in_1, policy);
   }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether an unreduced input may be piped into the product construction, i.e. be read
+  ///        without running the Reduce algorithm first.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline bool
+  __prod2b_can_pipe(const exec_policy& ep, const __dd& in)
+  {
+    const bool requested = ep.template get<exec_policy::chain>() == exec_policy::chain::Pipe
+      || in._policy.template get<exec_policy::chain>() == exec_policy::chain::Pipe;
+
+    if (!requested || !in.template has<__dd::shared_arc_file_type>()) { return false; }
+
+    // The internal arcs must be sorted on their source. Unless its producer already did so, this
+    // can only be done if no one else reads from the file.
+    const __dd::shared_arc_file_type& file = in.template get<__dd::shared_arc_file_type>();
+    return !file->semi_transposed || file.use_count() == 1;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief  2-ary Product Construction algorithm on possibly unreduced inputs.
+  ///
+  /// \details Unreduced inputs that are to be piped (see `exec_policy::chain`) are read level by
+  ///          level directly from their arc file. This skips the bottom-up Reduce sweep in-between
+  ///          two top-down sweeps. All other inputs are reduced as usual.
+  ///
+  /// \return A class that inherits from `__dd` and describes the product the two given DAGs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  typename Policy::__dd_type
+  prod2b(const exec_policy& ep,
+         typename Policy::__dd_type&& in_0,
+         typename Policy::__dd_type&& in_1,
+         Policy& policy)
+  {
+    using dd_type = typename Policy::dd_type;
+
+    const bool pipe_0 = __prod2b_can_pipe(ep, in_0);
+    const bool pipe_1 = __prod2b_can_pipe(ep, in_1);
+
+    // ---------------------------------------------------------------------------------------------
+    // Case: Nothing to pipe.
+    if (!pipe_0 && !pipe_1) {
+      return prod2b(ep, dd_type(std::move(in_0)), dd_type(std::move(in_1)), policy);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Case: Both are piped.
+    if (pipe_0 && pipe_1) {
+#ifdef ADIAR_STATS
+      stats_prod2b.pq.runs += 1u;
+      stats_prod2b.piped_inputs += 2u;
+#endif
+      return __prod2b_pq<Policy>(ep, in_0, in_1, policy);
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Case: Only one is piped.
+    //
+    //   If the other one collapses to a terminal, then it is much cheaper to use the terminal
+    //   shortcuts of the policy. Yet, these require both inputs to be reduced.
+    const dd_type other = pipe_0 ? dd_type(std::move(in_1)) : dd_type(std::move(in_0));
+
+    if (dd_isterminal(other)) {
+      return pipe_0 ? prod2b(ep, dd_type(std::move(in_0)), other, policy)
+                    : prod2b(ep, other, dd_type(std::move(in_1)), policy);
+    }
+
+#ifdef ADIAR_STATS
+    stats_prod2b.pq.runs += 1u;
+    stats_prod2b.piped_inputs += 1u;
+#endif
+    return pipe_0 ? __prod2b_pq<Policy>(ep, in_0, other, policy)
+                  : __prod2b_pq<Policy>(ep, other, in_1, policy);
+  }
 }
 
 #endif // ADIAR_INTERNAL_ALGORITHMS_PROD2B_H
@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::prod2u_t stats_prod2u;
+  thread_local thread_statistics<&statistics::prod2u> stats_prod2u;
 }
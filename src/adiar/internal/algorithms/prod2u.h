@@ -3,6 +3,7 @@
 
 #include <adiar/functional.h>
 
+#include <adiar/internal/algorithms/build.h>
 #include <adiar/internal/algorithms/nested_sweeping.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
@@ -12,6 +13,7 @@
 #include <adiar/internal/io/node_ifstream.h>
 #include <adiar/internal/io/node_raccess.h>
 #include <adiar/internal/io/shared_file_ptr.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
@@ -36,7 +38,7 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::prod2u_t stats_prod2u;
+  extern thread_local thread_statistics<&statistics::prod2u> stats_prod2u;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -232,8 +234,8 @@ namespace adiar::internal
   {
     using tuple_t = tuple<typename Policy::pointer_type, 2, true>;
 
-    // Collapse to a single value, if `t1` and `t2` are equal
-    if (t1 == t2) { return tuple_t(t1, Policy::pointer_type::nil()); }
+    // Collapse to a single value, if `t1` and `t2` are equal (and the operator is idempotent)
+    if (Policy::idempotent && t1 == t2) { return tuple_t(t1, Policy::pointer_type::nil()); }
 
     // Sort the two values
     const tuple_t ts = t1 < t2 ? tuple_t(t1, t2) : tuple_t(t2, t1);
@@ -318,7 +320,7 @@ namespace adiar::internal
             adiar_assert(rec_all[1] == Policy::pointer_type::nil(),
                          "Operator should already be applied");
 
-            return typename Policy::dd_type(rec_all[0].value());
+            return typename Policy::dd_type(build_terminal<Policy>(rec_all[0]));
           }
 
           prod2u_request<0>::target_t rec(rec_all[0], rec_all[1]);
@@ -472,7 +474,7 @@ namespace adiar::internal
             adiar_assert(rec_all[1] == Policy::pointer_type::nil(),
                          "Operator should already be applied");
 
-            return typename Policy::dd_type(rec_all[0].value());
+            return typename Policy::dd_type(build_terminal<Policy>(rec_all[0]));
           }
 
           prod2u_request<0>::target_t rec(rec_all[0], rec_all[1]);
@@ -542,7 +544,7 @@ namespace adiar::internal
     NodeRandomAccess in_nodes(in);
 
     // Set up cross-level priority queue with a request for the root
-    PriorityQueue pq({ in }, pq_memory, max_pq_size, stats_prod2u.lpq);
+    PriorityQueue pq({ in }, pq_memory, max_pq_size, stats_prod2u.lpq, ep);
     pq.push({ { in_nodes.root(), ptr_uint64::nil() }, {}, { ptr_uint64::nil() } });
 
     return __prod2u_ra(ep, in_nodes, policy, pq);
@@ -596,6 +598,13 @@ namespace adiar::internal
 #endif
       using PriorityQueue = PriorityQueueTemplate<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>;
 
+      return __prod2u_ra<NodeRandomAccess, PriorityQueue>(ep, in, policy, pq_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prod2u.lpq.adaptive += 1u;
+#endif
+      using PriorityQueue = PriorityQueueTemplate<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>;
+
       return __prod2u_ra<NodeRandomAccess, PriorityQueue>(ep, in, policy, pq_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
@@ -633,7 +642,7 @@ namespace adiar::internal
     }
 
     // Set up cross-level priority queue
-    PriorityQueue_1 pq_1({ in }, pq_1_memory, max_pq_1_size, stats_prod2u.lpq);
+    PriorityQueue_1 pq_1({ in }, pq_1_memory, max_pq_1_size, stats_prod2u.lpq, ep);
     pq_1.push({ { root, ptr_uint64::nil() }, {}, { ptr_uint64::nil() } });
 
     // Set up per-level priority queue
@@ -0,0 +1,6 @@
+#include "prodn.h"
+
+namespace adiar::internal
+{
+  thread_local thread_statistics<&statistics::prodn> stats_prodn;
+}
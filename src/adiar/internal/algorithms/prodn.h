@@ -0,0 +1,549 @@
+#ifndef ADIAR_INTERNAL_ALGORITHMS_PRODN_H
+#define ADIAR_INTERNAL_ALGORITHMS_PRODN_H
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <adiar/exec_policy.h>
+
+#include <adiar/internal/algorithms/prod2b.h>
+#include <adiar/internal/assert.h>
+#include <adiar/internal/cnl.h>
+#include <adiar/internal/data_structures/levelized_priority_queue.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/data_types/request.h>
+#include <adiar/internal/data_types/tuple.h>
+#include <adiar/internal/data_types/uid.h>
+#include <adiar/internal/dd.h>
+#include <adiar/internal/dd_func.h>
+#include <adiar/internal/io/arc_file.h>
+#include <adiar/internal/io/arc_ofstream.h>
+#include <adiar/internal/io/node_raccess.h>
+#include <adiar/internal/memory.h>
+#include <adiar/internal/statistics.h>
+#include <adiar/internal/util.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  //  N-ary Product Construction
+  // ============================
+  //
+  // Given n Decision Diagrams construct the product of all of them with respect to a binary
+  // operator, i.e. the left fold `((f_0 op f_1) op f_2) ...`.
+  /*
+  //      (a)       (b)       (c)                     ___(a,b,c)___
+  //     /   \  X  /   \  X  /   \      =>           /             \
+  //    a0   a1   b0   b1   c0   c1            (a0,b0,c0)       (a1,b1,c1)
+  */
+  // Up to `prodn_max_arity` diagrams are combined within a single top-down sweep. More diagrams are
+  // combined in a balanced tree of such sweeps (or a left-deep one if the operator is not
+  // associative), where each intermediate result is reduced before it is used again.
+  //
+  // Examples of uses are `bdd_and`, `bdd_or`, and `bdd_apply` on a range of BDDs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// Struct to hold statistics
+  extern thread_local thread_statistics<&statistics::prodn> stats_prodn;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Maximum number of diagrams combined within a single sweep.
+  ///
+  /// \details This is bounded by the largest cardinality supported by `tuple`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  constexpr size_t prodn_max_arity = 4u;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Data structures
+  template <uint8_t Arity>
+  using prodn_request = request_data<Arity, with_parent>;
+
+  template <uint8_t Arity, size_t look_ahead, memory_mode mem_mode>
+  using prodn_priority_queue_t =
+    levelized_node_priority_queue<prodn_request<Arity>,
+                                  request_data_lt<prodn_request<Arity>>,
+                                  look_ahead,
+                                  mem_mode,
+                                  Arity,
+                                  0>;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Helper functions
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Left fold of the policy's operator over the given terminals.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, size_t Arity>
+  inline typename Policy::pointer_type
+  __prodn_fold(const Policy& policy, const std::array<typename Policy::pointer_type, Arity>& ts)
+  {
+    typename Policy::pointer_type result = ts[0];
+    for (size_t i = 1u; i < Arity; ++i) { result = policy(result, ts[i]); }
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Resolve a recursion target to a terminal, if its value is independent of the nodes
+  ///        within it.
+  ///
+  /// \details This generalizes the shortcutting of `prod2b` to any number of operands: the terminal
+  ///          is computed for every possible value of the nodes. If all of them agree, then the
+  ///          target can be replaced by that terminal.
+  ///
+  /// \returns The resulting terminal or `nil` if the target cannot be resolved.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename Target>
+  inline typename Policy::pointer_type
+  __prodn_resolve(const Policy& policy, const Target& t)
+  {
+    using pointer_type = typename Policy::pointer_type;
+
+    std::array<pointer_type, Target::cardinality> values = t.data();
+
+    std::array<size_t, Target::cardinality> nodes_idx;
+    size_t nodes = 0u;
+    for (size_t i = 0u; i < Target::cardinality; ++i) {
+      if (t[i].is_node()) { nodes_idx[nodes++] = i; }
+    }
+
+    if (nodes == Target::cardinality) { return pointer_type::nil(); }
+
+    pointer_type result = pointer_type::nil();
+    for (size_t assignment = 0u; assignment < (1u << nodes); ++assignment) {
+      for (size_t j = 0u; j < nodes; ++j) {
+        values[nodes_idx[j]] = pointer_type(static_cast<bool>((assignment >> j) & 1u));
+      }
+
+      const pointer_type r = __prodn_fold<Policy>(policy, values);
+      if (assignment == 0u) {
+        result = r;
+      } else if (r != result) {
+        return pointer_type::nil();
+      }
+    }
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Forward edge from `source` to `target`.
+  ///
+  /// \details If `target` can be resolved to a terminal, then the edge is output. Otherwise the
+  ///          edge is forwarded to be processed later.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename PriorityQueue>
+  inline void
+  __prodn_recurse_out(PriorityQueue& pq,
+                      arc_ofstream& aw,
+                      const Policy& policy,
+                      const ptr_uint64& source,
+                      const typename PriorityQueue::value_type::target_t& target)
+  {
+    const typename Policy::pointer_type result = __prodn_resolve(policy, target);
+
+    if (!result.is_nil()) {
+      aw.push_terminal({ source, result });
+    } else {
+      adiar_assert(source.label() < target.first().label(),
+                   "should always push recursion for 'later' level");
+
+      pq.push({ target, {}, { source } });
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Create the level inputs of the priority queue from each diagram.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename PriorityQueue, typename DdType, size_t Arity, size_t... Is>
+  inline std::array<typename PriorityQueue::level_input_type, Arity>
+  __prodn_level_inputs(const std::array<DdType, Arity>& ins, std::index_sequence<Is...>)
+  {
+    return { typename PriorityQueue::level_input_type(ins[Is])... };
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief N-ary Product Construction where all inputs are accessed at random.
+  ///
+  /// \pre All inputs are indexable and none of them is a terminal.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, size_t Arity, typename PriorityQueue>
+  typename Policy::__dd_type
+  __prodn(const exec_policy& ep,
+          const std::array<typename Policy::dd_type, Arity>& ins,
+          const Policy& policy,
+          const size_t pq_memory,
+          const size_t max_pq_size)
+  {
+    static_assert(Policy::no_skip, "N-ary product construction does not support skipping nodes");
+
+    using pointer_type = typename Policy::pointer_type;
+    using request_type = prodn_request<Arity>;
+    using target_type  = typename request_type::target_t;
+
+    // Set up output
+    shared_levelized_file<arc> out_arcs;
+    arc_ofstream aw(out_arcs);
+
+    // Set up input
+    std::array<unique_ptr<node_raccess>, Arity> in_nodes;
+    std::array<pointer_type, Arity> roots;
+    for (size_t i = 0u; i < Arity; ++i) {
+      in_nodes[i] = make_unique<node_raccess>(ins[i]);
+      roots[i]    = in_nodes[i]->root();
+    }
+
+    // Set up cross-level priority queue
+    PriorityQueue prod_pq(__prodn_level_inputs<PriorityQueue>(ins,
+                                                              std::make_index_sequence<Arity>()),
+                          pq_memory,
+                          max_pq_size,
+                          stats_prodn.lpq,
+                          ep);
+
+    prod_pq.push({ target_type(roots), {}, { ptr_uint64::nil() } });
+
+    out_arcs->max_1level_cut = prod_pq.size();
+
+    // Process all requests
+    while (!prod_pq.empty()) {
+      // Set up level
+      prod_pq.setup_next_level();
+
+      const typename Policy::label_type out_label = prod_pq.current_level();
+      typename Policy::id_type out_id             = 0;
+
+      for (unique_ptr<node_raccess>& in : in_nodes) { in->setup_next_level(out_label); }
+
+      // Update maximum 1-level cut
+      out_arcs->max_1level_cut = std::max(out_arcs->max_1level_cut, prod_pq.size());
+
+      // Process all requests for this level
+      while (!prod_pq.empty_level()) {
+        const request_type req = prod_pq.top();
+
+        // Recreate/Obtain children of req.target (possibly of suppressed node)
+        std::array<pointer_type, Arity> rec_low;
+        std::array<pointer_type, Arity> rec_high;
+
+        for (size_t i = 0u; i < Arity; ++i) {
+          const typename Policy::children_type children = req.target[i].level() == out_label
+            ? in_nodes[i]->at(req.target[i]).children()
+            : Policy::reduction_rule_inv(req.target[i]);
+
+          rec_low[i]  = children[false];
+          rec_high[i] = children[true];
+        }
+
+        // Output node and forward recursion targets
+        adiar_assert(out_id < Policy::max_id, "Has run out of ids");
+        const node::uid_type out_uid(out_label, out_id++);
+
+        __prodn_recurse_out(prod_pq, aw, policy, out_uid.as_ptr(false), target_type(rec_low));
+        __prodn_recurse_out(prod_pq, aw, policy, out_uid.as_ptr(true), target_type(rec_high));
+
+        const __prod2b_recurse_in__output_node<Policy> handler(aw, out_uid);
+        request_foreach(prod_pq, req.target, handler);
+      }
+
+      // Update meta information
+      aw.push(level_info(out_label, out_id));
+    }
+
+    // Ensure the edge case, where the in-going edge from nil to the root tuple does not dominate
+    // the max_1level_cut
+    out_arcs->max_1level_cut = std::min(aw.size() - out_arcs->number_of_terminals[false]
+                                          - out_arcs->number_of_terminals[true],
+                                        out_arcs->max_1level_cut);
+
+    return typename Policy::__dd_type(out_arcs, ep);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// Upper bound on i-level cut based on the maximum possible number of nodes in the output.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, size_t Arity>
+  size_t
+  __prodn_ilevel_upper_bound(const std::array<typename Policy::dd_type, Arity>& ins)
+  {
+    safe_size_t product = 1u;
+    for (const typename Policy::dd_type& in : ins) { product = product * (in.size() + 2u); }
+    return to_size(product + 1u + 2u);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Amount of memory needed besides the priority queue to combine the given diagrams.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename It>
+  size_t
+  __prodn_memory_usage(It begin, It end)
+  {
+    size_t result = arc_ofstream::memory_usage();
+    for (; begin != end; ++begin) { result += node_raccess::memory_usage(*begin); }
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief N-ary Product Construction of `Arity` diagrams within a single sweep.
+  ///
+  /// \pre All inputs are indexable and none of them is a terminal.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, size_t Arity>
+  typename Policy::__dd_type
+  prodn(const exec_policy& ep,
+        const std::array<typename Policy::dd_type, Arity>& ins,
+        const Policy& policy)
+  {
+    static_assert(3u <= Arity && Arity <= prodn_max_arity);
+
+#ifdef ADIAR_STATS
+    stats_prodn.sweeps[Arity - 3u] += 1u;
+#endif
+
+    const bool internal_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::Internal;
+    const bool external_only =
+      ep.template get<exec_policy::memory>() == exec_policy::memory::External;
+
+    const size_t pq_bound = __prodn_ilevel_upper_bound<Policy>(ins);
+
+    const size_t pq_available_memory =
+      memory_available() - __prodn_memory_usage<Policy>(ins.begin(), ins.end());
+
+    const size_t pq_memory_fits =
+      prodn_priority_queue_t<Arity, ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>::memory_fits(
+        pq_available_memory);
+
+    const size_t max_pq_size = internal_only ? std::min(pq_memory_fits, pq_bound) : pq_bound;
+
+    if (!external_only && max_pq_size <= no_lookahead_bound(Arity)) {
+#ifdef ADIAR_STATS
+      stats_prodn.lpq.unbucketed += 1u;
+#endif
+      return __prodn<Policy, Arity, prodn_priority_queue_t<Arity, 0, memory_mode::Internal>>(
+        ep, ins, policy, pq_available_memory, max_pq_size);
+    } else if (!external_only && max_pq_size <= pq_memory_fits) {
+#ifdef ADIAR_STATS
+      stats_prodn.lpq.internal += 1u;
+#endif
+      return __prodn<Policy,
+                     Arity,
+                     prodn_priority_queue_t<Arity, ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
+        ep, ins, policy, pq_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_prodn.lpq.adaptive += 1u;
+#endif
+      return __prodn<Policy,
+                     Arity,
+                     prodn_priority_queue_t<Arity, ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>>(
+        ep, ins, policy, pq_available_memory, max_pq_size);
+    } else {
+#ifdef ADIAR_STATS
+      stats_prodn.lpq.external += 1u;
+#endif
+      return __prodn<Policy,
+                     Arity,
+                     prodn_priority_queue_t<Arity, ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>(
+        ep, ins, policy, pq_available_memory, max_pq_size);
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the operator of the policy is associative.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  bool
+  __prodn_is_associative(const Policy& policy)
+  {
+    using pointer_type = typename Policy::pointer_type;
+
+    for (const bool a : { false, true }) {
+      for (const bool b : { false, true }) {
+        for (const bool c : { false, true }) {
+          const pointer_type pa(a);
+          const pointer_type pb(b);
+          const pointer_type pc(c);
+
+          if (policy(policy(pa, pb), pc) != policy(pa, policy(pb, pc))) { return false; }
+        }
+      }
+    }
+    return true;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the terminal `value` determines the result on either side of the operator.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  bool
+  __prodn_is_absorbing(const Policy& policy, const bool value)
+  {
+    using pointer_type = typename Policy::pointer_type;
+
+    const pointer_type v(value);
+    for (const bool x : { false, true }) {
+      if (policy(v, pointer_type(x)) != v || policy(pointer_type(x), v) != v) { return false; }
+    }
+    return true;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether the terminal `value` is the identity on either side of the operator.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  bool
+  __prodn_is_identity(const Policy& policy, const bool value)
+  {
+    using pointer_type = typename Policy::pointer_type;
+
+    const pointer_type v(value);
+    for (const bool x : { false, true }) {
+      const pointer_type px(x);
+      if (policy(v, px) != px || policy(px, v) != px) { return false; }
+    }
+    return true;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Largest number of the diagrams in `[begin, end)` that can be combined in a single sweep
+  ///        within the available memory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename It>
+  size_t
+  __prodn_arity(It begin, It end)
+  {
+    size_t arity = std::min<size_t>(std::distance(begin, end), prodn_max_arity);
+
+    for (; 3u <= arity; --arity) {
+      using pq_3_t = prodn_priority_queue_t<3u, 0, memory_mode::Internal>;
+      using pq_4_t = prodn_priority_queue_t<4u, 0, memory_mode::Internal>;
+
+      const size_t pq_memory = arity == 3u ? pq_3_t::memory_usage(no_lookahead_bound(3u))
+                                           : pq_4_t::memory_usage(no_lookahead_bound(4u));
+
+      if (__prodn_memory_usage<Policy>(begin, begin + arity) + pq_memory <= memory_available()) {
+        break;
+      }
+    }
+    return arity;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Combine the `arity` many diagrams starting at `begin` into one.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename It>
+  typename Policy::__dd_type
+  __prodn_group(const exec_policy& ep, It begin, const size_t arity, const Policy& policy)
+  {
+    using dd_type = typename Policy::dd_type;
+
+    bool use_sweep = 3u <= arity;
+    for (It it = begin; use_sweep && it != begin + arity; ++it) {
+      use_sweep = !dd_isterminal(*it) && (*it)->indexable;
+    }
+
+    if (use_sweep && arity == 3u) {
+      return prodn<Policy, 3u>(ep, { *begin, *(begin + 1), *(begin + 2) }, policy);
+    }
+    if (use_sweep && arity == 4u) {
+      return prodn<Policy, 4u>(ep, { *begin, *(begin + 1), *(begin + 2), *(begin + 3) }, policy);
+    }
+
+    // Fall back to (a left-deep tree of) 2-ary products. The policy is copied, since `prod2b` may
+    // flip its operator.
+    dd_type result = *begin;
+    for (size_t i = 1u; i < arity; ++i) {
+#ifdef ADIAR_STATS
+      stats_prodn.binary += 1u;
+#endif
+      Policy p = policy;
+      result   = prod2b(ep, result, *(begin + i), p);
+    }
+    return result;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief  N-ary Product Construction algorithm
+  ///
+  /// \details Computes the left fold of the policy's operator over all given diagrams. The
+  ///          diagrams are combined `prodn_max_arity` many at a time (fewer, if they do not fit
+  ///          into memory). If the operator is associative, then these products form a balanced
+  ///          tree. Otherwise, they form a left-deep tree.
+  ///
+  /// \pre `ins` is non-empty and all its diagrams are reduced.
+  ///
+  /// \return A class that inherits from `__dd` and describes the product of all given DAGs.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  typename Policy::__dd_type
+  prodn(const exec_policy& ep, std::vector<typename Policy::dd_type> ins, const Policy& policy)
+  {
+    using dd_type = typename Policy::dd_type;
+
+    adiar_assert(!ins.empty(), "Must be given at least one diagram");
+
+    const bool associative = __prodn_is_associative(policy);
+
+    // Shortcut on a terminal that determines the result and remove terminals that do not affect it.
+    {
+      std::vector<dd_type> tmp;
+      tmp.reserve(ins.size());
+
+      for (dd_type& f : ins) {
+        if (dd_isterminal(f)) {
+          const bool value = dd_valueof(f);
+          if (__prodn_is_absorbing(policy, value)) {
+#ifdef ADIAR_STATS
+            stats_prodn.shortcut += 1u;
+#endif
+            return f;
+          }
+          if (associative && __prodn_is_identity(policy, value)) { continue; }
+        }
+        tmp.push_back(std::move(f));
+      }
+
+      if (tmp.empty()) { return ins.front(); }
+      ins = std::move(tmp);
+    }
+
+    while (1u < ins.size()) {
+      std::vector<dd_type> next;
+      next.reserve(ins.size() / 2u + 1u);
+
+      for (auto it = ins.begin(); it != ins.end();) {
+        const size_t arity = __prodn_arity<Policy>(it, ins.end());
+
+        if (arity == 1u) {
+          next.push_back(*it);
+        } else {
+          dd_type result = __prodn_group(ep, it, arity, policy);
+
+          if (dd_isterminal(result) && __prodn_is_absorbing(policy, dd_valueof(result))) {
+#ifdef ADIAR_STATS
+            stats_prodn.shortcut += 1u;
+#endif
+            return result;
+          }
+          next.push_back(std::move(result));
+        }
+        it += arity;
+
+        // Only the left-most diagrams may be combined for a non-associative operator.
+        if (!associative) {
+          next.insert(next.end(), it, ins.end());
+          break;
+        }
+      }
+
+      ins = std::move(next);
+    }
+
+    return ins.front();
+  }
+}
+
+#endif // ADIAR_INTERNAL_ALGORITHMS_PRODN_H
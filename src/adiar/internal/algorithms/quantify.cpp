@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::quantify_t stats_quantify;
+  thread_local thread_statistics<&statistics::quantify> stats_quantify;
 }
@@ -27,6 +27,7 @@
 #include <adiar/internal/io/node_ifstream.h>
 #include <adiar/internal/io/node_raccess.h>
 #include <adiar/internal/io/shared_file_ptr.h>
+#include <adiar/internal/statistics.h>
 #include <adiar/internal/unreachable.h>
 #include <adiar/internal/util.h>
 
@@ -39,7 +40,7 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::quantify_t stats_quantify;
+  extern thread_local thread_statistics<&statistics::quantify> stats_quantify;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
 
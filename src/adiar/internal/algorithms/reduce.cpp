@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::reduce_t stats_reduce;
+  thread_local thread_statistics<&statistics::reduce> stats_reduce;
 }
@@ -1,12 +1,21 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_REDUCE_H
 #define ADIAR_INTERNAL_ALGORITHMS_REDUCE_H
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include <tpie/sort.h>
+#include <tpie/tpie.h>
+
 #include <adiar/exec_policy.h>
-#include <adiar/statistics.h>
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/cut.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
+#include <adiar/internal/data_structures/priority_queue.h>
+#include <adiar/internal/data_structures/radix_priority_queue.h>
 #include <adiar/internal/data_structures/sorter.h>
 #include <adiar/internal/data_types/arc.h>
 #include <adiar/internal/data_types/convert.h>
@@ -17,13 +26,16 @@
 #include <adiar/internal/io/iofstream.h>
 #include <adiar/internal/io/node_file.h>
 #include <adiar/internal/io/node_ofstream.h>
+#include <adiar/internal/io/prefetch.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/statistics.h>
+#include <adiar/internal/util.h>
 
 namespace adiar::internal
 {
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::reduce_t stats_reduce;
+  extern thread_local thread_statistics<&statistics::reduce> stats_reduce;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Data structures
@@ -73,17 +85,51 @@ namespace adiar::internal
     }
   };
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Integer key of an arc that agrees with `reduce_queue_lt`, i.e. the complement of its
+  ///        source's bit representation.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct reduce_queue_key
+  {
+    inline uint64_t
+    operator()(const arc& a) const
+    {
+      return ~a.source()._raw;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Overflow queue for the arcs of the Reduce. In internal memory, the arcs' integer key
+  ///        allows for a radix heap rather than a binary heap.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <memory_mode mem_mode>
+  using reduce_overflow_queue =
+    std::conditional_t<mem_mode == memory_mode::Internal,
+                       radix_priority_queue<reduce_arc, reduce_queue_lt, reduce_queue_key>,
+                       priority_queue<mem_mode, reduce_arc, reduce_queue_lt>>;
+
   ////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Decorator on the levelized priority queue to also keep track of the number of arcs to
   ///        each terminal.
   ////////////////////////////////////////////////////////////////////////////////////////////////
   template <size_t look_ahead, memory_mode mem_mode>
   class reduce_priority_queue
-    : public levelized_arc_priority_queue<reduce_arc, reduce_queue_lt, look_ahead, mem_mode>
+    : public levelized_arc_priority_queue<reduce_arc,
+                                          reduce_queue_lt,
+                                          look_ahead,
+                                          mem_mode,
+                                          1u,
+                                          1u,
+                                          reduce_overflow_queue<mem_mode>>
   {
   private:
-    using inner_lpq =
-      levelized_arc_priority_queue<reduce_arc, reduce_queue_lt, look_ahead, mem_mode>;
+    using inner_lpq = levelized_arc_priority_queue<reduce_arc,
+                                                   reduce_queue_lt,
+                                                   look_ahead,
+                                                   mem_mode,
+                                                   1u,
+                                                   1u,
+                                                   reduce_overflow_queue<mem_mode>>;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Number of terminals (of each type) placed within the priority queue.
@@ -94,8 +140,16 @@ namespace adiar::internal
     reduce_priority_queue(std::array<typename inner_lpq::level_input_type, 1>&& files,
                           size_t memory_given,
                           size_t max_size,
-                          statistics::levelized_priority_queue_t& stats)
-      : inner_lpq(std::move(files), memory_given, max_size, stats)
+                          statistics::levelized_priority_queue_t& stats,
+                          const exec_policy& ep = exec_policy())
+      : inner_lpq(std::move(files), memory_given, max_size, stats, ep)
+    {}
+
+    reduce_priority_queue(std::array<typename inner_lpq::level_input_type, 1>&& files,
+                          size_t memory_given,
+                          size_t max_size,
+                          const exec_policy& ep)
+      : reduce_priority_queue(std::move(files), memory_given, max_size, stats_reduce.lpq, ep)
     {}
 
     reduce_priority_queue(std::array<typename inner_lpq::level_input_type, 1>&& files,
@@ -158,6 +212,161 @@ namespace adiar::internal
     }
   };
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Decorator on an arc stream that merges the terminal arcs in a background thread and
+  ///          hands them over grouped by their level.
+  ///
+  /// \details While one level is sorted and its mappings are forwarded to its parents, the
+  ///          terminal arcs of the next levels are already pulled out of the in-order and
+  ///          out-of-order terminal arc streams. Each block handed over only contains arcs of a
+  ///          single level. The internal arcs are still read directly by the caller.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class reduce_arc_ifstream__pipelined
+  {
+  private:
+    arc_ifstream<>& _arcs;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Terminal arcs pulled by the background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    prefetcher<arc> _terminals;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of terminals (of each type) not yet pulled from this decorator.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _unread_terminals[2];
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Cache for `peek_terminal`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _has_peeked = false;
+    arc _peeked;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used with `blocks` many blocks of terminal arcs in flight.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(const size_t blocks)
+    {
+      return prefetcher<arc>::memory_usage(blocks);
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Start pulling the terminal arcs of `arcs` in the background.
+    ///
+    /// \pre   `0 < blocks` and no terminal arcs have been pulled from `arcs` yet.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    reduce_arc_ifstream__pipelined(arc_ifstream<>& arcs, const size_t blocks)
+      : _arcs(arcs)
+      , _unread_terminals{ arcs.unread_terminals(false), arcs.unread_terminals(true) }
+    {
+      _terminals.start(blocks, [&arcs](arc* buffer, const size_t n) -> size_t {
+        if (!arcs.can_pull_terminal()) { return 0u; }
+
+        const arc::label_type level = arcs.peek_terminal().source().label();
+
+        size_t i = 0u;
+        do {
+          buffer[i++] = arcs.pull_terminal();
+        } while (i < n && arcs.can_pull_terminal()
+                 && arcs.peek_terminal().source().label() == level);
+
+        return i;
+      });
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the stream contains more internal arcs.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_pull_internal() const
+    {
+      return _arcs.can_pull_internal();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the next internal arc (and move the read head).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const arc
+    pull_internal()
+    {
+      return _arcs.pull_internal();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the next internal arc (but do not move the read head).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const arc
+    peek_internal()
+    {
+      return _arcs.peek_internal();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the number of unread terminals.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    unread_terminals() const
+    {
+      return _unread_terminals[false] + _unread_terminals[true];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the number of unread terminals of a specific value.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const size_t&
+    unread_terminals(const bool terminal_value) const
+    {
+      return _unread_terminals[terminal_value];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the stream contains more terminal arcs.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_pull_terminal() const
+    {
+      return unread_terminals() > 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the next terminal arc (and move the read head).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const arc
+    pull_terminal()
+    {
+      const arc a = peek_terminal();
+      _has_peeked = false;
+
+      adiar_assert(_unread_terminals[a.target().value()] > 0,
+                   "Terminal counter should not be zero");
+      _unread_terminals[a.target().value()]--;
+
+      return a;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the next terminal arc (but do not move the read head).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const arc
+    peek_terminal()
+    {
+      if (!_has_peeked) {
+        adiar_assert(can_pull_terminal(), "Cannot peek past the last terminal arc");
+
+        [[maybe_unused]] const bool has_next = _terminals.can_read();
+        adiar_assert(has_next, "Background thread provides all terminal arcs");
+
+        _peeked     = _terminals.read();
+        _has_peeked = true;
+      }
+      return _peeked;
+    }
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Reduction Rule 2 sorting (and back again)
   struct reduce_node_children_lt
@@ -254,6 +463,326 @@ namespace adiar::internal
     cut[cut::All] += 1u;
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Output a node of the reduced level and add its children to the 1-level cut.
+  ///
+  /// \details Children, that are flagged within the unreduced node `n`, are the result of applying
+  ///          Reduction Rule 1 further below. Hence, they are added to the *tainted* cut instead.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline void
+  __reduce_output(node_ofstream& out,
+                  const node& out_node,
+                  const node& n,
+                  cuts_t& local_1level_cut,
+                  cuts_t& tainted_1level_cut)
+  {
+    out.unsafe_push(out_node);
+
+    __reduce_cut_add(n.low().is_flagged() ? tainted_1level_cut : local_1level_cut, out_node.low());
+    __reduce_cut_add(n.high().is_flagged() ? tainted_1level_cut : local_1level_cut, out_node.high());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Reduction Rule 2
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Reduction Rule 2 by sorting the nodes of a level on their children (and then the
+  ///        resulting mappings back in the order of the internal arcs).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <template <typename, typename> typename sorter_t>
+  class reduce_rule2__sorting
+  {
+  private:
+    sorter_t<node, reduce_node_children_lt> _child_grouping;
+    sorter_t<mapping, reduce_uid_lt> _red2_mapping;
+
+  public:
+    reduce_rule2__sorting(const size_t memory_bytes, const size_t unreduced_width)
+      : _child_grouping(memory_bytes, unreduced_width, 2)
+      , _red2_mapping(memory_bytes, unreduced_width, 2)
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Add a node of the level (that has not been removed by Reduction Rule 1).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(const node& n)
+    {
+      _child_grouping.push(n);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Output all unique nodes with ids from `Policy::max_id` and downwards.
+    ///
+    /// \returns The number of nodes output.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename Policy>
+    size_t
+    apply(const typename Policy::label_type out_label,
+          node_ofstream& out,
+          cuts_t& local_1level_cut,
+          cuts_t& tainted_1level_cut,
+          [[maybe_unused]] statistics::reduce_t& stats)
+    {
+#ifdef ADIAR_STATS
+      stats.levels_sorted += 1u;
+#endif
+      _child_grouping.sort();
+
+      typename Policy::id_type out_id = Policy::max_id;
+      node out_node = node(node::uid_type(), ptr_uint64::nil(), ptr_uint64::nil());
+
+      while (_child_grouping.can_pull()) {
+        const node next_node = _child_grouping.pull();
+
+        if (out_node.low() != unflag(next_node.low())
+            || out_node.high() != unflag(next_node.high())) {
+          adiar_assert(0 <= out_id, "Should still have more ids left");
+          out_node = node(out_label, out_id--, unflag(next_node.low()), unflag(next_node.high()));
+          __reduce_output(out, out_node, next_node, local_1level_cut, tainted_1level_cut);
+        } else {
+#ifdef ADIAR_STATS
+          stats.removed_by_rule_2 += 1u;
+#endif
+        }
+
+        _red2_mapping.push({ next_node.uid(), out_node.uid() });
+      }
+
+      // Sort mappings back in order of arcs.internal
+      _red2_mapping.sort();
+
+      return Policy::max_id - out_id;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether there are more mappings (in descending order of their old uid).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_pull()
+    {
+      return _red2_mapping.can_pull();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the next mapping.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mapping
+    pull()
+    {
+      return _red2_mapping.pull();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Reduction Rule 2 by hashing the children of the nodes of a level.
+  ///
+  /// \details Duplicate nodes are found in a single pass with an (open addressing) hash table. Only
+  ///          the remaining unique nodes are sorted to give them the very same ids as
+  ///          `reduce_rule2__sorting` does, i.e. the output is still canonical. The nodes are pushed
+  ///          in the order of the priority queue, which also is the order of the internal arcs.
+  ///          Hence, the mappings need not be sorted back again.
+  ///
+  /// \remark All nodes of the level are kept in internal memory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class reduce_rule2__hashing
+  {
+  private:
+    using index_type = size_t;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Value of an empty slot in the hash table.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr index_type no_index = std::numeric_limits<index_type>::max();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief All nodes in the order they were pushed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<node> _nodes;
+    size_t _size = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief For each node, the position in `_unique` of the first node with the same children.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<index_type> _class;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index in `_nodes` of each unique node.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<index_type> _unique;
+    size_t _unique_size = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Hash table with positions in `_unique`. When all nodes are pushed, it is reused to
+    ///        store the new id of each class.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<index_type> _table;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Label of the output level and the index of the next mapping to pull.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    node::label_type _out_label = 0u;
+    size_t _front_idx           = 0u;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of slots in the hash table, i.e. the smallest power of two that is at least
+    ///        twice the width.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    table_size(const size_t unreduced_width)
+    {
+      size_t res = 2u;
+      while (res < 2u * unreduced_width) { res <<= 1u; }
+      return res;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used for a level with the given number of nodes.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(const size_t unreduced_width)
+    {
+      return tpie::array<node>::memory_usage(unreduced_width)
+        + 2u * tpie::array<index_type>::memory_usage(unreduced_width)
+        + tpie::array<index_type>::memory_usage(table_size(unreduced_width));
+    }
+
+  public:
+    reduce_rule2__hashing([[maybe_unused]] const size_t memory_bytes, const size_t unreduced_width)
+      : _nodes(unreduced_width)
+      , _class(unreduced_width)
+      , _unique(unreduced_width)
+      , _table(table_size(unreduced_width), no_index)
+    {
+      adiar_assert(memory_usage(unreduced_width) <= memory_bytes,
+                   "Must be instantiated with enough memory.");
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \copydoc reduce_rule2__sorting::push
+    ///
+    /// \pre The nodes are pushed in descending order of their uid.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(const node& n)
+    {
+      adiar_assert(_size < _nodes.size(), "Must be instantiated with enough space");
+      adiar_assert(_size == 0u || n.uid() < _nodes[_size - 1u].uid(),
+                   "Nodes are pushed in the order of the internal arcs");
+
+      const ptr_uint64 low  = unflag(n.low());
+      const ptr_uint64 high = unflag(n.high());
+
+      // Find the slot of (low, high) with linear probing.
+      const size_t mask = _table.size() - 1u;
+
+      size_t slot = hash(low, high) & mask;
+      while (_table[slot] != no_index) {
+        const node& m = _nodes[_unique[_table[slot]]];
+        if (unflag(m.low()) == low && unflag(m.high()) == high) { break; }
+        slot = (slot + 1u) & mask;
+      }
+
+      if (_table[slot] == no_index) {
+        _table[slot]            = _unique_size;
+        _unique[_unique_size++] = _size;
+      }
+
+      _class[_size]   = _table[slot];
+      _nodes[_size++] = n;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \copydoc reduce_rule2__sorting::apply
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename Policy>
+    size_t
+    apply(const typename Policy::label_type out_label,
+          node_ofstream& out,
+          cuts_t& local_1level_cut,
+          cuts_t& tainted_1level_cut,
+          [[maybe_unused]] statistics::reduce_t& stats)
+    {
+#ifdef ADIAR_STATS
+      stats.levels_hashed += 1u;
+      stats.removed_by_rule_2 += _size - _unique_size;
+#endif
+      _out_label = out_label;
+
+      // Sort the unique nodes in the same order as `reduce_rule2__sorting`.
+      reduce_node_children_lt lt;
+      tpie::parallel_sort(_unique.begin(),
+                          _unique.begin() + _unique_size,
+                          [this, &lt](const index_type a, const index_type b) {
+                            return lt(_nodes[a], _nodes[b]);
+                          });
+
+      typename Policy::id_type out_id = Policy::max_id;
+
+      for (size_t i = 0u; i < _unique_size; ++i) {
+        const node& next_node = _nodes[_unique[i]];
+
+        adiar_assert(0 <= out_id, "Should still have more ids left");
+        const node out_node(out_label, out_id, unflag(next_node.low()), unflag(next_node.high()));
+        __reduce_output(out, out_node, next_node, local_1level_cut, tainted_1level_cut);
+
+        // The first node of each class has not moved within `_nodes`. Hence, `_class` still
+        // provides the class' original position (for which the hash table has space).
+        _table[_class[_unique[i]]] = out_id--;
+      }
+
+      return _unique_size;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \copydoc reduce_rule2__sorting::can_pull
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_pull() const
+    {
+      return _front_idx < _size;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \copydoc reduce_rule2__sorting::pull
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mapping
+    pull()
+    {
+      adiar_assert(can_pull());
+
+      const node::uid_type old_uid = _nodes[_front_idx].uid();
+      const node::id_type new_id   = _table[_class[_front_idx++]];
+      return { old_uid, node::uid_type(_out_label, new_id) };
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Value of a child to be hashed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static uint64_t
+    hash_value(const ptr_uint64& p)
+    {
+      if (p.is_terminal()) { return p.numeric_value(); }
+      return (static_cast<uint64_t>(p.label()) << 32u) ^ p.id();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Hash of the (unflagged) children of a node.
+    ///
+    /// \details Uses the finalizer of *SplitMix64* to spread the bits of both children.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    hash(const ptr_uint64& low, const ptr_uint64& high)
+    {
+      uint64_t z = hash_value(low) * 0x9E3779B97F4A7C15ull + hash_value(high);
+      z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      return z ^ (z >> 31);
+    }
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Algorithm functions
 
@@ -268,33 +797,32 @@ namespace adiar::internal
   __reduce_level__epilogue(arc_ifstream_t& arcs,
                            pq_t& reduce_pq,
                            node_ofstream& out,
-                           const bool terminal_val);
+                           const ptr_uint64& terminal);
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  /// \brief Reduce a single level (while also mapping it to a new label).
+  /// \brief Reduce a single level (while also mapping it to a new label) with the given approach
+  ///        to Reduction Rule 2.
   ///
   /// \returns width of output level
+  ///
+  /// \see reduce_rule2__sorting reduce_rule2__hashing
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  template <typename Policy,
-            template <typename, typename> typename sorter_t,
-            typename pq_t,
-            typename arc_ifstream_t>
+  template <typename Policy, typename rule2_t, typename pq_t, typename arc_ifstream_t>
   size_t
-  __reduce_level(arc_ifstream_t& arcs,
-                 const typename Policy::label_type in_label,
-                 const typename Policy::label_type out_label,
-                 pq_t& reduce_pq,
-                 node_ofstream& out,
-                 const size_t sorters_memory,
-                 const size_t unreduced_width,
-                 [[maybe_unused]] statistics::reduce_t& stats = stats_reduce)
+  __reduce_level__rule2(arc_ifstream_t& arcs,
+                        const typename Policy::label_type in_label,
+                        const typename Policy::label_type out_label,
+                        pq_t& reduce_pq,
+                        node_ofstream& out,
+                        const size_t sorters_memory,
+                        const size_t unreduced_width,
+                        [[maybe_unused]] statistics::reduce_t& stats = stats_reduce)
   {
     // Temporary file for Reduction Rule 1 mappings (opened later if need be)
     iofstream<mapping> red1_mapping;
 
-    // Sorters to find Reduction Rule 2 mappings
-    sorter_t<node, reduce_node_children_lt> child_grouping(sorters_memory, unreduced_width, 2);
-    sorter_t<mapping, reduce_uid_lt> red2_mapping(sorters_memory, unreduced_width, 2);
+    // Data structures to find Reduction Rule 2 mappings
+    rule2_t red2_mapping(sorters_memory, unreduced_width);
 
     // Pull out all nodes from reduce_pq and terminal_arcs for this level
     while ((arcs.can_pull_terminal() && arcs.peek_terminal().source().label() == in_label)
@@ -320,7 +848,7 @@ namespace adiar::internal
 #endif
         red1_mapping.write({ n.uid(), reduction_rule_ret });
       } else {
-        child_grouping.push(n);
+        red2_mapping.push(n);
       }
     }
 
@@ -333,41 +861,13 @@ namespace adiar::internal
                      reduce_pq.terminals(false) + arcs.unread_terminals(false),
                      reduce_pq.terminals(true) + arcs.unread_terminals(true));
 
-    // Sort and apply Reduction rule 2
-    child_grouping.sort();
-
-    typename Policy::id_type out_id = Policy::max_id;
-    node out_node                   = node(node::uid_type(), ptr_uint64::nil(), ptr_uint64::nil());
-
-    while (child_grouping.can_pull()) {
-      const node next_node = child_grouping.pull();
-
-      if (out_node.low() != unflag(next_node.low())
-          || out_node.high() != unflag(next_node.high())) {
-        adiar_assert(0 <= out_id, "Should still have more ids left");
-        out_node = node(out_label, out_id--, unflag(next_node.low()), unflag(next_node.high()));
-        out.unsafe_push(out_node);
-
-        __reduce_cut_add(next_node.low().is_flagged() ? tainted_1level_cut : local_1level_cut,
-                         out_node.low());
-        __reduce_cut_add(next_node.high().is_flagged() ? tainted_1level_cut : local_1level_cut,
-                         out_node.high());
-      } else {
-#ifdef ADIAR_STATS
-        stats.removed_by_rule_2 += 1u;
-#endif
-      }
-
-      red2_mapping.push({ next_node.uid(), out_node.uid() });
-    }
+    // Apply Reduction rule 2
+    const size_t reduced_width = red2_mapping.template apply<Policy>(
+      out_label, out, local_1level_cut, tainted_1level_cut, stats);
 
     // Add number of nodes to level information, if any nodes were pushed to the output.
-    const size_t reduced_width = Policy::max_id - out_id;
     if (reduced_width > 0) { out.unsafe_push(level_info(out_label, reduced_width)); }
 
-    // Sort mappings for Reduction rule 2 back in order of arcs.internal
-    red2_mapping.sort();
-
     // Merging of red1_mapping and red2_mapping
     mapping next_red1  = { node::uid_type(), node::uid_type() }; // <-- dummy value
     bool has_next_red1 = red1_mapping.is_open() && red1_mapping.size() > 0;
@@ -424,14 +924,38 @@ namespace adiar::internal
     // Add the tainted edges
     out.unsafe_inc_1level_cut(tainted_1level_cut);
 
-    const bool terminal_value = next_red1.new_uid.is_terminal() && next_red1.new_uid.value();
-    __reduce_level__epilogue<>(arcs, reduce_pq, out, terminal_value);
+    const ptr_uint64 terminal =
+      next_red1.new_uid.is_terminal() ? unflag(next_red1.new_uid) : ptr_uint64(false);
+    __reduce_level__epilogue<>(arcs, reduce_pq, out, terminal);
 
     adiar_assert(reduced_width <= unreduced_width, "Reduction should only ever remove nodes");
 
     return reduced_width;
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Reduce a single level (while also mapping it to a new label).
+  ///
+  /// \returns width of output level
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy,
+            template <typename, typename> typename sorter_t,
+            typename pq_t,
+            typename arc_ifstream_t>
+  size_t
+  __reduce_level(arc_ifstream_t& arcs,
+                 const typename Policy::label_type in_label,
+                 const typename Policy::label_type out_label,
+                 pq_t& reduce_pq,
+                 node_ofstream& out,
+                 const size_t sorters_memory,
+                 const size_t unreduced_width,
+                 statistics::reduce_t& stats = stats_reduce)
+  {
+    return __reduce_level__rule2<Policy, reduce_rule2__sorting<sorter_t>>(
+      arcs, in_label, out_label, reduce_pq, out, sorters_memory, unreduced_width, stats);
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Reduce a single level (without mapping it to a new label).
   ///
@@ -461,7 +985,7 @@ namespace adiar::internal
   __reduce_level__epilogue(arc_ifstream_t& arcs,
                            pq_t& reduce_pq,
                            node_ofstream& out,
-                           const bool terminal_val)
+                           const ptr_uint64& terminal)
   {
 
     adiar_assert(reduce_pq.empty_level(),
@@ -505,7 +1029,9 @@ namespace adiar::internal
       // adiar_assert(next_red1.new_uid.is_terminal(),
       //             "A node must have been suppressed in favour of a terminal");
 
-      out.unsafe_push(node(terminal_val));
+      const bool terminal_val = terminal.value();
+
+      out.unsafe_push(node(node::uid_type(terminal), ptr_uint64::nil(), ptr_uint64::nil()));
       out.unsafe_set_number_of_terminals(!terminal_val, terminal_val);
 
       // NOTE: We do not need to update the cuts, since this is taken care of in
@@ -513,15 +1039,57 @@ namespace adiar::internal
     }
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Reduce each level bottom-up.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename pq_t, typename arc_ifstream_t>
+  void
+  __reduce_levels(Policy& policy,
+                  arc_ifstream_t& arcs,
+                  level_info_ifstream<>& levels,
+                  pq_t& reduce_pq,
+                  node_ofstream& out,
+                  const size_t sorters_memory)
+  {
+    const size_t internal_sorter_can_fit = internal_sorter<node>::memory_fits(sorters_memory / 2);
+
+    while (levels.can_pull()) {
+      adiar_assert(arcs.can_pull_terminal() || !reduce_pq.empty(),
+                   "If there is a level, then there should also be something for it.");
+      const level_info current_level_info         = levels.pull();
+      const typename Policy::label_type in_level  = current_level_info.level();
+      const typename Policy::label_type out_level = policy.map_level(in_level);
+
+      adiar_assert(!reduce_pq.has_current_level() || in_level == reduce_pq.current_level(),
+                   "level and priority queue should be in sync");
+
+      const size_t unreduced_width = current_level_info.width();
+      if (reduce_rule2__hashing::memory_usage(unreduced_width) <= sorters_memory) {
+        __reduce_level__rule2<Policy, reduce_rule2__hashing>(
+          arcs, in_level, out_level, reduce_pq, out, sorters_memory, unreduced_width);
+      } else if (unreduced_width <= internal_sorter_can_fit) {
+        __reduce_level<Policy, internal_sorter>(
+          arcs, in_level, out_level, reduce_pq, out, sorters_memory, unreduced_width);
+      } else {
+        __reduce_level<Policy, external_sorter>(
+          arcs, in_level, out_level, reduce_pq, out, sorters_memory, unreduced_width);
+      }
+    }
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Reduce an entire decision diagram bottom-up.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename Policy, typename pq_t>
   shared_levelized_file<typename Policy::node_type>
-  __reduce(Policy& policy,
+  __reduce(const exec_policy& ep,
+           Policy& policy,
            const shared_levelized_file<arc>& in_file,
            const size_t lpq_memory,
-           const size_t sorters_memory)
+           const size_t sorters_memory,
+           const size_t read_ahead,
+           const size_t write_behind,
+           const size_t group_ahead)
   {
 #ifdef ADIAR_STATS
     stats_reduce.sum_node_arcs += in_file->size(0);
@@ -529,12 +1097,15 @@ namespace adiar::internal
 #endif
 
     arc_ifstream<> arcs(in_file);
+    arcs.read_ahead(read_ahead);
+
     level_info_ifstream<> levels(in_file);
 
     // Set up output
     shared_levelized_file<typename Policy::node_type> out_file = __reduce_init_output<Policy>();
 
     node_ofstream out(out_file);
+    out.write_behind(write_behind);
 
     // Trivial single-node case
     if (!arcs.can_pull_internal()) {
@@ -549,7 +1120,8 @@ namespace adiar::internal
         stats_reduce.removed_by_rule_1 += 1u;
 #endif
         const bool terminal_val = reduction_rule_ret.value();
-        const node out_node     = node(terminal_val);
+        const node out_node(
+          node::uid_type(reduction_rule_ret), ptr_uint64::nil(), ptr_uint64::nil());
         out.unsafe_push(out_node);
 
         out.unsafe_set_number_of_terminals(!terminal_val, terminal_val);
@@ -581,29 +1153,15 @@ namespace adiar::internal
     }
 
     // Initialize (levelized) priority queue and run Reduce algorithm
-    pq_t reduce_pq({ in_file }, lpq_memory, in_file->max_1level_cut);
+    pq_t reduce_pq({ in_file }, lpq_memory, in_file->max_1level_cut, ep);
 
-    const size_t internal_sorter_can_fit = internal_sorter<node>::memory_fits(sorters_memory / 2);
-
-    // Process bottom-up each level
-    while (levels.can_pull()) {
-      adiar_assert(arcs.can_pull_terminal() || !reduce_pq.empty(),
-                   "If there is a level, then there should also be something for it.");
-      const level_info current_level_info         = levels.pull();
-      const typename Policy::label_type in_level  = current_level_info.level();
-      const typename Policy::label_type out_level = policy.map_level(in_level);
-
-      adiar_assert(!reduce_pq.has_current_level() || in_level == reduce_pq.current_level(),
-                   "level and priority queue should be in sync");
-
-      const size_t unreduced_width = current_level_info.width();
-      if (unreduced_width <= internal_sorter_can_fit) {
-        __reduce_level<Policy, internal_sorter>(
-          arcs, in_level, out_level, reduce_pq, out, sorters_memory, unreduced_width);
-      } else {
-        __reduce_level<Policy, external_sorter>(
-          arcs, in_level, out_level, reduce_pq, out, sorters_memory, unreduced_width);
-      }
+    // Process bottom-up each level (while the terminal arcs of the next levels are obtained by
+    // another thread, if possible).
+    if (0u < group_ahead) {
+      reduce_arc_ifstream__pipelined pipelined_arcs(arcs, group_ahead);
+      __reduce_levels<Policy>(policy, pipelined_arcs, levels, reduce_pq, out, sorters_memory);
+    } else {
+      __reduce_levels<Policy>(policy, arcs, levels, reduce_pq, out, sorters_memory);
     }
 
     return out_file;
@@ -629,9 +1187,9 @@ namespace adiar::internal
         input.template get<typename Policy::shared_node_file_type>(), input._negate, input._shift);
     }
 
-    // Get unreduced input
+    // Get unreduced input (with its internal arcs sorted on their target)
     const typename Policy::shared_arc_file_type in_file =
-      input.template get<typename Policy::shared_arc_file_type>();
+      transposed(input.template get<typename Policy::shared_arc_file_type>());
 
     // Compute amount of memory available for auxiliary data structures after
     // having opened all streams.
@@ -639,12 +1197,24 @@ namespace adiar::internal
     // We then may derive an upper bound on the size of auxiliary data
     // structures and check whether we can run them with a faster internal
     // memory variant.
+    //
+    // If there are threads to spare, then the arcs are read ahead in the background. This may use
+    // up to an eighth of the memory. Another eighth may be used to write the nodes behind. Finally,
+    // a sixteenth may be used to already group the terminal arcs of the next levels.
+    const size_t read_ahead =
+      read_ahead_blocks(ep, memory_available() / 8u, arc_ifstream<>::streams);
+
+    const size_t write_behind = write_behind_blocks(ep, memory_available() / 8u);
+
+    const size_t group_ahead = read_ahead_blocks(ep, memory_available() / 16u);
+
     const size_t aux_available_memory = memory_available()
       // Input streams
-      - arc_ifstream<>::memory_usage()
+      - arc_ifstream<>::memory_usage(read_ahead)
+      - reduce_arc_ifstream__pipelined::memory_usage(group_ahead)
       - level_info_ifstream<>::memory_usage()
       // Output streams
-      - node_ofstream::memory_usage();
+      - node_ofstream::memory_usage(write_behind);
 
     const size_t pq_memory = aux_available_memory / 2;
     const size_t sorters_memory =
@@ -667,19 +1237,25 @@ namespace adiar::internal
       stats_reduce.lpq.unbucketed += 1u;
 #endif
       return __reduce<Policy, reduce_priority_queue<0, memory_mode::Internal>>(
-        policy, in_file, pq_memory, sorters_memory);
+        ep, policy, in_file, pq_memory, sorters_memory, read_ahead, write_behind, group_ahead);
     } else if (!external_only && max_pq_size <= pq_memory_fits) {
 #ifdef ADIAR_STATS
       stats_reduce.lpq.internal += 1u;
 #endif
       return __reduce<Policy, reduce_priority_queue<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
-        policy, in_file, pq_memory, sorters_memory);
+        ep, policy, in_file, pq_memory, sorters_memory, read_ahead, write_behind, group_ahead);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_reduce.lpq.adaptive += 1u;
+#endif
+      return __reduce<Policy, reduce_priority_queue<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>>(
+        ep, policy, in_file, pq_memory, sorters_memory, read_ahead, write_behind, group_ahead);
     } else {
 #ifdef ADIAR_STATS
       stats_reduce.lpq.external += 1u;
 #endif
       return __reduce<Policy, reduce_priority_queue<ADIAR_LPQ_LOOKAHEAD, memory_mode::External>>(
-        policy, in_file, pq_memory, sorters_memory);
+        ep, policy, in_file, pq_memory, sorters_memory, read_ahead, write_behind, group_ahead);
     }
   }
 
@@ -0,0 +1,6 @@
+#include "reorder.h"
+
+namespace adiar::internal
+{
+  thread_local thread_statistics<&statistics::reorder> stats_reorder;
+}
@@ -0,0 +1,570 @@
+#ifndef ADIAR_INTERNAL_ALGORITHMS_REORDER_H
+#define ADIAR_INTERNAL_ALGORITHMS_REORDER_H
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <tpie/memory.h>
+
+#include <adiar/exception.h>
+#include <adiar/exec_policy.h>
+#include <adiar/types.h>
+
+#include <adiar/internal/algorithms/reduce.h>
+#include <adiar/internal/assert.h>
+#include <adiar/internal/data_types/level_info.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/dd.h>
+#include <adiar/internal/io/levelized_ifstream.h>
+#include <adiar/internal/io/node_file.h>
+#include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/io/node_ofstream.h>
+#include <adiar/internal/memory.h>
+#include <adiar/internal/statistics.h>
+#include <adiar/internal/util.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  //  Variable Reordering
+  // =====================
+  //
+  // Given a Decision Diagram, search for a permutation of its levels that decreases its size.
+  //
+  // The basic building block is to swap two adjacent levels `x < y`, i.e. to compute `f[x <-> y]`.
+  // Each node `n` on level `x` has cofactors `n_ab` for `x = a` and `y = b`. After the swap,
+  // it is replaced by
+  /*
+  //            (x)                         (x)
+  //          /     \                     /     \
+  //        (y)     (y)       =>        (y)     (y)
+  //       /   \   /   \               /   \   /   \
+  //     n_00 n_01 n_10 n_11         n_00 n_10 n_01 n_11
+  */
+  // where the Reduction Rules are applied to the newly created nodes. Each node on level `y` that
+  // is reachable from above level `x` is moved to level `x`. The levels below are copied as-is.
+  // The levels above keep their nodes, but these are given new identifiers in the canonical order
+  // of their (updated) children. Hence, this is a single linear scan through the diagram with the
+  // two swapped levels and the identifiers of the nodes above them kept in internal memory. If the
+  // latter do not fit, the levels above are copied with only their pointers updated and the result
+  // is made canonical again with Reduce.
+  //
+  // On top of this, the sifting and window permutation heuristics are implemented, as described
+  // in [Rudell93] and [Fujita91], respectively.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// Struct to hold statistics
+  extern thread_local thread_statistics<&statistics::reorder> stats_reorder;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Approximate number of bytes needed in internal memory per node on the swapped levels.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  constexpr size_t swap_adjacent_node_memory = 8u * sizeof(node);
+
+  /// \cond
+  template <typename T>
+  using __swap_vector = std::vector<T, tpie::allocator<T>>;
+
+  template <typename T>
+  using __swap_set = std::set<T, std::less<T>, tpie::allocator<T>>;
+
+  template <typename K, typename V>
+  using __swap_map = std::map<K, V, std::less<K>, tpie::allocator<std::pair<const K, V>>>;
+  /// \endcond
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether any two adjacent levels of a diagram can be swapped in internal memory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline bool
+  swap_adjacent_fits(const dd& f)
+  {
+    return 2u * f.width() * swap_adjacent_node_memory <= memory_available();
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Reference to a pointer or to a node on one of the swapped levels that has yet to be
+  ///        given its identifier.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct __swap_ref
+  {
+    static constexpr size_t no_idx = std::numeric_limits<size_t>::max();
+
+    node::pointer_type ptr;
+    size_t idx;
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief A level of newly created nodes with their unique table.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  class __swap_level
+  {
+    using label_type   = typename Policy::label_type;
+    using pointer_type = typename Policy::pointer_type;
+    using node_type    = typename Policy::node_type;
+
+    const label_type _label;
+
+    __swap_vector<pair<pointer_type, pointer_type>> _nodes;
+    __swap_map<pair<pointer_type, pointer_type>, size_t> _unique;
+    __swap_vector<pointer_type> _ptrs;
+
+  public:
+    __swap_level(const label_type label)
+      : _label(label)
+    {}
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Find or create the node with the given children (or apply the Reduction Rule).
+    //////////////////////////////////////////////////////////////////////////////////////////////
+    __swap_ref
+    make_node(const pointer_type& low, const pointer_type& high)
+    {
+      const node_type n(this->_label, node_type::max_id, low, high);
+      const pointer_type r = Policy::reduction_rule(n);
+      if (r != n.uid()) { return { r, __swap_ref::no_idx }; }
+
+      const pair<pointer_type, pointer_type> key = { low, high };
+      const auto it = this->_unique.find(key);
+      if (it != this->_unique.end()) { return { pointer_type::nil(), it->second }; }
+
+      const size_t idx = this->_nodes.size();
+      this->_nodes.push_back(key);
+      this->_unique.insert({ key, idx });
+      return { pointer_type::nil(), idx };
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Assign identifiers in canonical order and push all nodes to the writer.
+    //////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(node_ofstream& out)
+    {
+      __swap_vector<size_t> order(this->_nodes.size());
+      for (size_t i = 0u; i < order.size(); ++i) { order[i] = i; }
+
+      this->_ptrs.resize(this->_nodes.size(), pointer_type::nil());
+
+      out.push_level(
+        this->_label,
+        order.begin(),
+        order.end(),
+        [this](const size_t i) {
+          return typename node_type::children_type(this->_nodes[i].first, this->_nodes[i].second);
+        },
+        [this](const size_t i, const typename node_type::uid_type& u) { this->_ptrs[i] = u; });
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The pointer of a reference (after `push`).
+    //////////////////////////////////////////////////////////////////////////////////////////////
+    pointer_type
+    resolve(const __swap_ref& r) const
+    {
+      return r.idx == __swap_ref::no_idx ? r.ptr : this->_ptrs.at(r.idx);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Swap two adjacent levels `upper < lower`, i.e. compute `f[upper <-> lower]`.
+  ///
+  /// \details The result is canonical. The nodes above both levels are given new identifiers in
+  ///          internal memory, if possible. Otherwise, the result is made canonical with Reduce.
+  ///
+  /// \pre No level of `f` lies strictly between `upper` and `lower` and both levels fit into
+  ///      internal memory (see `swap_adjacent_fits`).
+  ///
+  /// \throws invalid_argument If `upper` and `lower` are not adjacent.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  typename Policy::dd_type
+  swap_adjacent(const exec_policy& ep,
+                const typename Policy::dd_type& f,
+                const typename Policy::label_type upper,
+                const typename Policy::label_type lower)
+  {
+    using pointer_type  = typename Policy::pointer_type;
+    using node_type     = typename Policy::node_type;
+    using children_type = typename Policy::children_type;
+
+    adiar_assert(upper < lower, "Levels should be given in order");
+
+    if (f->is_terminal()) { return f; }
+
+    size_t above_size = 0u;
+    {
+      level_info_ifstream<> ls(f);
+      while (ls.can_pull()) {
+        const level_info li = ls.pull();
+        if (upper < li.level() && li.level() < lower) {
+          throw invalid_argument("Levels are not adjacent");
+        }
+        if (li.level() < upper) { above_size += li.width(); }
+      }
+    }
+
+#ifdef ADIAR_STATS
+    stats_reorder.swaps += 1u;
+#endif
+
+    // ---------------------------------------------------------------------------------------------
+    // Step 1: Find all nodes on the lower level that are reachable from above the upper one.
+    __swap_set<pointer_type> lower_from_above;
+    {
+      node_ifstream<> in(f);
+
+      const node_type root = in.peek();
+      if (root.label() == lower) { lower_from_above.insert(essential(root.uid())); }
+
+      while (in.can_pull() && in.peek().label() < upper) {
+        const node_type n = in.pull();
+        for (const pointer_type& c : { n.low(), n.high() }) {
+          if (c.is_node() && c.label() == lower) { lower_from_above.insert(essential(c)); }
+        }
+      }
+    }
+
+    // ---------------------------------------------------------------------------------------------
+    // Step 2: Copy and swap bottom-up.
+    shared_levelized_file<node_type> out_file;
+    bool canonical = true;
+    {
+      node_ofstream out(out_file);
+      node_ifstream<true> in(f);
+
+      // Levels below are copied as-is.
+      while (in.can_pull() && lower < in.peek().label()) { out << in.pull(); }
+
+      // Load both levels into memory.
+      __swap_map<pointer_type, children_type> lower_nodes;
+      while (in.can_pull() && in.peek().label() == lower) {
+        const node_type n = in.pull();
+        lower_nodes.insert({ essential(n.uid()), n.children() });
+      }
+
+      __swap_vector<node_type> upper_nodes;
+      while (in.can_pull() && in.peek().label() == upper) { upper_nodes.push_back(in.pull()); }
+
+      const auto cofactors = [&lower_nodes, &lower](const pointer_type& p) -> children_type {
+        if (p.is_node() && p.label() == lower) { return lower_nodes.at(essential(p)); }
+        return Policy::reduction_rule_inv(p);
+      };
+
+      // Create new nodes on the lower level.
+      __swap_level<Policy> new_lower(lower);
+
+      __swap_vector<pair<__swap_ref, __swap_ref>> upper_children;
+      upper_children.reserve(upper_nodes.size());
+
+      for (const node_type& n : upper_nodes) {
+        const children_type n_low  = cofactors(n.low());
+        const children_type n_high = cofactors(n.high());
+
+        upper_children.push_back({ new_lower.make_node(n_low[false], n_high[false]),
+                                   new_lower.make_node(n_low[true], n_high[true]) });
+      }
+      new_lower.push(out);
+
+      // Create new nodes on the upper level.
+      __swap_level<Policy> new_upper(upper);
+      __swap_vector<pair<pointer_type, __swap_ref>> upper_refs;
+      upper_refs.reserve(upper_nodes.size() + lower_from_above.size());
+
+      for (size_t i = 0u; i < upper_nodes.size(); ++i) {
+        const pointer_type low  = new_lower.resolve(upper_children[i].first);
+        const pointer_type high = new_lower.resolve(upper_children[i].second);
+        upper_refs.push_back({ essential(upper_nodes[i].uid()), new_upper.make_node(low, high) });
+      }
+      for (const pointer_type& p : lower_from_above) {
+        const children_type c = lower_nodes.at(p);
+        upper_refs.push_back({ p, new_upper.make_node(c[false], c[true]) });
+      }
+      new_upper.push(out);
+
+      // Pointers into the swapped levels (and the levels above, if relabelled) are updated with
+      // the new identifiers of their targets.
+      __swap_map<pointer_type, pointer_type> remap;
+      for (const auto& [p, r] : upper_refs) { remap.insert({ p, new_upper.resolve(r) }); }
+
+      const auto remapped = [&remap](const pointer_type& p) -> pointer_type {
+        if (!p.is_node()) { return p; }
+        const auto it = remap.find(essential(p));
+        return it == remap.end() ? p : it->second;
+      };
+
+      // Levels above are given new identifiers in canonical order, if these fit into memory.
+      // Otherwise, they are copied with only their pointers updated.
+      canonical = above_size * swap_adjacent_node_memory <= memory_available();
+
+      while (in.can_pull()) {
+        if (!canonical) {
+          const node_type n = in.pull();
+          out << node_type(n.uid(), remapped(n.low()), remapped(n.high()));
+          continue;
+        }
+
+        const typename Policy::label_type label = in.peek().label();
+
+        __swap_level<Policy> level(label);
+        __swap_vector<pair<pointer_type, __swap_ref>> level_refs;
+        while (in.can_pull() && in.peek().label() == label) {
+          const node_type n = in.pull();
+          level_refs.push_back(
+            { essential(n.uid()), level.make_node(remapped(n.low()), remapped(n.high())) });
+        }
+        level.push(out);
+
+        for (const auto& [p, r] : level_refs) { remap.insert({ p, level.resolve(r) }); }
+      }
+    }
+    if (canonical) { return out_file; }
+
+#ifdef ADIAR_STATS
+    stats_reorder.reduced_swaps += 1u;
+#endif
+    const typename Policy::dd_type res(out_file);
+    return reduce<Policy>(typename Policy::__dd_type(transpose(res), ep));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief State of a reordering, i.e. the current diagram and which variable is on each level.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  class __reorder_state
+  {
+    using dd_type    = typename Policy::dd_type;
+    using label_type = typename Policy::label_type;
+
+  public:
+    /// \brief Current diagram.
+    dd_type dd;
+
+    /// \brief Labels of all levels (in ascending order).
+    std::vector<label_type> levels;
+
+    /// \brief Original variable currently placed on each level.
+    std::vector<label_type> order;
+
+    /// \brief Number of nodes on each level of the original diagram.
+    std::vector<size_t> widths;
+
+    /// \brief Size above which a swap is undone.
+    const size_t size_bound;
+
+    /// \brief Execution policy for the swaps.
+    const exec_policy& ep;
+
+  public:
+    __reorder_state(const exec_policy& ep, const dd_type& f, const size_t bound)
+      : dd(f)
+      , size_bound(bound)
+      , ep(ep)
+    {
+      level_info_ifstream<> ls(f);
+      while (ls.can_pull()) {
+        const level_info li = ls.pull();
+        this->levels.push_back(li.level());
+        this->widths.push_back(li.width());
+      }
+      this->order = this->levels;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Swap the variables at position `i` and `i+1`.
+    ///
+    /// \returns Whether the swap was possible within internal memory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    swap(const size_t i)
+    {
+      adiar_assert(i + 1u < this->levels.size(), "Position should be within bounds");
+
+      if (!swap_adjacent_fits(this->dd)) {
+#ifdef ADIAR_STATS
+        stats_reorder.skipped_swaps += 1u;
+#endif
+        return false;
+      }
+
+      this->dd = swap_adjacent<Policy>(this->ep, this->dd, this->levels[i], this->levels[i + 1u]);
+      std::swap(this->order[i], this->order[i + 1u]);
+      return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The permutation from each original variable to its new level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<label_type>
+    permutation() const
+    {
+      const size_t size = this->levels.empty() ? 0u : this->levels.back() + 1u;
+
+      std::vector<label_type> res(size);
+      for (size_t x = 0u; x < size; ++x) { res[x] = static_cast<label_type>(x); }
+      for (size_t i = 0u; i < this->levels.size(); ++i) { res[this->order[i]] = this->levels[i]; }
+      return res;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Move the variable at position `from` to position `to` with adjacent swaps.
+  ///
+  /// \returns The position it reached.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  size_t
+  __reorder_move(__reorder_state<Policy>& s, size_t from, const size_t to)
+  {
+    while (from < to && s.swap(from)) { ++from; }
+    while (to < from && s.swap(from - 1u)) { --from; }
+    return from;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sift the variable at position `pos` through all levels and leave it at the position
+  ///        with the smallest diagram.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  void
+  __reorder_sift(__reorder_state<Policy>& s, size_t pos)
+  {
+    const size_t last = s.levels.size() - 1u;
+
+    size_t best_pos  = pos;
+    size_t best_size = s.dd.size();
+
+    const auto sift_to = [&](const size_t to) {
+      while (pos != to) {
+        const size_t next = pos < to ? pos + 1u : pos - 1u;
+        if (!s.swap(std::min(pos, next))) { return; }
+        pos = next;
+
+        const size_t size = s.dd.size();
+        if (size < best_size) {
+          best_size = size;
+          best_pos  = pos;
+        }
+        if (s.size_bound < size) { return; }
+      }
+    };
+
+    // Move towards the closest end first.
+    if (pos < last - pos) {
+      sift_to(0u);
+      sift_to(last);
+    } else {
+      sift_to(last);
+      sift_to(0u);
+    }
+    __reorder_move(s, pos, best_pos);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sifting heuristic, i.e. sift each variable, in order of the widest levels first.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  void
+  __reorder_sifting(__reorder_state<Policy>& s)
+  {
+#ifdef ADIAR_STATS
+    stats_reorder.sifting += 1u;
+#endif
+    std::vector<size_t> vars(s.levels.size());
+    for (size_t i = 0u; i < vars.size(); ++i) { vars[i] = i; }
+    std::stable_sort(vars.begin(), vars.end(), [&s](const size_t a, const size_t b) {
+      return s.widths[b] < s.widths[a];
+    });
+
+    for (const size_t v : vars) {
+      const auto pos = std::find(s.order.begin(), s.order.end(), s.levels[v]) - s.order.begin();
+      __reorder_sift(s, static_cast<size_t>(pos));
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Window permutation heuristic, i.e. try all permutations of `Width` adjacent levels
+  ///        until a fixpoint is reached.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <size_t Width, typename Policy>
+  void
+  __reorder_window(__reorder_state<Policy>& s)
+  {
+    static_assert(Width == 2u || Width == 3u);
+
+#ifdef ADIAR_STATS
+    stats_reorder.window += 1u;
+#endif
+    if (s.levels.size() < Width) { return; }
+
+    // Sequence of swaps (relative to the start of the window) that visits all permutations.
+    constexpr size_t permutations          = Width == 2u ? 1u : 5u;
+    constexpr std::array<size_t, 5u> swaps = { 0u, 1u, 0u, 1u, 0u };
+
+    bool improved = true;
+    while (improved) {
+      improved = false;
+
+      for (size_t i = 0u; i + Width <= s.levels.size(); ++i) {
+        const size_t start_size = s.dd.size();
+        size_t best_size        = start_size;
+        size_t best_step        = 0u;
+        size_t step             = 0u;
+
+        while (step < permutations && s.swap(i + swaps[step])) {
+          ++step;
+
+          const size_t size = s.dd.size();
+          if (size < best_size) {
+            best_size = size;
+            best_step = step;
+          }
+          if (s.size_bound < size) { break; }
+        }
+
+        // Undo all swaps after the best permutation.
+        while (best_step < step) {
+          --step;
+          if (!s.swap(i + swaps[step])) { break; }
+        }
+
+        improved |= best_size < start_size;
+      }
+    }
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Search for a variable ordering of `f` with fewer nodes.
+  ///
+  /// \param size_bound Any intermediate diagram larger than this stops the search in the current
+  ///                   direction.
+  ///
+  /// \returns The reordered diagram and the permutation from each original variable to its new
+  ///          level.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  pair<typename Policy::dd_type, std::vector<typename Policy::label_type>>
+  reorder(const exec_policy& ep,
+          const typename Policy::dd_type& f,
+          const reorder_type r_type,
+          const size_t size_bound)
+  {
+    __reorder_state<Policy> s(ep, f, size_bound);
+
+    if (s.levels.size() < 2u) { return { s.dd, s.permutation() }; }
+
+    switch (r_type) {
+    case reorder_type::Sifting: __reorder_sifting(s); break;
+    case reorder_type::Window_2: __reorder_window<2u>(s); break;
+    case reorder_type::Window_3: __reorder_window<3u>(s); break;
+    }
+    return { s.dd, s.permutation() };
+  }
+}
+
+#endif // ADIAR_INTERNAL_ALGORITHMS_REORDER_H
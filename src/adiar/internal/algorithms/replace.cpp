@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::replace_t stats_replace;
+  thread_local thread_statistics<&statistics::replace> stats_replace;
 }
@@ -1,7 +1,10 @@
 #ifndef ADIAR_INTERNAL_ALGORITHMS_REPLACE_H
 #define ADIAR_INTERNAL_ALGORITHMS_REPLACE_H
 
+#include <algorithm>
+#include <limits>
 #include <type_traits>
+#include <vector>
 
 #include <adiar/exception.h>
 #include <adiar/functional.h>
@@ -9,18 +12,20 @@
 #include <adiar/types.h>
 
 #include <adiar/internal/algorithms/reduce.h>
+#include <adiar/internal/algorithms/reorder.h>
 #include <adiar/internal/assert.h>
 #include <adiar/internal/dd_func.h>
 #include <adiar/internal/io/levelized_ifstream.h>
 #include <adiar/internal/io/node_file.h>
 #include <adiar/internal/io/node_ifstream.h>
 #include <adiar/internal/io/node_ofstream.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::replace_t stats_replace;
+  extern thread_local thread_statistics<&statistics::replace> stats_replace;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Helper Functions
@@ -234,7 +239,185 @@ namespace adiar::internal
   }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  // TODO: Nested Sweeping for non-monotonic reorderings.
+  /// \brief Largest distance a level is moved with adjacent swaps, each of which is a linear sweep.
+  ///        Levels further away are moved with a single jump.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  constexpr size_t replace_max_swap_distance = 8u;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Positions on a longest increasing subsequence of `xs`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  std::vector<bool>
+  __replace__longest_increasing(const std::vector<T>& xs)
+  {
+    constexpr size_t none = std::numeric_limits<size_t>::max();
+
+    // Position of the last element of the best subsequence of each length and of each element's
+    // predecessor in the subsequence ending with it.
+    std::vector<size_t> tails;
+    std::vector<size_t> preds(xs.size(), none);
+
+    for (size_t i = 0u; i < xs.size(); ++i) {
+      const auto it = std::lower_bound(
+        tails.begin(), tails.end(), xs[i], [&xs](const size_t j, const T& x) { return xs[j] < x; });
+
+      if (it != tails.begin()) { preds[i] = *(it - 1); }
+      if (it == tails.end()) {
+        tails.push_back(i);
+      } else {
+        *it = i;
+      }
+    }
+
+    std::vector<bool> res(xs.size(), false);
+    for (size_t i = tails.empty() ? none : tails.back(); i != none; i = preds[i]) { res[i] = true; }
+    return res;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Move the variable on the level at position `from` to the one at position `to`, shifting
+  ///        all levels in-between by one position.
+  ///
+  /// \details The variable is first moved with adjacent swaps, as long as the distance is small and
+  ///          the swapped levels fit into internal memory. Otherwise, the rest of the way is one jump
+  ///          with `Policy::jump`, e.g. restricting the variable, relabelling both cofactors with a
+  ///          linear scan, and combining them again with an if-then-else. The latter uses
+  ///          O(sort(N)) I/Os independent of the distance and without the levels in memory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, typename T>
+  typename Policy::dd_type
+  __replace__move(const exec_policy& ep,
+                  typename Policy::dd_type dd,
+                  const std::vector<typename Policy::label_type>& levels,
+                  std::vector<T>& xs,
+                  size_t from,
+                  const size_t to)
+  {
+    using label_type = typename Policy::label_type;
+
+    const size_t distance = from < to ? to - from : from - to;
+    if (distance <= replace_max_swap_distance) {
+      while (from != to) {
+        const size_t next = from < to ? from + 1u : from - 1u;
+        const size_t i    = std::min(from, next);
+
+        if (!swap_adjacent_fits(dd)) { break; }
+        dd = swap_adjacent<Policy>(ep, dd, levels[i], levels[i + 1u]);
+        std::swap(xs[i], xs[i + 1u]);
+
+        from = next;
+      }
+    }
+    if (from == to) { return dd; }
+
+#ifdef ADIAR_STATS
+    stats_replace.level_jumps += 1u;
+#endif
+    const size_t lo = std::min(from, to);
+    const size_t hi = std::max(from, to);
+
+    const replace_func<Policy> shift_m = [&levels, from, to, lo, hi](const label_type x) {
+      const auto it = std::lower_bound(levels.begin(), levels.end(), x);
+      adiar_assert(it != levels.end() && *it == x, "Level should exist in the diagram");
+
+      const size_t i = static_cast<size_t>(it - levels.begin());
+      if (i < lo || hi < i) { return x; }
+      return from < to ? levels[i - 1u] : levels[i + 1u];
+    };
+    dd = Policy::jump(ep, dd, levels[from], levels[to], shift_m);
+
+    if (from < to) {
+      std::rotate(xs.begin() + from, xs.begin() + from + 1u, xs.begin() + to + 1u);
+    } else {
+      std::rotate(xs.begin() + to, xs.begin() + from, xs.begin() + from + 1u);
+    }
+    return dd;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Replace the level of all nodes by first moving the levels into the order of their
+  ///        targets and then relabelling them in a single linear scan.
+  ///
+  /// \details The levels on a longest increasing subsequence of the targets stay in place. Each
+  ///          other level is moved once (see `__replace__move`) to in-between the levels that
+  ///          already are in order. Afterwards, the levels are in the same order as their targets
+  ///          and so the remaining relabelling is *monotonic*.
+  ///
+  /// \throws invalid_argument If `m` maps two levels of `dd` to the same level.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy>
+  inline typename Policy::dd_type
+  __replace__non_monotonic(const exec_policy& ep,
+                           const typename Policy::dd_type& dd,
+                           const replace_func<Policy>& m)
+  {
+    adiar_assert(!dd->is_terminal());
+
+    using label_type = typename Policy::label_type;
+
+    std::vector<label_type> levels;
+    std::vector<label_type> targets;
+    {
+      level_info_ifstream<> ls(dd);
+      while (ls.can_pull()) {
+        const label_type l = ls.pull().level();
+        levels.push_back(l);
+        targets.push_back(m(l));
+      }
+    }
+
+    std::vector<label_type> sorted_targets(targets);
+    std::sort(sorted_targets.begin(), sorted_targets.end());
+    if (std::adjacent_find(sorted_targets.begin(), sorted_targets.end()) != sorted_targets.end()) {
+      throw invalid_argument("Variable replacement is not injective.");
+    }
+
+    // Pair each (current) position with its target and whether it already is in order.
+    std::vector<pair<label_type, bool>> xs;
+    {
+      const std::vector<bool> in_order = __replace__longest_increasing(targets);
+      for (size_t i = 0u; i < levels.size(); ++i) { xs.push_back({ targets[i], in_order[i] }); }
+    }
+
+    // Move the remaining levels in the order of their targets.
+    typename Policy::dd_type res = dd;
+    for (const label_type t : sorted_targets) {
+      const size_t from = static_cast<size_t>(
+        std::find_if(xs.begin(), xs.end(), [t](const auto& x) { return x.first == t; })
+        - xs.begin());
+
+      if (xs[from].second) { continue; }
+      xs[from].second = true;
+
+      // Positions of the levels in order with the largest smaller and the smallest larger target.
+      constexpr size_t none = std::numeric_limits<size_t>::max();
+
+      size_t below = none;
+      size_t above = none;
+      for (size_t i = 0u; i < xs.size(); ++i) {
+        if (!xs[i].second || i == from) { continue; }
+        if (xs[i].first < t) { below = i; }
+        if (t < xs[i].first && above == none) { above = i; }
+      }
+
+      // Move in-between them, i.e. right after the one below or right before the one above.
+      size_t to = from;
+      if (below != none && from < below) { to = below; }
+      if (above != none && above < from) { to = above; }
+      if (to == from) { continue; }
+
+      res = __replace__move<Policy>(ep, res, levels, xs, from, to);
+    }
+
+    // The i-th level is now to be relabelled to the i-th smallest target.
+    const replace_func<Policy> monotone_m = [&levels, &sorted_targets](const label_type x) {
+      const auto it = std::lower_bound(levels.begin(), levels.end(), x);
+      adiar_assert(it != levels.end() && *it == x, "Level should exist in the diagram");
+      return sorted_targets[static_cast<size_t>(it - levels.begin())];
+    };
+    return __replace__monotonic_scan<Policy>(res, monotone_m);
+  }
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // "Public" interface
@@ -244,7 +427,7 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename Policy>
   typename Policy::__dd_type
-  replace(const exec_policy& /*ep*/,
+  replace(const exec_policy& ep,
           const typename Policy::dd_type& dd,
           const replace_func<Policy>& m,
           replace_type m_type)
@@ -269,9 +452,9 @@ namespace adiar::internal
 
     case replace_type::Non_Monotone:
 #ifdef ADIAR_STATS
-      stats_replace.nested_sweeps += 1u;
+      stats_replace.level_moves += 1u;
 #endif
-      throw invalid_argument("Non-monotonic variable replacement not (yet) supported.");
+      return __replace__non_monotonic<Policy>(ep, dd, m);
 
     case replace_type::Monotone:
 #ifdef ADIAR_STATS
@@ -321,11 +504,11 @@ namespace adiar::internal
       adiar_unreachable();
       // LCOV_EXCL_STOP
 
-    case replace_type::Non_Monotone:
-#ifdef ADIAR_STATS
-      stats_replace.nested_sweeps += 1u;
-#endif
-      throw invalid_argument("Non-monotonic variable replacement not (yet) supported.");
+    case replace_type::Non_Monotone: {
+      // Reduce first, since the swaps need a canonical input.
+      const typename Policy::dd_type dd(std::move(__dd));
+      return replace<Policy>(ep, dd, m, m_type);
+    }
 
     case replace_type::Monotone:
     case replace_type::Shift:
@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::select_t stats_select;
+  thread_local thread_statistics<&statistics::select> stats_select;
 }
@@ -18,6 +18,7 @@
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/ifstream.h>
 #include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
@@ -44,7 +45,7 @@ namespace adiar::internal
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// Struct to hold statistics
-  extern statistics::select_t stats_select;
+  extern thread_local thread_statistics<&statistics::select> stats_select;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   // Data Structures
@@ -98,7 +99,7 @@ namespace adiar::internal
     node_ifstream<> ns(dd);
 
     // Set up priority queue with initial request to the root
-    PriorityQueue pq({ dd }, pq_memory, pq_max_size, stats_select.lpq);
+    PriorityQueue pq({ dd }, pq_memory, pq_max_size, stats_select.lpq, ep);
     {
       const node root = ns.peek();
       pq.push({ { root.uid() }, {}, { Policy::pointer_type::nil() } });
@@ -223,6 +224,12 @@ namespace adiar::internal
 #endif
       return __select<Policy, select_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Internal>>(
         ep, dd, policy, aux_available_memory, max_pq_size);
+    } else if (!external_only) {
+#ifdef ADIAR_STATS
+      stats_select.lpq.adaptive += 1u;
+#endif
+      return __select<Policy, select_priority_queue_t<ADIAR_LPQ_LOOKAHEAD, memory_mode::Adaptive>>(
+        ep, dd, policy, aux_available_memory, max_pq_size);
     } else {
 #ifdef ADIAR_STATS
       stats_select.lpq.external += 1u;
@@ -0,0 +1,427 @@
+#include "small.h"
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <limits>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <tpie/memory.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/cut.h>
+#include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/io/node_ofstream.h>
+
+namespace adiar::internal
+{
+  thread_local thread_statistics<&statistics::small> stats_small;
+
+  /// \cond
+  template <typename T>
+  using __small_vector = std::vector<T, tpie::allocator<T>>;
+
+  template <typename K, typename V, typename Compare = std::less<K>>
+  using __small_map = std::map<K, V, Compare, tpie::allocator<std::pair<const K, V>>>;
+
+  template <typename K, typename V, typename Hash = std::hash<K>>
+  using __small_table =
+    std::unordered_map<K, V, Hash, std::equal_to<K>, tpie::allocator<std::pair<const K, V>>>;
+  /// \endcond
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Unique table and memoization table of a single in-memory computation.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class small_manager
+  {
+  public:
+    using label_type = node::label_type;
+    using index_type = uint32_t;
+
+    /// \brief Index of the `false` terminal.
+    static constexpr index_type false_idx = 0u;
+
+    /// \brief Index of the `true` terminal.
+    static constexpr index_type true_idx = 1u;
+
+    /// \brief Marker for the node budget being exceeded.
+    static constexpr index_type overflow = std::numeric_limits<index_type>::max();
+
+  private:
+    /// \brief Label of the terminals, i.e. below all levels.
+    static constexpr label_type terminal_label = node::max_label + 1u;
+
+    /// \brief Opcode of `ite` in the memoization table (after all 16 binary operators).
+    static constexpr index_type ite_op = 16u;
+
+    /// \brief Opcode of `quantify` in the memoization table.
+    static constexpr index_type quantify_op = 17u;
+
+    struct node_type
+    {
+      label_type label;
+      index_type low;
+      index_type high;
+    };
+
+    using key_type = std::array<index_type, 4>;
+
+    struct key_hash
+    {
+      size_t
+      operator()(const key_type& k) const
+      {
+        size_t h = 0u;
+        for (const index_type x : k) { h = (h * 0x9E3779B97F4A7C15ull) ^ x; }
+        return h;
+      }
+    };
+
+  private:
+    /// \brief Maximum number of nodes (including the terminals).
+    const size_t _budget;
+
+    /// \brief All nodes with the terminals at index 0 and 1.
+    __small_vector<node_type> _nodes;
+
+    /// \brief Unique table, keyed by `{ label, low, high, 0 }`.
+    __small_table<key_type, index_type, key_hash> _unique;
+
+    /// \brief Memoization table, keyed by `{ opcode, operands... }`.
+    __small_table<key_type, index_type, key_hash> _memo;
+
+  public:
+    small_manager(const size_t budget)
+      : _budget(budget + 2u)
+    {
+      this->_nodes.push_back({ terminal_label, false_idx, false_idx });
+      this->_nodes.push_back({ terminal_label, true_idx, true_idx });
+    }
+
+    ~small_manager()
+    {
+#ifdef ADIAR_STATS
+      stats_small.nodes += this->_nodes.size() - 2u;
+#endif
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Find or create the node `(label, low, high)`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    index_type
+    make_node(const label_type label, const index_type low, const index_type high)
+    {
+      if (low == overflow || high == overflow) { return overflow; }
+      if (low == high) { return low; }
+
+      const key_type key{ label, low, high, 0u };
+      const auto it = this->_unique.find(key);
+      if (it != this->_unique.end()) { return it->second; }
+
+      if (this->_budget <= this->_nodes.size()) { return overflow; }
+
+      const index_type idx = static_cast<index_type>(this->_nodes.size());
+      this->_nodes.push_back({ label, low, high });
+      this->_unique.insert({ key, idx });
+      return idx;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Copy a (reduced) decision diagram into the unique table.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    index_type
+    import(const dd& f)
+    {
+      __small_map<node::pointer_type, index_type> indices;
+
+      const auto index_of = [&indices](const node::pointer_type& p) -> index_type {
+        if (p.is_terminal()) { return p.value() ? true_idx : false_idx; }
+        adiar_assert(indices.find(essential(p)) != indices.end(), "Child should be imported");
+        return indices.at(essential(p));
+      };
+
+      node_ifstream<true> in(f);
+      index_type root = false_idx;
+
+      while (in.can_pull()) {
+        const node n = in.pull();
+        if (n.is_terminal()) { return n.value() ? true_idx : false_idx; }
+
+        root = make_node(n.label(), index_of(n.low()), index_of(n.high()));
+        if (root == overflow) { return overflow; }
+
+        indices.insert({ essential(n.uid()), root });
+      }
+      return root;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Product construction with the binary operator given by its truth table.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    index_type
+    apply(const index_type f, const index_type g, const index_type truth_table)
+    {
+      if (f == overflow || g == overflow) { return overflow; }
+
+      const bool f_terminal = is_terminal(f);
+      const bool g_terminal = is_terminal(g);
+
+      if (f_terminal && g_terminal) { return eval(truth_table, f, g); }
+
+      // Shortcut on a terminal making the operator constant or the identity on the other side.
+      if (f_terminal) {
+        const index_type on_false = eval(truth_table, f, false_idx);
+        const index_type on_true  = eval(truth_table, f, true_idx);
+        if (on_false == on_true) { return on_false; }
+        if (on_true == true_idx) { return g; }
+      }
+      if (g_terminal) {
+        const index_type on_false = eval(truth_table, false_idx, g);
+        const index_type on_true  = eval(truth_table, true_idx, g);
+        if (on_false == on_true) { return on_false; }
+        if (on_true == true_idx) { return f; }
+      }
+
+      const key_type key{ truth_table, f, g, 0u };
+      const auto it = this->_memo.find(key);
+      if (it != this->_memo.end()) { return it->second; }
+
+      const label_type label = std::min(this->label_of(f), this->label_of(g));
+
+      const index_type low =
+        this->apply(this->low_of(f, label), this->low_of(g, label), truth_table);
+      if (low == overflow) { return overflow; }
+
+      const index_type high =
+        this->apply(this->high_of(f, label), this->high_of(g, label), truth_table);
+
+      const index_type res = this->make_node(label, low, high);
+      if (res != overflow) { this->_memo.insert({ key, res }); }
+      return res;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief If-Then-Else.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    index_type
+    ite(const index_type f, const index_type g, const index_type h)
+    {
+      if (f == overflow || g == overflow || h == overflow) { return overflow; }
+
+      if (f == true_idx || g == h) { return g; }
+      if (f == false_idx) { return h; }
+      if (g == true_idx && h == false_idx) { return f; }
+
+      const key_type key{ ite_op, f, g, h };
+      const auto it = this->_memo.find(key);
+      if (it != this->_memo.end()) { return it->second; }
+
+      const label_type label =
+        std::min({ this->label_of(f), this->label_of(g), this->label_of(h) });
+
+      const index_type low = this->ite(
+        this->low_of(f, label), this->low_of(g, label), this->low_of(h, label));
+      if (low == overflow) { return overflow; }
+
+      const index_type high = this->ite(
+        this->high_of(f, label), this->high_of(g, label), this->high_of(h, label));
+
+      const index_type res = this->make_node(label, low, high);
+      if (res != overflow) { this->_memo.insert({ key, res }); }
+      return res;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Quantify all levels in `vars` by combining both children with the given operator.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    index_type
+    quantify(const index_type f,
+             const predicate<label_type>& vars,
+             const index_type truth_table,
+             __small_table<label_type, bool>& vars_cache)
+    {
+      if (f == overflow || is_terminal(f)) { return f; }
+
+      const key_type key{ quantify_op, f, truth_table, 0u };
+      const auto it = this->_memo.find(key);
+      if (it != this->_memo.end()) { return it->second; }
+
+      const label_type label = this->label_of(f);
+
+      const index_type low = this->quantify(this->_nodes[f].low, vars, truth_table, vars_cache);
+      if (low == overflow) { return overflow; }
+
+      const index_type high = this->quantify(this->_nodes[f].high, vars, truth_table, vars_cache);
+
+      auto vars_it = vars_cache.find(label);
+      if (vars_it == vars_cache.end()) {
+        vars_it = vars_cache.insert({ label, vars(label) }).first;
+      }
+
+      const index_type res = vars_it->second ? this->apply(low, high, truth_table)
+                                             : this->make_node(label, low, high);
+      if (res != overflow) { this->_memo.insert({ key, res }); }
+      return res;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Write the diagram rooted in `root` to a node file in canonical order.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    shared_levelized_file<node>
+    export_file(const index_type root) const
+    {
+      adiar_assert(root != overflow, "Cannot export an aborted computation");
+
+      shared_levelized_file<node> nf;
+      node_ofstream nw(nf);
+
+      if (is_terminal(root)) {
+        nw << node(root == true_idx);
+        return nf;
+      }
+
+      // Collect all reachable nodes per level (deepest level first).
+      __small_map<label_type, __small_vector<index_type>, std::greater<label_type>> levels;
+      {
+        __small_vector<bool> visited(this->_nodes.size(), false);
+        __small_vector<index_type> stack{ root };
+        visited[root] = true;
+
+        while (!stack.empty()) {
+          const index_type i = stack.back();
+          stack.pop_back();
+
+          levels[this->_nodes[i].label].push_back(i);
+
+          for (const index_type c : { this->_nodes[i].low, this->_nodes[i].high }) {
+            if (!is_terminal(c) && !visited[c]) {
+              visited[c] = true;
+              stack.push_back(c);
+            }
+          }
+        }
+      }
+
+      // Output each level bottom-up in canonical order.
+      __small_vector<node::pointer_type> pointers(this->_nodes.size(), node::pointer_type::nil());
+      pointers[false_idx] = node::pointer_type(false);
+      pointers[true_idx]  = node::pointer_type(true);
+
+      for (auto& [label, level] : levels) {
+        nw.push_level(
+          label,
+          level.begin(),
+          level.end(),
+          [this, &pointers](const index_type i) {
+            return node::children_type(pointers[this->_nodes[i].low],
+                                       pointers[this->_nodes[i].high]);
+          },
+          [&pointers](const index_type i, const node::uid_type& u) { pointers[i] = u; });
+      }
+
+      return nf;
+    }
+
+  private:
+    static bool
+    is_terminal(const index_type i)
+    {
+      return i == false_idx || i == true_idx;
+    }
+
+    static index_type
+    eval(const index_type truth_table, const index_type a, const index_type b)
+    {
+      const index_type bit = ((a == true_idx) << 1u) | (b == true_idx);
+      return (truth_table >> bit) & 1u ? true_idx : false_idx;
+    }
+
+    label_type
+    label_of(const index_type i) const
+    {
+      return this->_nodes[i].label;
+    }
+
+    index_type
+    low_of(const index_type i, const label_type label) const
+    {
+      return this->_nodes[i].label == label ? this->_nodes[i].low : i;
+    }
+
+    index_type
+    high_of(const index_type i, const label_type label) const
+    {
+      return this->_nodes[i].label == label ? this->_nodes[i].high : i;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  small_fits(const exec_policy& ep, const dd& f)
+  {
+    const size_t threshold = ep.get<exec_policy::small_threshold>().value();
+    return 0u < threshold && f.size() <= threshold && f.max_2level_cut(cut::All) <= threshold;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Run an in-memory computation and export its result (unless aborted).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename F>
+  optional<shared_levelized_file<node>>
+  __small_run(const exec_policy& ep, const F& f)
+  {
+#ifdef ADIAR_STATS
+    stats_small.runs += 1u;
+#endif
+    const size_t threshold = ep.get<exec_policy::small_threshold>().value();
+    small_manager mgr(threshold * small_budget_factor);
+
+    const small_manager::index_type root = f(mgr);
+    if (root == small_manager::overflow) {
+#ifdef ADIAR_STATS
+      stats_small.aborted += 1u;
+#endif
+      return {};
+    }
+    return mgr.export_file(root);
+  }
+
+  optional<shared_levelized_file<node>>
+  small_apply(const exec_policy& ep, const dd& f, const dd& g, const uint64_t truth_table)
+  {
+    if (!small_fits(ep, f) || !small_fits(ep, g)) { return {}; }
+
+    return __small_run(ep, [&f, &g, truth_table](small_manager& mgr) {
+      return mgr.apply(
+        mgr.import(f), mgr.import(g), static_cast<small_manager::index_type>(truth_table));
+    });
+  }
+
+  optional<shared_levelized_file<node>>
+  small_ite(const exec_policy& ep, const dd& f, const dd& g, const dd& h)
+  {
+    if (!small_fits(ep, f) || !small_fits(ep, g) || !small_fits(ep, h)) { return {}; }
+
+    return __small_run(ep, [&f, &g, &h](small_manager& mgr) {
+      return mgr.ite(mgr.import(f), mgr.import(g), mgr.import(h));
+    });
+  }
+
+  optional<shared_levelized_file<node>>
+  small_quantify(const exec_policy& ep,
+                 const dd& f,
+                 const predicate<dd::label_type>& vars,
+                 const uint64_t truth_table)
+  {
+    if (!small_fits(ep, f)) { return {}; }
+
+    return __small_run(ep, [&f, &vars, truth_table](small_manager& mgr) {
+      __small_table<dd::label_type, bool> vars_cache;
+      return mgr.quantify(
+        mgr.import(f), vars, static_cast<small_manager::index_type>(truth_table), vars_cache);
+    });
+  }
+}
@@ -0,0 +1,83 @@
+#ifndef ADIAR_INTERNAL_ALGORITHMS_SMALL_H
+#define ADIAR_INTERNAL_ALGORITHMS_SMALL_H
+
+#include <cstdint>
+
+#include <adiar/exec_policy.h>
+#include <adiar/functional.h>
+
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/dd.h>
+#include <adiar/internal/io/node_file.h>
+#include <adiar/internal/statistics.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  //  In-memory Algorithms for Small Decision Diagrams
+  // ==================================================
+  //
+  // For very small decision diagrams, the overhead of Adiar's time-forward processing (temporary
+  // files, priority queues, and sorters) dominates the actual work. Hence, if all inputs are at
+  // most `exec_policy::small_threshold` in size, the operation is instead computed with the
+  // conventional depth-first recursion with a unique table and a memoization table. The result is
+  // afterwards written to a node file in the canonical order.
+  //
+  // The number of nodes in the unique table is bounded by `small_budget_factor` times the
+  // threshold. If this budget is exceeded, then the computation is aborted and the caller is
+  // expected to fall back to the usual algorithm.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// Struct to hold statistics
+  extern thread_local thread_statistics<&statistics::small> stats_small;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Factor of `exec_policy::small_threshold` for the number of nodes that may be created
+  ///        before an in-memory computation is aborted.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  constexpr size_t small_budget_factor = 16u;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether a decision diagram is small enough to be processed in internal memory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  bool
+  small_fits(const exec_policy& ep, const dd& f);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Product construction of two small decision diagrams.
+  ///
+  /// \param truth_table Binary operator where bit `2a+b` is its value on `(a,b)`.
+  ///
+  /// \returns The canonical result or nothing if the inputs are not small or the computation was
+  ///          aborted.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  optional<shared_levelized_file<node>>
+  small_apply(const exec_policy& ep, const dd& f, const dd& g, const uint64_t truth_table);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief If-Then-Else of three small decision diagrams.
+  ///
+  /// \returns The canonical result or nothing if the inputs are not small or the computation was
+  ///          aborted.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  optional<shared_levelized_file<node>>
+  small_ite(const exec_policy& ep, const dd& f, const dd& g, const dd& h);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Quantification of all levels of a small decision diagram that satisfy a predicate.
+  ///
+  /// \param truth_table Binary operator to combine both children of a quantified node, i.e.
+  ///                    `or` for existential and `and` for universal quantification.
+  ///
+  /// \returns The canonical result or nothing if the input is not small or the computation was
+  ///          aborted.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  optional<shared_levelized_file<node>>
+  small_quantify(const exec_policy& ep,
+                 const dd& f,
+                 const predicate<dd::label_type>& vars,
+                 const uint64_t truth_table);
+}
+
+#endif // ADIAR_INTERNAL_ALGORITHMS_SMALL_H
@@ -101,10 +101,11 @@ namespace adiar::internal
 
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <bool Reverse = false>
     class level_info_istream : public istream
     {
     private:
-      level_info_ifstream<> _ifstream;
+      level_info_ifstream<Reverse> _ifstream;
 
     public:
       template <typename T>
@@ -152,24 +153,35 @@ namespace adiar::internal
     public:
       /// \brief Conversion for reduced diagrams (top-down).
       istream_ptr(const dd& diagram)
-        : _ptr(adiar::make_unique<level_info_istream>(diagram))
+        : _ptr(adiar::make_unique<level_info_istream<>>(diagram))
       {}
 
       /// \brief Conversion for unreduced diagrams (bottom-up).
+      ///
+      /// \details The levels of an arc file are stored in the opposite order of the ones of a node
+      ///          file. Hence, if the levels are merged top-down, e.g. when an unreduced diagram is
+      ///          piped into a product construction, they need to be read in reverse.
       istream_ptr(const __dd& diagram)
-        : _ptr(adiar::make_unique<level_info_istream>(diagram))
-      {}
+      {
+        constexpr bool top_down = Comp()(0u, 1u);
+
+        if (top_down && diagram.template has<__dd::shared_arc_file_type>()) {
+          this->_ptr = adiar::make_unique<level_info_istream<true>>(diagram);
+        } else {
+          this->_ptr = adiar::make_unique<level_info_istream<>>(diagram);
+        }
+      }
 
       /// \brief Conversion for files with levels
       template <typename T>
       istream_ptr(const levelized_file<T>& f)
-        : _ptr(adiar::make_unique<level_info_istream>(f))
+        : _ptr(adiar::make_unique<level_info_istream<>>(f))
       {}
 
       /// \brief Conversion for files with levels
       template <typename T>
       istream_ptr(const shared_ptr<levelized_file<T>>& f)
-        : _ptr(adiar::make_unique<level_info_istream>(f))
+        : _ptr(adiar::make_unique<level_info_istream<>>(f))
       {}
 
       /// \brief Conversion for generators. This requires the addition of an intermediate lambda
@@ -2,5 +2,6 @@
 
 namespace adiar::internal
 {
-  statistics::levelized_priority_queue_t stats_levelized_priority_queue;
+  thread_local thread_statistics<&statistics::levelized_priority_queue>
+    stats_levelized_priority_queue;
 }
@@ -1,18 +1,25 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_LEVELIZED_PRIORITY_QUEUE_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_LEVELIZED_PRIORITY_QUEUE_H
 
+#include <condition_variable>
 #include <limits>
+#include <mutex>
+#include <thread>
+#include <type_traits>
 
-#include <adiar/statistics.h>
+#include <adiar/exec_policy.h>
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/data_structures/level_merger.h>
 #include <adiar/internal/data_structures/priority_queue.h>
+#include <adiar/internal/data_structures/radix_priority_queue.h>
 #include <adiar/internal/data_structures/sorter.h>
 #include <adiar/internal/dd.h>
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/shared_file_ptr.h>
 #include <adiar/internal/memory.h>
+#include <adiar/internal/parallel.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
@@ -58,10 +65,17 @@ namespace adiar::internal
 #define ADIAR_LPQ_LOOKAHEAD 1u
 #endif
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Minimum number of (yet unsorted) elements in the next bucket before the helper thread
+  ///        is asked to sort them ahead of time.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  constexpr size_t sort_ahead_min_elements = 1024u;
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Struct holding statistics on the levelized priority queue
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  extern statistics::levelized_priority_queue_t stats_levelized_priority_queue;
+  extern thread_local thread_statistics<&statistics::levelized_priority_queue>
+    stats_levelized_priority_queue;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief   Levelized Priority Queue with a finite circular array of sorters and an overflow
@@ -92,6 +106,10 @@ namespace adiar::internal
   ///
   /// \tparam LevelSkip      The index for the first level one can push to. In other words, the
   ///                        number of levels to 'skip'.
+  ///
+  /// \tparam OverflowQueue  Type of the overflow priority queue. In the 'Internal' memory mode,
+  ///                        this may be replaced with a `radix_priority_queue` for elements with
+  ///                        a (level-major) integer key.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename T,
             typename Comp          = std::less<>,
@@ -99,7 +117,8 @@ namespace adiar::internal
             memory_mode MemoryMode = memory_mode::External,
             size_t LevelInputs     = 1u,
             typename LevelComp     = std::less<>,
-            size_t LevelSkip       = 1u>
+            size_t LevelSkip       = 1u,
+            typename OverflowQueue = priority_queue<MemoryMode, T, Comp>>
   class levelized_priority_queue
   {
   public:
@@ -130,7 +149,16 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Type of the overflow priority queue.
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    using priority_queue_t = priority_queue<MemoryMode, value_type, value_comp_type>;
+    using priority_queue_t = OverflowQueue;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the overflow priority queue in the 'Internal' memory mode (to derive the
+    ///        memory usage from).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using internal_priority_queue_t =
+      std::conditional_t<MemoryMode == memory_mode::Internal,
+                         priority_queue_t,
+                         priority_queue<memory_mode::Internal, value_type, value_comp_type>>;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Type of the level merger.
@@ -163,6 +191,10 @@ namespace adiar::internal
   private:
     static_assert(0 < LookAhead, "LookAhead must at least be of one level");
 
+    static_assert(MemoryMode == memory_mode::Internal
+                    || std::is_same_v<OverflowQueue, priority_queue<MemoryMode, T, Comp>>,
+                  "Only the 'Internal' memory mode supports another overflow queue");
+
     static_assert(0 < ptr_uint64::max_label, "A larger LookAhead than max_label is wasteful");
 
     static_assert(buckets < out_of_buckets_idx,
@@ -186,8 +218,7 @@ namespace adiar::internal
     static size_t
     memory_usage(size_t no_elements)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_usage(
-               no_elements)
+      return internal_priority_queue_t::memory_usage(no_elements)
         + buckets
         * sorter<memory_mode::Internal, value_type, value_comp_type>::memory_usage(no_elements)
         + const_memory_usage();
@@ -210,8 +241,7 @@ namespace adiar::internal
           memory_per_data_structure);
 
       const size_t priority_queue_fits =
-        priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_fits(
-          memory_per_data_structure);
+        internal_priority_queue_t::memory_fits(memory_per_data_structure);
 
       const size_t res = std::min(sorter_fits, priority_queue_fits);
       adiar_assert(memory_usage(res) <= memory_bytes, "memory_fits and memory_usage should agree.");
@@ -317,12 +347,47 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     priority_queue_t _overflow_queue;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a helper thread sorts the next bucket while the current level is processed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _sort_ahead = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Buffer to merge newly sorted elements with the already sorted ones of a bucket.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<value_type> _sort_ahead_buffer;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Size of the next bucket at which to (again) hand it to the helper thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _sort_ahead_threshold = sort_ahead_min_elements;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The bucket the helper thread currently sorts (if any) and up to which element.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    sorter_t* _sort_ahead_bucket = nullptr;
+    size_t _sort_ahead_end       = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the helper thread should terminate.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _sort_ahead_stop = false;
+
+    std::mutex _sort_ahead_mutex;
+    std::condition_variable _sort_ahead_cv;
+    std::thread _sort_ahead_thread;
+
 #ifdef ADIAR_STATS
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The actual maximum size of the levelized priority queue.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     size_t _actual_max_size = 0u;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements handed to the helper thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _sort_ahead_elements = 0u;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Reference to struct to store non-global stats into.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,10 +408,11 @@ namespace adiar::internal
       // GCC bug 85282: One cannot do a member class specialization of each of
       // the two following cases. So, we will have to resort to a constexpr
       // if-statement instead.
-      if constexpr (mem_mode == memory_mode::Internal) {
+      if constexpr (mem_mode == memory_mode::Internal || mem_mode == memory_mode::Adaptive) {
         // -----------------------------------------------------------------------------------------
-        // Internal MEMORY MODE:
-        //   Divide memory in equal parts
+        // Internal (and Adaptive) MEMORY MODE:
+        //   Divide memory in equal parts. This way, an adaptive data structure only is moved to
+        //   external memory if it outgrows what it could have had in the internal memory mode.
 
         return memory_given / data_structures;
       } else if constexpr (mem_mode == memory_mode::External) {
@@ -362,7 +428,7 @@ namespace adiar::internal
       } else {
         // -----------------------------------------------------------------------------------------
         static_assert(mem_mode == memory_mode::Internal && mem_mode == memory_mode::External,
-                      "Memory mode must be 'Internal' or 'EXTERNAL' at compile-time");
+                      "Memory mode must be 'Internal', 'External', or 'Adaptive' at compile-time");
       }
     }
 
@@ -385,11 +451,16 @@ namespace adiar::internal
     /// \param memory_given Total amount of memory to use
     ///
     /// \param max_size     Upper bound on the number of elements placed in the priority queue.
+    ///
+    /// \param ep           Execution policy. With more than one thread, the buckets of an internal
+    ///                     memory queue are sorted ahead of time by a helper thread (if there is
+    ///                     memory left over for it).
     ////////////////////////////////////////////////////////////////////////////////////////////////
     levelized_priority_queue(std::array<level_input_type, LevelInputs>&& level_inputs,
                              size_t memory_given,
                              size_t max_size,
-                             [[maybe_unused]] statistics::levelized_priority_queue_t& stats)
+                             [[maybe_unused]] statistics::levelized_priority_queue_t& stats,
+                             [[maybe_unused]] const exec_policy& ep = exec_policy())
       : _max_size(max_size)
       , _memory_given(memory_given)
       , _memory_for_buckets(memory_given - _memory_occupied_by_merger
@@ -423,13 +494,49 @@ namespace adiar::internal
         _buckets_sorter[_back_bucket_idx] =
           sorter_t::make_unique(_memory_for_buckets, _max_size, buckets);
       }
+
+      // The merge buffer for the helper thread may only use what is left over by the buckets and
+      // the overflow queue. Only the internal sorter can be sorted in parts.
+      if constexpr (mem_mode == memory_mode::Internal) {
+        const size_t buffer_memory = tpie::array<value_type>::memory_usage(_max_size);
+
+        _sort_ahead =
+          1u < worker_threads(ep) && memory_usage(_max_size) + buffer_memory <= _memory_given;
+
+        if (_sort_ahead) {
+          _sort_ahead_buffer.resize(_max_size);
+          _sort_ahead_thread = helper_thread(&levelized_priority_queue::sort_ahead_run, this);
+        }
+      }
     }
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     ~levelized_priority_queue()
     {
+      if (_sort_ahead) {
+        {
+          std::lock_guard<std::mutex> lock(_sort_ahead_mutex);
+          _sort_ahead_stop = true;
+        }
+        _sort_ahead_cv.notify_all();
+        _sort_ahead_thread.join();
+      }
+
 #ifdef ADIAR_STATS
+      if (_sort_ahead) {
+        const size_t buffer_memory = tpie::array<value_type>::memory_usage(_max_size);
+
+        stats_levelized_priority_queue.sort_ahead += 1u;
+        _stats.sort_ahead += 1u;
+
+        stats_levelized_priority_queue.sort_ahead_memory += buffer_memory;
+        _stats.sort_ahead_memory += buffer_memory;
+
+        stats_levelized_priority_queue.sort_ahead_elements += _sort_ahead_elements;
+        _stats.sort_ahead_elements += _sort_ahead_elements;
+      }
+
       stats_levelized_priority_queue.sum_predicted_max_size += _max_size;
       _stats.sum_predicted_max_size += _max_size;
 
@@ -528,6 +635,7 @@ namespace adiar::internal
           stats_levelized_priority_queue.push_bucket += 1u;
           _stats.push_bucket += 1u;
 #endif
+          if (_sort_ahead) { sort_ahead(); }
           return;
         }
       } while (bucket_offset <= pushable_buckets);
@@ -559,6 +667,9 @@ namespace adiar::internal
       adiar_assert(stop_level != no_label || !empty(),
                    "Either a stop level is given or we have some non-empty level to forward to");
 
+      // The helper thread is not allowed to touch any buckets while these are being moved.
+      if (_sort_ahead) { sort_ahead_wait(); }
+
       const ptr_uint64::label_type overflow_level =
         !_overflow_queue.empty() ? _overflow_queue.top().level() : stop_level;
 
@@ -598,13 +709,18 @@ namespace adiar::internal
         adiar_assert(has_stop_level, "Must have a 'stop_level' to go to");
 
         relabel_buckets(stop_level);
-        return;
+      } else {
+        // Primary Case: ------------------------------------------------------------------------- :
+        //   At least one bucket contains an element. Let us go through each
+        //   bucket one-by-one until we find the one or hit the stop_level.
+        forward_to_nonempty_bucket(stop_level, has_stop_level);
       }
 
-      // Primary Case: --------------------------------------------------------------------------- :
-      //   At least one bucket contains an element. Let us go through each
-      //   bucket one-by-one until we find the one or hit the stop_level.
-      forward_to_nonempty_bucket(stop_level, has_stop_level);
+      // Start anew on sorting the (possibly new) next bucket ahead of time.
+      if (_sort_ahead) {
+        _sort_ahead_threshold = sort_ahead_min_elements;
+        sort_ahead();
+      }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -867,8 +983,12 @@ namespace adiar::internal
                        || front_bucket_level() == back_bucket_level(),
                      "Inconsistency in has_next_bucket predicate");
 
-        // Sort front bucket
-        _buckets_sorter[_front_bucket_idx]->sort();
+        // Sort front bucket (merging with what the helper thread already has sorted)
+        if constexpr (mem_mode == memory_mode::Internal) {
+          _buckets_sorter[_front_bucket_idx]->sort(_sort_ahead_buffer.get());
+        } else {
+          _buckets_sorter[_front_bucket_idx]->sort();
+        }
 
         _has_next_from_bucket = _buckets_sorter[_front_bucket_idx]->can_pull();
         if (_has_next_from_bucket) {
@@ -956,6 +1076,82 @@ namespace adiar::internal
         // unique_ptr, but we will leave that for the destructor to do.
       }
     }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Hand the next bucket to the helper thread, if it has grown enough since last time.
+    ///
+    /// \details Once the next bucket has become the current one, no more elements are pushed to
+    ///          it. Until then, the helper thread sorts what has been pushed so far and merges it
+    ///          with what it sorted before. To keep the merges at an amortized linear cost, the
+    ///          bucket is only handed over again once it has grown by half.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline void
+    sort_ahead()
+    {
+      adiar_assert(_sort_ahead, "Sorting ahead must be enabled");
+
+      if (!has_next_bucket()) { return; }
+
+      sorter_t* next_bucket = _buckets_sorter[(_front_bucket_idx + 1) % buckets].get();
+
+      const size_t next_size = next_bucket->size();
+      if (next_size < _sort_ahead_threshold) { return; }
+
+      std::lock_guard<std::mutex> lock(_sort_ahead_mutex);
+      if (_sort_ahead_bucket != nullptr) {
+        // Helper thread is still busy; check again later.
+        _sort_ahead_threshold = next_size + sort_ahead_min_elements;
+        return;
+      }
+
+#ifdef ADIAR_STATS
+      if constexpr (mem_mode == memory_mode::Internal) {
+        _sort_ahead_elements += next_size - next_bucket->presorted();
+      }
+#endif
+      _sort_ahead_bucket    = next_bucket;
+      _sort_ahead_end       = next_size;
+      _sort_ahead_threshold = next_size + std::max(sort_ahead_min_elements, next_size / 2);
+
+      _sort_ahead_cv.notify_all();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Wait for the helper thread to be done with its current bucket (if any).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline void
+    sort_ahead_wait()
+    {
+      std::unique_lock<std::mutex> lock(_sort_ahead_mutex);
+      _sort_ahead_cv.wait(lock, [this]() { return _sort_ahead_bucket == nullptr; });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the helper thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    sort_ahead_run()
+    {
+      std::unique_lock<std::mutex> lock(_sort_ahead_mutex);
+      while (true) {
+        _sort_ahead_cv.wait(lock,
+                            [this]() { return _sort_ahead_bucket != nullptr || _sort_ahead_stop; });
+        if (_sort_ahead_bucket == nullptr) { break; }
+
+        sorter_t* bucket = _sort_ahead_bucket;
+        const size_t end = _sort_ahead_end;
+
+        // Elements past 'end' are still being pushed. Yet, these are not touched while sorting.
+        lock.unlock();
+        if constexpr (mem_mode == memory_mode::Internal) {
+          bucket->presort(end, _sort_ahead_buffer.get());
+        }
+        lock.lock();
+
+        _sort_ahead_bucket = nullptr;
+        _sort_ahead_cv.notify_all();
+      }
+    }
   };
 
   ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -967,14 +1163,16 @@ namespace adiar::internal
             memory_mode MemoryMode,
             size_t LevelInputs,
             typename LevelComp,
-            size_t LevelSkip>
+            size_t LevelSkip,
+            typename OverflowQueue>
   class levelized_priority_queue<T,
                                  Comp,
                                  0u, // <--
                                  MemoryMode,
                                  LevelInputs,
                                  LevelComp,
-                                 LevelSkip>
+                                 LevelSkip,
+                                 OverflowQueue>
   {
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1003,7 +1201,16 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Type of the (overflow) priority queue.
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    using priority_queue_t = priority_queue<mem_mode, value_type, value_comp_type>;
+    using priority_queue_t = OverflowQueue;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the priority queue in the 'Internal' memory mode (to derive the memory usage
+    ///        from).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using internal_priority_queue_t =
+      std::conditional_t<MemoryMode == memory_mode::Internal,
+                         priority_queue_t,
+                         priority_queue<memory_mode::Internal, value_type, value_comp_type>>;
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1025,15 +1232,13 @@ namespace adiar::internal
     static size_t
     memory_usage(size_t no_elements)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_usage(
-        no_elements);
+      return internal_priority_queue_t::memory_usage(no_elements);
     }
 
     static size_t
     memory_fits(size_t memory_bytes)
     {
-      return priority_queue<memory_mode::Internal, value_type, value_comp_type>::memory_fits(
-        memory_bytes);
+      return internal_priority_queue_t::memory_fits(memory_bytes);
     }
 
   private:
@@ -1085,12 +1290,16 @@ namespace adiar::internal
     /// \brief              Instantiate with the given amount of memory.
     ///
     /// \param memory_given Total amount of memory to use.
+    ///
+    /// \remark             Without any buckets, there is nothing to sort ahead of time. Hence, the
+    ///                     execution policy is ignored.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     levelized_priority_queue(
       std::array<typename level_merger<LevelComp, LevelInputs>::istream_ptr, LevelInputs>&&,
       size_t memory_given,
       size_t max_size,
-      [[maybe_unused]] statistics::levelized_priority_queue_t& stats)
+      [[maybe_unused]] statistics::levelized_priority_queue_t& stats,
+      const exec_policy& /*ep*/ = exec_policy())
       : _max_size(max_size)
       , _memory_given(memory_given)
       , _priority_queue(memory_given, max_size)
@@ -1211,8 +1420,9 @@ namespace adiar::internal
 
       // Edge Case: ------------------------------------------------------------------------------ :
       //   The given stop_level is prior to the next level or there is nothing in the queue
-      if ((has_stop_level && level_cmp_lt<LevelComp>(stop_level, next_level(), _level_comparator))
-          || _priority_queue.empty()) {
+      if (_priority_queue.empty()
+          || (has_stop_level
+              && level_cmp_lt<LevelComp>(stop_level, next_level(), _level_comparator))) {
         _current_level = stop_level;
         return;
       }
@@ -1350,35 +1560,39 @@ namespace adiar::internal
   ///        or `node_raccess`.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename T,
-            typename Comp        = std::less<T>,
-            size_t LookAhead     = ADIAR_LPQ_LOOKAHEAD,
-            memory_mode mem_mode = memory_mode::External,
-            size_t LevelInputs   = 1u,
-            size_t LevelSkip     = 1u>
+            typename Comp          = std::less<T>,
+            size_t LookAhead       = ADIAR_LPQ_LOOKAHEAD,
+            memory_mode mem_mode   = memory_mode::External,
+            size_t LevelInputs     = 1u,
+            size_t LevelSkip       = 1u,
+            typename OverflowQueue = priority_queue<mem_mode, T, Comp>>
   using levelized_node_priority_queue = levelized_priority_queue<T,
                                                                  Comp,
                                                                  LookAhead,
                                                                  mem_mode,
                                                                  LevelInputs,
                                                                  std::less<node::label_type>,
-                                                                 LevelSkip>;
+                                                                 LevelSkip,
+                                                                 OverflowQueue>;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Levelized Priority Queue to be used with `levelized_file<arc>` and an `arc_ifstream`.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename T,
-            typename Comp        = std::less<T>,
-            size_t LookAhead     = ADIAR_LPQ_LOOKAHEAD,
-            memory_mode mem_mode = memory_mode::External,
-            size_t LevelInputs   = 1u,
-            size_t LevelSkip     = 1u>
+            typename Comp          = std::less<T>,
+            size_t LookAhead       = ADIAR_LPQ_LOOKAHEAD,
+            memory_mode mem_mode   = memory_mode::External,
+            size_t LevelInputs     = 1u,
+            size_t LevelSkip       = 1u,
+            typename OverflowQueue = priority_queue<mem_mode, T, Comp>>
   using levelized_arc_priority_queue = levelized_priority_queue<T,
                                                                 Comp,
                                                                 LookAhead,
                                                                 mem_mode,
                                                                 LevelInputs,
                                                                 std::greater<arc::label_type>,
-                                                                LevelSkip>;
+                                                                LevelSkip,
+                                                                OverflowQueue>;
 }
 
 #endif // ADIAR_INTERNAL_DATA_STRUCTURES_LEVELIZED_PRIORITY_QUEUE_H
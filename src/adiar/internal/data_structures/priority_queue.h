@@ -1,8 +1,10 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_PRIORITY_QUEUE_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_PRIORITY_QUEUE_H
 
+#include <algorithm>
 #include <functional>
 
+#include <tpie/file_stream.h>
 #include <tpie/priority_queue.h>
 #include <tpie/tpie.h>
 
@@ -159,6 +161,133 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////
   template <typename T, typename Comp = std::less<T>>
   using external_priority_queue = priority_queue<memory_mode::External, T, Comp>;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Internal binary heap that moves its content over to TPIE's
+  ///        external priority queue, if it outgrows its memory.
+  ///
+  /// \details The internal heap only is given as much memory as `max_size`
+  ///          many elements need (or all of the memory if that is less). It
+  ///          only spills over to the external priority queue when an element
+  ///          is pushed beyond that. From then on, all elements stay there.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp>
+  class priority_queue<memory_mode::Adaptive, T, Comp>
+  {
+  public:
+    static constexpr size_t data_structures = 1u;
+
+    using value_type = T;
+
+  private:
+    using internal_pq_type = priority_queue<memory_mode::Internal, value_type, Comp>;
+    using external_pq_type = priority_queue<memory_mode::External, value_type, Comp>;
+
+    size_t _memory_bytes;
+    size_t _max_size;
+
+    /// \brief Number of elements the internal heap has space for.
+    size_t _capacity;
+
+    unique_ptr<internal_pq_type> _internal;
+    unique_ptr<external_pq_type> _external;
+
+  public:
+    priority_queue(size_t memory_bytes, size_t max_size)
+      : _memory_bytes(memory_bytes)
+      , _max_size(max_size)
+      , _capacity(std::min(max_size, internal_pq_type::memory_fits(memory_bytes)))
+      , _internal(adiar::make_unique<internal_pq_type>(memory_bytes, _capacity))
+    {}
+
+    value_type
+    top()
+    {
+      return _external ? _external->top() : _internal->top();
+    }
+
+    void
+    pop()
+    {
+      if (_external) {
+        _external->pop();
+      } else {
+        _internal->pop();
+      }
+    }
+
+    void
+    push(const value_type& v)
+    {
+      if (!_external && _internal->size() == _capacity) { spill(); }
+
+      if (_external) {
+        _external->push(v);
+      } else {
+        _internal->push(v);
+      }
+    }
+
+    size_t
+    size() const
+    {
+      return _external ? _external->size() : _internal->size();
+    }
+
+    bool
+    empty() const
+    {
+      return this->size() == 0;
+    }
+
+    bool
+    has_top() const
+    {
+      return !this->empty();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content has been moved to external memory.
+    //////////////////////////////////////////////////////////////////////////
+    bool
+    is_spilled() const
+    {
+      return static_cast<bool>(_external);
+    }
+
+  private:
+    //////////////////////////////////////////////////////////////////////////
+    /// \brief Move all elements from the internal heap to the external one.
+    ///
+    /// \details The elements are first moved to a temporary file, such that
+    ///          the internal heap is freed before the external priority queue
+    ///          claims the very same memory.
+    //////////////////////////////////////////////////////////////////////////
+    void
+    spill()
+    {
+      tpie::file_stream<value_type> spill_file;
+      spill_file.open();
+
+      while (!_internal->empty()) {
+        spill_file.write(_internal->top());
+        _internal->pop();
+      }
+      _internal.reset();
+
+      _external = adiar::make_unique<external_pq_type>(_memory_bytes, _max_size);
+
+      spill_file.seek(0);
+      while (spill_file.can_read()) { _external->push(spill_file.read()); }
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Type alias for sorter for partial type application of the
+  ///        'adaptive' memory type.
+  //////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp = std::less<T>>
+  using adaptive_priority_queue = priority_queue<memory_mode::Adaptive, T, Comp>;
 }
 
 #endif // ADIAR_INTERNAL_DATA_STRUCTURES_PRIORITY_QUEUE_H
@@ -0,0 +1,325 @@
+#ifndef ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_PRIORITY_QUEUE_H
+#define ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_PRIORITY_QUEUE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include <tpie/tpie.h>
+
+#include <adiar/internal/assert.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Internal memory radix heap for elements with a 64-bit integer key.
+  ///
+  /// \details An element is placed in the bucket for the most significant bit in which its key
+  ///          differs from the key of the last popped element. Each element is moved to a lower
+  ///          bucket at most once per bit of its key, whereas a binary heap compares it with
+  ///          logarithmically many others on every push and pop. The comparator is only used to
+  ///          order the elements with the same key as the last popped one; these are kept in a
+  ///          binary heap of their own.
+  ///
+  /// \pre     Similar to a levelized priority queue, one may not push an element with a key smaller
+  ///          than the one of the last popped element.
+  ///
+  /// \remark  The elements of a bucket are only distributed into the lower ones when its smallest
+  ///          element is popped. Until then, `top()` only looks for (and caches) the smallest one.
+  ///          Hence, it is fine to push an element smaller than `top()` but not smaller than the
+  ///          last popped one, e.g. when a levelized priority queue pushes to a level in-between.
+  ///
+  /// \tparam T    Type of the elements.
+  ///
+  /// \tparam Comp Comparator on the elements.
+  ///
+  /// \tparam Key  Function (with a `const` call operator) from an element to its `uint64_t` key.
+  ///              If `Key(a) < Key(b)` then `a` must also be ordered before `b` by `Comp`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp, typename Key>
+  class radix_priority_queue
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using value_type = T;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of an element's key.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using key_type = uint64_t;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t data_structures = 1u;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of buckets, i.e. one for each bit of the key and (at index 0) one for the
+    ///        elements with the same key as the last popped one.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t buckets = std::numeric_limits<key_type>::digits + 1u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of no element.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t nil = std::numeric_limits<size_t>::max();
+
+  public:
+    static size_t
+    memory_usage(size_t no_elements)
+    {
+      return 2u * tpie::array<value_type>::memory_usage(no_elements)
+        + tpie::array<size_t>::memory_usage(no_elements);
+    }
+
+    static size_t
+    memory_fits(size_t memory_bytes)
+    {
+      const size_t element_bytes = 2u * sizeof(value_type) + sizeof(size_t);
+
+      // The arrays have a small constant overhead, which we account for by stepping down.
+      size_t ret = memory_bytes / element_bytes;
+      while (0u < ret && memory_bytes < memory_usage(ret)) { --ret; }
+
+      adiar_assert(memory_usage(ret) <= memory_bytes, "memory_fits and memory_usage should agree.");
+      return ret;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Storage for the elements in the buckets `1` to `64`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<value_type> _values;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the next element within the same bucket (or on the free list).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<size_t> _next;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the first element of each bucket (bucket `0` is unused).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _heads[buckets];
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief First index on the free list and the number of indices not yet used at all.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _free   = nil;
+    size_t _unused = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Binary heap with the elements that have the same key as the last popped one.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::array<value_type> _ties;
+    size_t _ties_size = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the smallest element in the buckets (if already found) while there are no
+    ///        ties.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable size_t _top_idx = nil;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Key of the last popped element, i.e. the key which all buckets are relative to.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    key_type _base_key = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Total number of elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _size = 0u;
+
+    mutable Comp _comp = Comp();
+    Key _key           = Key();
+
+  public:
+    radix_priority_queue([[maybe_unused]] size_t memory_bytes, size_t max_size)
+      : _values(max_size)
+      , _next(max_size)
+      , _ties(max_size)
+    {
+      adiar_assert(max_size <= memory_fits(memory_bytes),
+                   "Must be instantiated with enough memory.");
+
+      std::fill(_heads, _heads + buckets, nil);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \pre `has_top() == true`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    top() const
+    {
+      if (0u < _ties_size) { return _ties[0]; }
+
+      if (_top_idx == nil) { _top_idx = find_min(); }
+      return _values[_top_idx];
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \pre `has_top() == true`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    pop()
+    {
+      if (_ties_size == 0u) {
+        refill();
+        _top_idx = nil;
+      }
+
+      std::pop_heap(_ties.begin(), _ties.begin() + _ties_size, greater());
+      _ties_size -= 1u;
+      _size -= 1u;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \pre The key of `v` is larger than or equal to the one of the last popped element.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(const value_type& v)
+    {
+      adiar_assert(_size < _values.size(), "Cannot push more than 'max_size' many elements");
+
+      const key_type k = _key(v);
+      adiar_assert(_base_key <= k, "Cannot push an element below the last popped one");
+
+      _size += 1u;
+      if (k == _base_key) {
+        push_tie(v);
+        return;
+      }
+
+      const size_t idx = _free != nil ? std::exchange(_free, _next[_free]) : _unused++;
+
+      const size_t b = bucket_of(k);
+      _values[idx]   = v;
+      _next[idx]     = _heads[b];
+      _heads[b]      = idx;
+
+      if (_top_idx != nil && _comp(v, _values[_top_idx])) { _top_idx = idx; }
+    }
+
+    size_t
+    size() const
+    {
+      return _size;
+    }
+
+    bool
+    empty() const
+    {
+      return this->size() == 0;
+    }
+
+    bool
+    has_top() const
+    {
+      return !this->empty();
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Reversed comparator to obtain a min-heap from the standard library's max-heap.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    auto
+    greater() const
+    {
+      return [this](const value_type& a, const value_type& b) { return _comp(b, a); };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Bucket for a key larger than `_base_key`, i.e. one plus the index of the most
+    ///        significant bit in which the two differ.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    bucket_of(const key_type k) const
+    {
+      adiar_assert(_base_key < k);
+#ifdef __GNUC__
+      return std::numeric_limits<key_type>::digits - __builtin_clzll(k ^ _base_key);
+#else
+      size_t b = 0u;
+      for (key_type diff = k ^ _base_key; diff != 0u; diff >>= 1u) { b += 1u; }
+      return b;
+#endif
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Add an element with the same key as the last popped one.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push_tie(const value_type& v)
+    {
+      _ties[_ties_size++] = v;
+      std::push_heap(_ties.begin(), _ties.begin() + _ties_size, greater());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the first non-empty bucket.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    first_bucket() const
+    {
+      size_t b = 1u;
+      while (_heads[b] == nil) {
+        b += 1u;
+        adiar_assert(b < buckets, "Some bucket should be non-empty");
+      }
+      return b;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the smallest element within the first non-empty bucket.
+    ///
+    /// \details Due to the consistency of `Key` with `Comp`, this also is the smallest element wrt.
+    ///          its key.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    find_min() const
+    {
+      size_t min_idx = _heads[first_bucket()];
+      for (size_t i = _next[min_idx]; i != nil; i = _next[i]) {
+        if (_comp(_values[i], _values[min_idx])) { min_idx = i; }
+      }
+      return min_idx;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Empty the first non-empty bucket into the lower ones (and the ties).
+    ///
+    /// \details Since all elements in bucket `b` agree with `_base_key` on all bits above the
+    ///          `b`th, all of them end up in a lower bucket after `_base_key` is updated to the
+    ///          smallest key within bucket `b`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    refill()
+    {
+      _base_key = _key(_values[_top_idx == nil ? find_min() : _top_idx]);
+
+      const size_t b = first_bucket();
+      size_t idx     = std::exchange(_heads[b], nil);
+
+      while (idx != nil) {
+        const size_t next = _next[idx];
+        const key_type k  = _key(_values[idx]);
+
+        if (k == _base_key) {
+          push_tie(_values[idx]);
+          _next[idx] = _free;
+          _free      = idx;
+        } else {
+          const size_t new_b = bucket_of(k);
+          adiar_assert(new_b < b, "Elements should move to a lower bucket");
+
+          _next[idx]    = _heads[new_b];
+          _heads[new_b] = idx;
+        }
+        idx = next;
+      }
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_DATA_STRUCTURES_RADIX_PRIORITY_QUEUE_H
@@ -0,0 +1,8 @@
+#include "result_cache.h"
+
+namespace adiar::internal
+{
+  thread_local thread_statistics<&statistics::result_cache> stats_result_cache;
+
+  result_cache global_result_cache;
+}
@@ -0,0 +1,347 @@
+#ifndef ADIAR_INTERNAL_DATA_STRUCTURES_RESULT_CACHE_H
+#define ADIAR_INTERNAL_DATA_STRUCTURES_RESULT_CACHE_H
+
+#include <array>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+
+#include <adiar/exec_policy.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/dd.h>
+#include <adiar/internal/memory.h>
+#include <adiar/internal/statistics.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Struct to hold statistics
+  extern thread_local thread_statistics<&statistics::result_cache> stats_result_cache;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Cache of results of previous operations.
+  ///
+  /// \details An operation is identified by its type, an operation specific argument (e.g. the
+  ///          truth table of a binary operator), and the file, negation flag, and shift of each of
+  ///          its operands. Operands and results are only referenced weakly. Hence, the cache never
+  ///          keeps a file alive; an entry is dropped as soon as one of its files has been
+  ///          garbage collected.
+  ///
+  /// \remark The cache is shared between all threads. Hence, all accesses are guarded by a mutex.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class result_cache
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of operations that are cached.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class operation : uint8_t
+    {
+      Apply,
+      Ite,
+      Exists,
+      Forall,
+      Relnext,
+      Relprev
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Maximum number of operands of a cached operation.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t max_operands = 3u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the shared node files of each diagram.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using shared_node_file_type = dd::shared_node_file_type;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the (unshared) node files of each diagram.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using node_file_type = dd::node_file_type;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Identity of an operation.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct key_type
+    {
+      operation op;
+      uint64_t arg;
+      std::array<const node_file_type*, max_operands> files;
+      std::array<bool, max_operands> negate;
+      std::array<dd::signed_label_type, max_operands> shift;
+
+      bool
+      operator==(const key_type& o) const
+      {
+        return op == o.op && arg == o.arg && files == o.files && negate == o.negate
+          && shift == o.shift;
+      }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Hash function for `key_type`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct key_hash
+    {
+      size_t
+      operator()(const key_type& k) const
+      {
+        size_t h = static_cast<size_t>(k.op) * 0x9E3779B97F4A7C15ull ^ k.arg;
+        for (size_t i = 0u; i < max_operands; ++i) {
+          h = (h * 31u) ^ std::hash<const void*>()(k.files[i]);
+          h = (h * 31u) ^ (static_cast<size_t>(k.shift[i]) << 1u) ^ k.negate[i];
+        }
+        return h;
+      }
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief A cached result together with weak references to all files involved.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct entry_type
+    {
+      key_type key;
+      std::array<std::weak_ptr<node_file_type>, max_operands> operands;
+      std::weak_ptr<node_file_type> result;
+      bool result_negate;
+      dd::signed_label_type result_shift;
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Approximate number of bytes used per entry (including the bookkeeping of the
+    ///        containers).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t entry_memory = sizeof(entry_type) + 8u * sizeof(void*);
+
+  private:
+    std::mutex _mutex;
+
+    /// \brief Maximum number of entries (0 if disabled).
+    size_t _max_entries = 0u;
+
+    /// \brief All entries with the least recently used at the back.
+    std::list<entry_type> _entries;
+
+    /// \brief Index into `_entries`.
+    std::unordered_map<key_type, std::list<entry_type>::iterator, key_hash> _index;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The number of entries that fit into the given amount of memory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_fits(const size_t memory_bytes)
+    {
+      return memory_bytes / entry_memory;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the cache is enabled.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    enabled()
+    {
+      const std::lock_guard<std::mutex> lock(this->_mutex);
+      return 0u < this->_max_entries;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the maximum number of entries (0 disables the cache), evicting entries if
+    ///        necessary.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    set_capacity(const size_t max_entries)
+    {
+      const std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_max_entries = max_entries;
+      while (this->_max_entries < this->_entries.size()) { this->evict_back(); }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Remove all entries.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    clear()
+    {
+      const std::lock_guard<std::mutex> lock(this->_mutex);
+      this->_index.clear();
+      this->_entries.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of entries.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    size()
+    {
+      const std::lock_guard<std::mutex> lock(this->_mutex);
+      return this->_entries.size();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Look up the result of an operation.
+    ///
+    /// \returns The result's file (or `nullptr` if it is not cached) together with its negation
+    ///          flag and shift.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <size_t Operands>
+    std::tuple<shared_ptr<node_file_type>, bool, dd::signed_label_type>
+    lookup(const operation op, const uint64_t arg, const std::array<const dd*, Operands>& operands)
+    {
+      const key_type key = make_key(op, arg, operands);
+
+      const std::lock_guard<std::mutex> lock(this->_mutex);
+
+      const auto idx_it = this->_index.find(key);
+      if (idx_it == this->_index.end()) {
+#ifdef ADIAR_STATS
+        stats_result_cache.misses += 1u;
+#endif
+        return { nullptr, false, 0 };
+      }
+
+      const auto entry_it = idx_it->second;
+
+      // Is any of the files garbage collected? If so, then this entry is stale (and any file with
+      // the same address is not the same one as before).
+      shared_ptr<node_file_type> result = entry_it->result.lock();
+      bool expired                      = !result;
+      for (size_t i = 0u; i < Operands; ++i) { expired |= entry_it->operands[i].expired(); }
+
+      if (expired) {
+#ifdef ADIAR_STATS
+        stats_result_cache.misses += 1u;
+        stats_result_cache.expired += 1u;
+#endif
+        this->_index.erase(idx_it);
+        this->_entries.erase(entry_it);
+        return { nullptr, false, 0 };
+      }
+
+#ifdef ADIAR_STATS
+      stats_result_cache.hits += 1u;
+#endif
+      // Mark as most recently used
+      this->_entries.splice(this->_entries.begin(), this->_entries, entry_it);
+      return { result, entry_it->result_negate, entry_it->result_shift };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Add the result of an operation.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <size_t Operands>
+    void
+    insert(const operation op,
+           const uint64_t arg,
+           const std::array<const dd*, Operands>& operands,
+           const dd& result)
+    {
+      static_assert(Operands <= max_operands);
+
+      entry_type e{ make_key(op, arg, operands), {}, result.file_ptr(), result.is_negated(),
+                    result.shift() };
+      for (size_t i = 0u; i < Operands; ++i) { e.operands[i] = operands[i]->file_ptr(); }
+
+      const std::lock_guard<std::mutex> lock(this->_mutex);
+
+      if (this->_max_entries == 0u) { return; }
+
+      const auto idx_it = this->_index.find(e.key);
+      if (idx_it != this->_index.end()) {
+        this->_entries.erase(idx_it->second);
+        this->_index.erase(idx_it);
+      }
+
+      while (this->_max_entries <= this->_entries.size()) { this->evict_back(); }
+
+      this->_entries.push_front(std::move(e));
+      this->_index.insert({ this->_entries.front().key, this->_entries.begin() });
+    }
+
+  private:
+    template <size_t Operands>
+    static key_type
+    make_key(const operation op,
+             const uint64_t arg,
+             const std::array<const dd*, Operands>& operands)
+    {
+      static_assert(Operands <= max_operands);
+
+      key_type key{ op, arg, {}, {}, {} };
+      for (size_t i = 0u; i < Operands; ++i) {
+        key.files[i]  = operands[i]->file_ptr().get();
+        key.negate[i] = operands[i]->is_negated();
+        key.shift[i]  = operands[i]->shift();
+      }
+      return key;
+    }
+
+    void
+    evict_back()
+    {
+      adiar_assert(!this->_entries.empty());
+#ifdef ADIAR_STATS
+      stats_result_cache.evictions += 1u;
+#endif
+      this->_index.erase(this->_entries.back().key);
+      this->_entries.pop_back();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief The result cache shared by all of Adiar's operations.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  extern result_cache global_result_cache;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the result of an operation from the global result cache or compute it.
+  ///
+  /// \details On a miss, the result of `f()` is reduced immediately such that it can be reused.
+  ///          Unreduced results that are to be piped into the next operation (see
+  ///          `exec_policy::chain`) are never cached.
+  ///
+  /// \param ep       Execution policy of the operation.
+  ///
+  /// \param op       Type of operation.
+  ///
+  /// \param arg      Operation specific argument, e.g. the truth table of a binary operator.
+  ///
+  /// \param operands Pointers to the (reduced) operands.
+  ///
+  /// \param f        Function to compute the (possibly unreduced) result.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Policy, size_t Operands, typename F>
+  typename Policy::__dd_type
+  result_cache_or(const exec_policy& ep,
+                  const result_cache::operation op,
+                  const uint64_t arg,
+                  const std::array<const dd*, Operands>& operands,
+                  const F& f)
+  {
+    using dd_type   = typename Policy::dd_type;
+    using __dd_type = typename Policy::__dd_type;
+
+    using shared_node_file_type = result_cache::shared_node_file_type;
+
+    if (ep.template get<exec_policy::chain>() == exec_policy::chain::Pipe
+        || !global_result_cache.enabled()) {
+      return f();
+    }
+
+    const auto [file, negate, shift] = global_result_cache.lookup(op, arg, operands);
+    if (file) { return __dd_type(dd_type(shared_node_file_type(file), negate, shift)); }
+
+    const dd_type result = f();
+    global_result_cache.insert(op, arg, operands, result);
+    return __dd_type(result);
+  }
+}
+
+#endif // ADIAR_INTERNAL_DATA_STRUCTURES_RESULT_CACHE_H
@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 
+#include <tpie/file_stream.h>
 #include <tpie/sort.h>
 #include <tpie/tpie.h>
 
@@ -37,6 +38,11 @@ namespace adiar::internal
     size_t _size      = 0;
     size_t _front_idx = 0;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements at the front of the array that already are sorted.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _presorted = 0;
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     static size_t
@@ -108,14 +114,64 @@ namespace adiar::internal
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void
-    sort()
+    sort(value_type* merge_buffer = nullptr)
     {
       adiar_assert(this->_sorted == false);
-      tpie::parallel_sort(this->_array.begin(), this->_array.begin() + this->_size, this->_pred);
+      if (this->_presorted == 0u) {
+        tpie::parallel_sort(this->_array.begin(), this->_array.begin() + this->_size, this->_pred);
+      } else {
+        this->presort(this->_size, merge_buffer);
+      }
       this->_sorted = true;
       adiar_assert(this->_front_idx == 0);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements that already have been sorted by `presort`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    presorted() const
+    {
+      return this->_presorted;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief        Sort the first `end` elements, where a prefix of them already is sorted.
+    ///
+    /// \details      The elements in `[presorted(), end)` are sorted on their own and then merged
+    ///               with the already sorted prefix. This only touches the first `end` elements.
+    ///               Hence, it may run concurrently with calls to `push`.
+    ///
+    /// \param end    Number of elements (all of which already have been pushed) to sort.
+    ///
+    /// \param buffer Space for (at least) `presorted()` many elements to merge with.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    presort(const size_t end, value_type* buffer)
+    {
+      adiar_assert(this->_sorted == false);
+      adiar_assert(this->_presorted <= end && end <= this->_array.size());
+
+      const auto begin = this->_array.begin();
+      std::sort(begin + this->_presorted, begin + end, this->_pred);
+
+      if (0u < this->_presorted) {
+        adiar_assert(buffer != nullptr, "Merging with a sorted prefix requires a buffer");
+
+        // Only the (first) sorted prefix needs to be moved out of the way, since the merge never
+        // overtakes the position it reads from in the second half.
+        std::copy(begin, begin + this->_presorted, buffer);
+
+        size_t i = 0u, j = this->_presorted, k = 0u;
+        while (i < this->_presorted && j < end) {
+          this->_array[k++] =
+            this->_pred(this->_array[j], buffer[i]) ? this->_array[j++] : buffer[i++];
+        }
+        while (i < this->_presorted) { this->_array[k++] = buffer[i++]; }
+      }
+      this->_presorted = end;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     bool
     can_pull() const
@@ -147,6 +203,7 @@ namespace adiar::internal
       this->_sorted    = false;
       this->_size      = 0;
       this->_front_idx = 0;
+      this->_presorted = 0;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,6 +436,179 @@ namespace adiar::internal
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename T, typename Comp = std::less<T>>
   using external_sorter = sorter<memory_mode::External, T, Comp>;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Internal memory sorter that moves its content over to TPIE's merge sorter, if more
+  ///        elements are pushed than fit into its share of the memory.
+  ///
+  /// \details The internal sorter is given space for `no_elements` many elements, or less if these
+  ///          do not fit. Hence, `no_elements` may be a pessimistic upper bound without giving up
+  ///          on the faster internal memory sorting whenever the actual number of elements is small.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp>
+  class sorter<memory_mode::Adaptive, T, Comp>
+  {
+  public:
+    using value_type = T;
+
+  private:
+    using internal_sorter_t = sorter<memory_mode::Internal, value_type, Comp>;
+    using external_sorter_t = sorter<memory_mode::External, value_type, Comp>;
+
+    size_t _memory_bytes;
+    size_t _no_elements;
+    size_t _no_sorters;
+    Comp _comp;
+
+    unique_ptr<internal_sorter_t> _internal;
+    unique_ptr<external_sorter_t> _external;
+
+  public:
+    static constexpr size_t data_structures = 1u;
+
+    static unique_ptr<sorter<memory_mode::Adaptive, value_type, Comp>>
+    make_unique(size_t memory_bytes, size_t no_elements, size_t no_sorters = 1, Comp comp = Comp())
+    {
+      return adiar::make_unique<sorter<memory_mode::Adaptive, value_type, Comp>>(
+        memory_bytes, no_elements, no_sorters, comp);
+    }
+
+    static void
+    reset_unique(unique_ptr<sorter<memory_mode::Adaptive, value_type, Comp>>& u_ptr,
+                 size_t memory_bytes,
+                 size_t no_elements,
+                 size_t no_sorters = 1,
+                 Comp comp         = Comp())
+    {
+      // Only reuse the internal sorter, if it has not been given up on and it would be given the
+      // very same amount of memory.
+      const bool reusable = !u_ptr->_external && u_ptr->_memory_bytes == memory_bytes
+        && u_ptr->_no_elements == no_elements && u_ptr->_no_sorters == no_sorters;
+
+      if (reusable) {
+        u_ptr->_internal->reset();
+      } else {
+        u_ptr = make_unique(memory_bytes, no_elements, no_sorters, comp);
+      }
+    }
+
+  public:
+    sorter(size_t memory_bytes, size_t no_elements, size_t no_sorters = 1, Comp comp = Comp())
+      : _memory_bytes(memory_bytes)
+      , _no_elements(no_elements)
+      , _no_sorters(no_sorters)
+      , _comp(comp)
+    {
+      adiar_assert(no_sorters > 0, "Number of sorters should be positive");
+
+      const size_t capacity =
+        std::min(no_elements, internal_sorter_t::memory_fits(memory_bytes / no_sorters));
+
+      _internal = adiar::make_unique<internal_sorter_t>(memory_bytes, capacity, no_sorters, comp);
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(const value_type& v)
+    {
+      if (!_external && !_internal->can_push()) { spill(); }
+
+      if (_external) {
+        _external->push(v);
+      } else {
+        _internal->push(v);
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    sort()
+    {
+      if (_external) {
+        _external->sort();
+      } else {
+        _internal->sort();
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_pull()
+    {
+      return _external ? _external->can_pull() : _internal->can_pull();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    top()
+    {
+      return _external ? _external->top() : _internal->top();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type
+    pull()
+    {
+      return _external ? _external->pull() : _internal->pull();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    size()
+    {
+      return _external ? _external->size() : _internal->size();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    empty()
+    {
+      return this->size() == 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content has been moved to external memory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_spilled() const
+    {
+      return static_cast<bool>(_external);
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move all elements from the internal sorter to the external one.
+    ///
+    /// \details Both sorters are given the same amount of memory. Hence, the elements are first
+    ///          moved to a temporary file, such that the internal sorter can be freed before the
+    ///          external one is created.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    spill()
+    {
+      tpie::file_stream<value_type> spill_file;
+      spill_file.open();
+
+      // The internal sorter provides no access to its (unsorted) elements. Yet, sorting them
+      // first is cheap compared to what is to come and gives the merge sorter sorted input.
+      _internal->sort();
+      while (_internal->can_pull()) { spill_file.write(_internal->pull()); }
+      _internal.reset();
+
+      _external =
+        adiar::make_unique<external_sorter_t>(_memory_bytes, _no_elements, _no_sorters, _comp);
+
+      spill_file.seek(0);
+      while (spill_file.can_read()) { _external->push(spill_file.read()); }
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Type alias for sorter for partial type application of the 'adaptive' memory type.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, typename Comp = std::less<T>>
+  using adaptive_sorter = sorter<memory_mode::Adaptive, T, Comp>;
 }
 
 #endif // ADIAR_INTERNAL_DATA_STRUCTURES_SORTER_H
@@ -1,6 +1,8 @@
 #ifndef ADIAR_INTERNAL_DATA_STRUCTURES_VECTOR_H
 #define ADIAR_INTERNAL_DATA_STRUCTURES_VECTOR_H
 
+#include <algorithm>
+
 #include <tpie/internal_vector.h>
 
 #include <adiar/internal/assert.h>
@@ -17,8 +19,8 @@ namespace adiar::internal
   ///          iterator. Hence, for now it's easier for us to just wrap the `array` directly
   ///          instead of using the array. This also gives us the freedom to make it more conform to
   ///          the `std::vector<T>`.
-  //
-  // TODO: explicit or implicit `resize` when full?
+  ///
+  ///          Similar to `std::vector<T>`, the capacity is doubled when pushing onto a full vector.
   //////////////////////////////////////////////////////////////////////////////////////////////////
   template <typename T>
   class vector<memory_mode::Internal, T>
@@ -123,7 +125,7 @@ namespace adiar::internal
     value_type&
     push_back(const value_type& x)
     {
-      adiar_assert(this->_size < this->_capacity, "Cannot push at full capacity");
+      if (this->_size == this->_capacity) { this->grow(); }
       this->_array[this->_size] = x;
       this->_size += 1;
       return this->back();
@@ -185,6 +187,21 @@ namespace adiar::internal
       return this->_array.rend();
     }
 
+  private:
+    /// \brief Move all elements into an array of twice the capacity.
+    void
+    grow()
+    {
+      const size_t new_capacity = this->_capacity == 0 ? 1u : 2u * this->_capacity;
+
+      array_type new_array(new_capacity);
+      std::copy(this->_array.begin(), this->_array.begin() + this->_size, new_array.begin());
+
+      this->_array.swap(new_array);
+      this->_capacity = new_capacity;
+    }
+
+  public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     size_t
     size() const
@@ -186,6 +186,18 @@ namespace adiar::internal
       return this->uid().value();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The numeric value of this terminal node (assuming it is one).
+    ///
+    /// \pre `is_terminal()` evaluates to `true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline pointer_type::numeric_type
+    numeric_value() const
+    {
+      adiar_assert(is_terminal());
+      return this->uid().numeric_value();
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Whether this node is the false terminal.
     ///
@@ -431,7 +443,7 @@ namespace adiar::internal
 
       stream << "{";
       if (this->is_terminal()) {
-        stream << this->value();
+        stream << this->numeric_value();
       } else {
         stream << this->uid() << " | " << this->low() << " " << this->high();
       }
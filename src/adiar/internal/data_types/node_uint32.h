@@ -0,0 +1,129 @@
+#ifndef ADIAR_INTERNAL_DATA_TYPES_NODE_UINT32_H
+#define ADIAR_INTERNAL_DATA_TYPES_NODE_UINT32_H
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/data_types/ptr_uint32.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief A node triple (uid, low, high) with all three pointers in their narrow 32-bit layout,
+  ///        i.e. a node of 12 rather than 24 bytes.
+  ///
+  /// \details This is only a representation for storage and transfer of nodes. All algorithms
+  ///          operate on `node`, so a `node_uint32` has to be converted with `widen` first.
+  ///
+  /// \see node ptr_uint32
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class node_uint32
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the pointers in this node.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using pointer_type = ptr_uint32;
+
+  private:
+    pointer_type _uid;
+    pointer_type _low;
+    pointer_type _high;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Default construction (trivial).
+    ///
+    /// \details The default, copy, and move constructor has to be `default` to ensure it is a *POD*
+    ///          and hence can be used by TPIE's files.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    node_uint32() = default;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Construct node `(uid, low, high)`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    node_uint32(const pointer_type& u, const pointer_type& l, const pointer_type& h)
+      : _uid(u)
+      , _low(l)
+      , _high(h)
+    {}
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The (narrow) unique identifier of this node.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline pointer_type
+    uid() const
+    {
+      return _uid;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The (narrow) 'low' child.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline pointer_type
+    low() const
+    {
+      return _low;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The (narrow) 'high' child.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline pointer_type
+    high() const
+    {
+      return _high;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether this node is (bit-wise) the same as another.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    operator==(const node_uint32& o) const
+    {
+      return _uid == o._uid && _low == o._low && _high == o._high;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether this node differs from another.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    operator!=(const node_uint32& o) const
+    {
+      return !(*this == o);
+    }
+  };
+
+  static_assert(sizeof(node_uint32) == 3u * sizeof(uint32_t));
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether a node can be represented as a `node_uint32`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline bool
+  fits_uint32(const node& n)
+  {
+    return fits_uint32(n.uid()) && fits_uint32(n.low()) && fits_uint32(n.high());
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Convert a node into its narrow 32-bit layout.
+  ///
+  /// \pre `fits_uint32(n)` evaluates to `true`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline node_uint32
+  narrow(const node& n)
+  {
+    return node_uint32(narrow(n.uid()), narrow(n.low()), narrow(n.high()));
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Convert a narrow 32-bit node back into a node.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline node
+  widen(const node_uint32& n)
+  {
+    return node(node::uid_type(widen(n.uid())), widen(n.low()), widen(n.high()));
+  }
+}
+
+#endif // ADIAR_INTERNAL_DATA_TYPES_NODE_UINT32_H
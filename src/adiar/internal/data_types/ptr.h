@@ -10,13 +10,7 @@
 
 namespace adiar::internal
 {
-  // TODO (ADD (32-bit)):
-  //   Template 'ptr_uint64' with 'terminal_t' of how to interpret the bits of a terminal. To this
-  //   end, one wants to use 'std::bit_cast' (C++20) in the internal logic. Use 'static_assert' to
-  //   ensure the desired type indeed fits into 32 bits of memory.
-
   // TODO (ADD (64-bit)):
-  // TODO (10+ TiB Decision Diagrams):
   //   Create a new 'ptr_templ' class that does not compress all information into a single 64-bit
   //   unsigned integer. The 'label_type' and 'id_type' should be provided as template parameters
   //   and the 'max_id' and 'max_label' should be derived based on
@@ -33,6 +27,16 @@ namespace adiar::internal
   //   Same as for LDD but with the weight specifically being complex values. Furthermore, template
   //   the `outdegree` to use an extra bit for the out index.
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// The preprocessor variable ADIAR_LEVEL_BITS can be used to change how many of the 64 bits of a
+  /// pointer are used for its level; the remaining bits are used for the level identifier. That is,
+  /// one can trade the maximal width of a single level for more variables. For example, 24 bits
+  /// allows for ~16 million variables while each level still may have up to 2^37 nodes.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+#ifndef ADIAR_LEVEL_BITS
+#define ADIAR_LEVEL_BITS 21u
+#endif
+
   ////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Compute (at compile-time) the (ceiling) log2 of a number.
   ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -77,8 +81,8 @@ namespace adiar::internal
     ///
     /// Where these three parts represent the following variables:
     ///
-    ///  - `L` : These uppermost 24 bits reflect the level. Here, we assign
-    ///          special meaning to the two maximal levels.
+    ///  - `L` : These uppermost bits reflect the level (21 bits, by default).
+    ///          Here, we assign special meaning to the two maximal levels.
     ///
     ///  - `_` : These bits change based on whether it describes a terminal, an
     ///          internal node, or nil.
@@ -103,6 +107,11 @@ namespace adiar::internal
 
     template <typename pointer_type>
     friend class __uid;
+
+    template <typename Request>
+    friend struct request_first_key;
+
+    friend struct reduce_queue_key;
     ////////////////////////////////////////////////////////////////////////////////////////////////
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,7 +184,9 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The number of bits for the level.
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    static constexpr uint8_t level_bits = 21u;
+    static constexpr uint8_t level_bits = ADIAR_LEVEL_BITS;
+    static_assert(14u <= level_bits && level_bits <= 31u,
+                  "Level field must fit into 'level_type' and leave space for the identifier");
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The number of bits to shift into the level field.
@@ -602,6 +613,38 @@ namespace adiar::internal
       return static_cast<terminal_type>(this->data());
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of numeric terminal values, e.g. of an Algebraic Decision Diagram.
+    ///
+    /// \details The `false` and `true` terminals coincide with the numeric terminals `0` and `1`.
+    ///          Hence, `value()` of a numeric terminal is whether it is non-zero.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using numeric_type = uint32_t;
+
+    static_assert(8 * sizeof(numeric_type) <= data_bits,
+                  "Type for numeric terminal values may overflow data field");
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the terminal node with the numeric value `v`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr ptr_uint64
+    numeric_terminal(const numeric_type v)
+    {
+      return ptr_uint64(min_terminal | (static_cast<raw_type>(v) << data_shift));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The numeric value of the terminal this pointer points to.
+    ///
+    /// \pre `is_terminal()` evaluates to `true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline numeric_type
+    numeric_value() const
+    {
+      adiar_assert(is_terminal());
+      return static_cast<numeric_type>(this->data());
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Whether this pointer points to the `false` terminal.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -785,7 +828,7 @@ namespace adiar::internal
       if (this->is_nil()) {
         stream << "nil";
       } else if (this->is_terminal()) {
-        stream << this->value();
+        stream << this->numeric_value();
       } else { // this->is_node()
         // TODO: also include `out_idx`?
         stream << "(" << this->level() << ";" << this->id() << ")";
@@ -0,0 +1,522 @@
+#ifndef ADIAR_INTERNAL_DATA_TYPES_PTR_UINT32_H
+#define ADIAR_INTERNAL_DATA_TYPES_PTR_UINT32_H
+
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdint.h>
+#include <string>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/data_types/ptr.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief A (possibly flagged) unique identifier of a terminal, an internal node, or nothing
+  ///        (`nil`) packed into 32 bits.
+  ///
+  /// \details This is a narrow version of `ptr_uint64` with the same bit layout (and hence the
+  ///          same ordering) but with fewer bits for levels and level identifiers. Any pointer of a
+  ///          decision diagram with at most `max_label + 1` levels and at most `max_id + 1` nodes
+  ///          on each level can be losslessly converted back and forth with `narrow` and `widen`.
+  ///
+  ///          Since the nodes of a reduced diagram are identified counting down from
+  ///          `ptr_uint64::max_id`, the level identifiers are converted relative to the maximal
+  ///          identifier of each layout, i.e. `ptr_uint64::max_id - i` becomes `max_id - i`.
+  ///
+  /// \see ptr_uint64
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class ptr_uint32
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Underlying unsigned integer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using raw_type = uint32_t; // cppcheck-suppress [uninitMemberVar]
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// Similar to `ptr_uint64`, the bits of a single 32 bit unsigned integer are split into a
+    /// level, data, and a flag.
+    ///
+    ///    `LLLLLLLLLLLLLLIIIIIIIIIIIIIIIIOF`
+    ///
+    ///  - `L` : The uppermost 14 bits reflect the level (with the two maximal levels reserved for
+    ///          terminals and `nil`).
+    ///
+    ///  - `I` : The 16 bit level identifier (or the value of a terminal).
+    ///
+    ///  - `O` : The out-index of an arc's source.
+    ///
+    ///  - `F` : A boolean flag with the same meaning as for `ptr_uint64`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    raw_type _raw;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    // befriend functions that need access to 'raw'...
+    friend ptr_uint32
+    narrow(const ptr_uint64& p);
+
+    friend ptr_uint64
+    widen(const ptr_uint32& p);
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Total number of bits.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t total_bits = sizeof(uint32_t) * 8u;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Default construction (trivial).
+    ///
+    /// \details The default, copy, and move constructor has to be `default` to ensure it is a *POD*
+    ///          and hence can be used by TPIE's files.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ptr_uint32() = default;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Copy construction (trivial).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ptr_uint32(const ptr_uint32& p) = default;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Move construction (trivial).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ptr_uint32(ptr_uint32&& p) = default;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Destruction (trivial).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ~ptr_uint32() = default;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Copy assignment (trivial).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ptr_uint32&
+    operator=(const ptr_uint32& p) = default;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Move assignment (trivial).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ptr_uint32&
+    operator=(ptr_uint32&& p) = default;
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Reinterpret an unsigned 32 bit integer as a `ptr`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr ptr_uint32(const raw_type raw)
+      : _raw(raw)
+    {}
+
+    /* ====================================== LEVEL FIELD ======================================= */
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The number of bits for the level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t level_bits = 14u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The number of bits to shift into the level field.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t level_shift = total_bits - level_bits;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type able to hold the node's level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using level_type = ptr_uint64::level_type;
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The maximal possible value for a level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr level_type max_level = (static_cast<raw_type>(1) << level_bits) - 1u;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Extract the level of the node in question.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline level_type
+    level() const
+    {
+      return this->_raw >> level_shift;
+    }
+
+    /* ====================================== BOOLEAN FLAG ====================================== */
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bits used for the Boolean bit flag.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t flag_bits = 1u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Bit-mask and placement for bit flag.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr raw_type flag_bit = static_cast<raw_type>(true);
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Retrieve the value of the bit flag within a pointer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    is_flagged() const
+    {
+      return this->_raw & flag_bit;
+    }
+
+    /* ========================================== DATA ========================================== */
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bits remaining for data values.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t data_bits = total_bits - (level_bits + flag_bits);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bits to shift into the data area.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t data_shift = flag_bits;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the raw data values.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline raw_type
+    data() const
+    {
+      constexpr raw_type data_mask = (static_cast<raw_type>(1) << data_bits) - 1;
+      return (this->_raw >> data_shift) & data_mask;
+    }
+
+    /* =========================================== NIL ========================================== */
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The (maximal) level is reserved for `nil` pointers.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr level_type nil_level = max_level;
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Compile-time derived minimal raw value for `nil`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr raw_type min_nil = static_cast<raw_type>(nil_level) << level_shift;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   A pointer to nothing.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static inline constexpr ptr_uint32
+    nil()
+    {
+      return ptr_uint32{ min_nil };
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a pointer is nil.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    is_nil() const
+    {
+      return min_nil <= this->_raw;
+    }
+
+    /* ========================================== NODES ========================================= */
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type able to hold the label of a variable.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using label_type = level_type;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of a level identifier.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using id_type = ptr_uint64::id_type;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the out-degree.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using out_idx_type = ptr_uint64::out_idx_type;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief   Number of out-going edges from a node
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t outdegree = ptr_uint64::outdegree;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The maximal possible value for the out index.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr out_idx_type max_out_idx = outdegree - 1;
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bits used to store the out-index.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t out_idx_bits = log2(max_out_idx);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The number of bits for a level identifier.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint8_t id_bits = total_bits - level_bits - out_idx_bits - flag_bits;
+    static_assert(id_bits == 16u);
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The maximal possible value for a level identifier.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr id_type max_id = (1ull << id_bits) - 1;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief  The maximal possible value for a unique identifier's label.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr label_type max_label = max_level - 2u;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor for a pointer to an internal node (label, id).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr ptr_uint32(const label_type label, const id_type id)
+      : _raw((static_cast<raw_type>(label) << level_shift)
+             | (static_cast<raw_type>(id) << (data_shift + out_idx_bits)))
+    {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor for a pointer to an internal node (label, id) with given out-index.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr ptr_uint32(const label_type label, const id_type id, const out_idx_type out_idx)
+      : _raw((static_cast<raw_type>(label) << level_shift)
+             | (static_cast<raw_type>(id) << (data_shift + out_idx_bits))
+             | (static_cast<raw_type>(out_idx) << data_shift))
+    {}
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a pointer is for an internal node (label, id).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    is_node() const
+    {
+      constexpr raw_type max_node =
+        ptr_uint32(max_label, max_id, max_out_idx)._raw | ptr_uint32::flag_bit;
+
+      return this->_raw <= max_node;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Extract the label from an internal node (label, id).
+    ///
+    /// \pre `is_node()` evaluates to `true.`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline label_type
+    label() const
+    {
+      adiar_assert(is_node());
+      return this->level();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Extract the level identifier from an internal node (label, id).
+    ///
+    /// \pre `is_node()` evaluates to `true.`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline id_type
+    id() const
+    {
+      adiar_assert(is_node());
+      return this->data() >> out_idx_bits;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Extract the out-index associated with this pointer.
+    ///
+    /// \pre `is_node()` evaluates to `true.`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline out_idx_type
+    out_idx() const
+    {
+      adiar_assert(is_node());
+      return this->data() & static_cast<raw_type>(max_out_idx);
+    }
+
+    /* ======================================== TERMINALS ======================================= */
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of terminal values.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using terminal_type = ptr_uint64::terminal_type;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Terminal level.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr level_type terminal_level = max_level - 1u;
+
+  protected:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Minimal possible raw value for a terminal.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr raw_type min_terminal = static_cast<raw_type>(terminal_level) << level_shift;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Constructor for a pointer to a terminal node (v).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    constexpr ptr_uint32(const terminal_type v)
+      : _raw(min_terminal | (static_cast<raw_type>(v) << data_shift))
+    {}
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether this pointer points to a terminal node.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    is_terminal() const
+    {
+      return this->level() == terminal_level;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The value of the terminal this pointer points to.
+    ///
+    /// \pre `is_terminal()` evaluates to `true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline terminal_type
+    value() const
+    {
+      adiar_assert(is_terminal());
+      return static_cast<terminal_type>(this->data());
+    }
+
+    /* ======================================== COMPARATOR ====================================== */
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Lexicographical ordering on internal nodes (i, id), followed by terminals `false`,
+    ///        `true`, and finally `nil`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    operator<(const ptr_uint32& o) const
+    {
+      return this->_raw < o._raw;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether pointers reference the same node and also share the same auxiliary data, i.e.
+    ///        `flag` and `out_idx`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    operator==(const ptr_uint32& o) const
+    {
+      return this->_raw == o._raw;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether pointers reference the same node and also share the same auxiliary data, i.e.
+    ///        `flag` and `out_idx`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    inline bool
+    operator!=(const ptr_uint32& o) const
+    {
+      return !(*this == o);
+    }
+
+    /* ========================================== DEBUG ========================================= */
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief String representation of the pointer value and its meta data.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::string
+    to_string() const
+    {
+      std::stringstream stream;
+      if (this->is_nil()) {
+        stream << "nil";
+      } else if (this->is_terminal()) {
+        stream << this->value();
+      } else { // this->is_node()
+        stream << "(" << this->level() << ";" << this->id() << ")";
+      }
+
+      if (this->is_flagged()) { stream << "'"; }
+
+      return stream.str();
+    }
+  };
+
+  static_assert(sizeof(ptr_uint32) == sizeof(uint32_t));
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline std::ostream&
+  operator<<(std::ostream& os, const ptr_uint32& p)
+  {
+    return os << p.to_string();
+  }
+
+  /* ======================================== CONVERSION ======================================== */
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether a pointer can be represented as a `ptr_uint32`.
+  ///
+  /// \details Only the Boolean terminals fit, i.e. not the numeric terminals of an ADD.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline bool
+  fits_uint32(const ptr_uint64& p)
+  {
+    if (p.is_terminal()) { return p.numeric_value() <= 1u; }
+    return !p.is_node()
+      || (p.label() <= ptr_uint32::max_label && ptr_uint64::max_id - p.id() <= ptr_uint32::max_id);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Convert a pointer into its narrow 32-bit layout.
+  ///
+  /// \pre `fits_uint32(p)` evaluates to `true`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline ptr_uint32
+  narrow(const ptr_uint64& p)
+  {
+    adiar_assert(fits_uint32(p), "Pointer cannot be represented in 32 bits");
+
+    const ptr_uint32::raw_type flag_bits = p.is_flagged();
+
+    if (p.is_nil()) { return ptr_uint32::nil()._raw | flag_bits; }
+    if (p.is_terminal()) { return ptr_uint32(p.value())._raw | flag_bits; }
+
+    const ptr_uint32::id_type id = ptr_uint32::max_id - (ptr_uint64::max_id - p.id());
+    return ptr_uint32(p.label(), id, p.out_idx())._raw | flag_bits;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Convert a narrow 32-bit pointer back into the 64-bit layout.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline ptr_uint64
+  widen(const ptr_uint32& p)
+  {
+    const auto wide_id = [&p]() { return ptr_uint64::max_id - (ptr_uint32::max_id - p.id()); };
+
+    const ptr_uint64 res = p.is_nil() ? ptr_uint64::nil()
+      : p.is_terminal()               ? ptr_uint64(p.value())
+                                      : ptr_uint64(p.label(), wide_id(), p.out_idx());
+
+    return p.is_flagged() ? flag(res) : res;
+  }
+}
+
+namespace std
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief String representation of the pointer value and its meta data.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline string
+  to_string(const adiar::internal::ptr_uint32& p)
+  {
+    return p.to_string();
+  }
+}
+
+#endif // ADIAR_INTERNAL_DATA_TYPES_PTR_UINT32_H
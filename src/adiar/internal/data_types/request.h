@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <array>
 #include <string>
+#include <type_traits>
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/data_types/node.h>
@@ -652,6 +653,45 @@ namespace adiar::internal
   template <typename Request>
   using request_data_third_lt = __request_data_lt<Request, request_third_lt<Request>>;
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether a request carries data with a level of its own.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Request, typename = void>
+  struct __request_has_data_level : std::false_type
+  {};
+
+  template <typename Request>
+  struct __request_has_data_level<Request, std::void_t<typename Request::data_type>>
+    : std::bool_constant<Request::data_type::has_level>
+  {};
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Integer key of a request that agrees with `request_first_lt` (and
+  ///          `request_data_first_lt`), e.g. for use in a `radix_priority_queue`.
+  ///
+  /// \details The key is the first target's bit representation, which places its level in the most
+  ///          significant bits. If the data carries a level of its own, then the request's level
+  ///          instead is put in front of the (truncated) bits of the first target.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename Request>
+  struct request_first_key
+  {
+    /// \copydoc request_first_key
+    inline uint64_t
+    operator()(const Request& r) const
+    {
+      const uint64_t first = r.target.first()._raw;
+
+      if constexpr (__request_has_data_level<Request>::value) {
+        using pointer_type = typename Request::pointer_type;
+        return (static_cast<uint64_t>(r.level()) << pointer_type::level_shift)
+          | (first >> pointer_type::level_bits);
+      } else {
+        return first;
+      }
+    }
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Class to carry the parent of a recursion within `request_data`.
   //////////////////////////////////////////////////////////////////////////////////////////////////
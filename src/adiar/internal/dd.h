@@ -316,6 +316,11 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     using terminal_type = typename node_type::terminal_type;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether terminals are numeric values rather than only `false` and `true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool numeric_terminals = false;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief File type for the file object representing the diagram.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,6 +495,17 @@ namespace adiar::internal
       return this->number_of_terminals(false) + this->number_of_terminals(true);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Structural hash of the diagram (with its negation flag applied).
+    ///
+    /// \see file_traits<node>::stats::fingerprint
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t
+    fingerprint() const
+    {
+      return this->_file->fingerprint[this->_negate];
+    }
+
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Obtain the cut-type that matches with the current state of the
@@ -581,6 +597,11 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     using terminal_type = typename dd_type::terminal_type;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether terminals are numeric values rather than only `false` and `true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr bool numeric_terminals = dd_type::numeric_terminals;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Type of shared nodes for this diagram type.
     ////////////////////////////////////////////////////////////////////////////////////////////////
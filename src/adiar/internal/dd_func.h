@@ -1,9 +1,15 @@
 #ifndef ADIAR_INTERNAL_DD_FUNC_H
 #define ADIAR_INTERNAL_DD_FUNC_H
 
+#include <string>
+
+#include <adiar/exception.h>
 #include <adiar/functional.h>
 
 #include <adiar/internal/io/levelized_ifstream.h>
+#include <adiar/internal/io/node_ifstream.h>
+#include <adiar/internal/io/node_ofstream.h>
+#include <adiar/internal/io/saved_file.h>
 
 namespace adiar::internal
 {
@@ -151,6 +157,53 @@ namespace adiar::internal
     level_info_ifstream<> info_ifstream(dd);
     while (info_ifstream.can_pull()) { cb(info_ifstream.pull().label()); }
   }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Save a decision diagram (with its meta information) as a single file at the given path.
+  ///
+  /// \details The decision diagram itself (and all others sharing its file) is left untouched. Any
+  ///          negation or shift is applied to a copy before it is saved.
+  ///
+  /// \throws runtime_error If a file at the path already exists.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename DD>
+  void
+  dd_save(const DD& dd, const std::string& path)
+  {
+    if (!dd.is_negated() && dd.shift() == 0) {
+      saved_file::write(*dd.file_ptr(), path);
+      return;
+    }
+
+    typename DD::shared_node_file_type out_file;
+    {
+      node_ofstream out(out_file);
+      node_ifstream<true> in(dd);
+      while (in.can_pull()) { out << in.pull(); }
+    }
+    saved_file::write(*out_file, path);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Load a decision diagram saved with `dd_save`.
+  ///
+  /// \details If possible, the nodes are read in-place from the memory-mapped file.
+  ///
+  /// \see saved_file::read
+  ///
+  /// \throws runtime_error If the file is missing, is incompatible, or does not describe a decision
+  ///                       diagram.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename DD>
+  DD
+  dd_load(const std::string& path)
+  {
+    const typename DD::shared_node_file_type in_file = saved_file::read(path);
+    if (in_file->empty()) {
+      throw runtime_error("'" + path + "' does not contain a decision diagram");
+    }
+    return DD(in_file);
+  }
 }
 
 #endif // ADIAR_INTERNAL_DD_FUNC_H
@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::arc_file_t stats_arc_file;
+  thread_local thread_statistics<&statistics::arc_file> stats_arc_file;
 }
@@ -1,19 +1,19 @@
 #ifndef ADIAR_INTERNAL_IO_ARC_FILE_H
 #define ADIAR_INTERNAL_IO_ARC_FILE_H
 
-#include <adiar/statistics.h>
-
 #include <adiar/internal/data_types/arc.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/io/file.h>
+#include <adiar/internal/io/levelized_file.h>
 #include <adiar/internal/io/shared_file_ptr.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Struct holding statistics on arc files
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  extern statistics::arc_file_t stats_arc_file;
+  extern thread_local thread_statistics<&statistics::arc_file> stats_arc_file;
 
   // TODO (ADD):
   // TODO (QMDD):
@@ -91,16 +91,35 @@ namespace adiar::internal
     };
   };
 
-  // TODO: Add 'untranspose' function to levelized_file<arc> (which is an alias for .sort<0>()).
-  //
-  //       To this end:
-  //       - Rename 'levelized_file<value_t>' to '__levelized_file<value_t>'.
-  //
-  //       - Make 'levelized_file<value_t>' be a class that publicly inherit the
-  //         base class '__levelized_file<value_t>'.
-  //
-  //       - Add a specialization for 'levelized_file<arc>' that also adds the
-  //         'untranspose' function.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sort the internal arcs of an arc file on their source (if not already), e.g. such that
+  ///        its nodes can be read with a `narc_ifstream`.
+  ///
+  /// \pre No one else reads from `af`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline void
+  untranspose(levelized_file<arc>& af)
+  {
+    if (!af.semi_transposed) { return; }
+
+    af.sort<arc_source_lt>(file_traits<arc>::idx__internal);
+    af.semi_transposed = false;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Sort the internal arcs of an arc file on their target (if not already), e.g. such that
+  ///        it can be given to the Reduce algorithm.
+  ///
+  /// \pre No one else reads from `af`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline void
+  transpose(levelized_file<arc>& af)
+  {
+    if (af.semi_transposed) { return; }
+
+    af.sort<arc_target_lt>(file_traits<arc>::idx__internal);
+    af.semi_transposed = true;
+  }
 }
 
 #endif // ADIAR_INTERNAL_IO_ARC_FILE_H
@@ -26,6 +26,12 @@ namespace adiar::internal
       return parent_t::memory_usage();
     }
 
+    static size_t
+    memory_usage(const size_t read_ahead_blocks)
+    {
+      return parent_t::memory_usage(read_ahead_blocks);
+    }
+
   private:
     static constexpr size_t idx__internal = file_traits<arc>::idx__internal;
 
@@ -111,7 +111,11 @@ namespace adiar::internal
     {
       if (!is_open()) return;
 
+      levelized_ofstream::flush();
+
 #ifdef ADIAR_STATS
+      stats_arc_file.write_stall += levelized_ofstream::write_stall();
+
       if (_elem_ofstreams[idx__terminals__out_of_order].size() != 0u) {
         stats_arc_file.sort_out_of_order += 1;
       }
@@ -0,0 +1,434 @@
+#ifndef ADIAR_INTERNAL_IO_CODEC_H
+#define ADIAR_INTERNAL_IO_CODEC_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <tpie/file_stream.h>
+#include <tpie/tpie.h>
+
+#include <adiar/internal/assert.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Whether new temporary files are to be stored compressed on disk.
+  ///
+  /// \see adiar_compression_init
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  extern std::atomic<bool> global_file_codec;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Delta- and varint-encoding of elements as a sequence of 64-bit words.
+  ///
+  /// \details Each word of an element is stored as the difference to the same word of the prior
+  ///          element. This difference is zigzag encoded (to make small negative values small) and
+  ///          then written with 7 bits per byte. Since labels are constant within a level and
+  ///          identifiers are dense, most words of a `node` or an `arc` are only one or two bytes.
+  ///
+  /// \tparam T Type of the elements.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct file_codec
+  {
+    using value_type = T;
+
+    static_assert(std::is_trivially_copyable<value_type>::value, "Elements must be copyable bytes");
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of words in each element (where the last one may be padded with zeroes).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t words = (sizeof(value_type) + sizeof(uint64_t) - 1u) / sizeof(uint64_t);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Maximum number of bytes needed to encode a single element.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t max_bytes = words * 10u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Encode `e` in relation to the prior element `prev` into `out`.
+    ///
+    /// \returns The number of bytes written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    encode(const value_type& prev, const value_type& e, uint8_t* out)
+    {
+      uint64_t prev_words[words] = {};
+      uint64_t e_words[words]    = {};
+      std::memcpy(prev_words, &prev, sizeof(value_type));
+      std::memcpy(e_words, &e, sizeof(value_type));
+
+      size_t bytes = 0u;
+      for (size_t w = 0u; w < words; ++w) {
+        const uint64_t delta = e_words[w] - prev_words[w];
+        const uint64_t sign  = static_cast<uint64_t>(static_cast<int64_t>(delta) >> 63);
+
+        uint64_t zigzag = (delta << 1) ^ sign;
+
+        while (0x80u <= zigzag) {
+          out[bytes++] = static_cast<uint8_t>(zigzag) | 0x80u;
+          zigzag >>= 7;
+        }
+        out[bytes++] = static_cast<uint8_t>(zigzag);
+      }
+      return bytes;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Decode the element following `prev` from `in`.
+    ///
+    /// \returns The number of bytes read.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    decode(const value_type& prev, const uint8_t* in, value_type& e)
+    {
+      uint64_t e_words[words] = {};
+      std::memcpy(e_words, &prev, sizeof(value_type));
+
+      size_t bytes = 0u;
+      for (size_t w = 0u; w < words; ++w) {
+        uint64_t zigzag = 0u;
+        for (uint8_t shift = 0u;; shift += 7u) {
+          const uint8_t b = in[bytes++];
+          zigzag |= static_cast<uint64_t>(b & 0x7Fu) << shift;
+          if (b < 0x80u) { break; }
+        }
+        e_words[w] += (zigzag >> 1) ^ (~(zigzag & 1u) + 1u);
+      }
+      std::memcpy(&e, e_words, sizeof(value_type));
+      return bytes;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   A block of encoded elements in a compressed file.
+  ///
+  /// \details Each block is encoded independently of all others, i.e. the first element is encoded
+  ///          in relation to the all-zero element. This way, a file can be read in either direction
+  ///          one block at a time.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  struct codec_block
+  {
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes available for encoded elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t capacity = 2048u - 2u * sizeof(uint32_t);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements in this block.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t elements;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes used in `data`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint32_t bytes;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The encoded elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint8_t data[capacity];
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Append-only writer of elements to a compressed file.
+  ///
+  /// \tparam T Type of the file's elements.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class codec_writer
+  {
+  public:
+    using value_type = T;
+    using codec_type = file_codec<value_type>;
+
+    static_assert(codec_type::max_bytes <= codec_block::capacity, "Elements must fit into a block");
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage()
+    {
+      return tpie::file_stream<codec_block>::memory_usage();
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief TPIE's file stream object to write the blocks with.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::file_stream<codec_block> _stream;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The block currently being filled.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    codec_block _block;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The last element written to the current block.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    value_type _prev;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file's number of elements (updated on every write).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t* _size = nullptr;
+
+  public:
+    codec_writer() = default;
+
+    codec_writer(const codec_writer&) = delete;
+
+    ~codec_writer()
+    {
+      close();
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Open a compressed file and append to its end.
+    ///
+    /// \param f    The file with the encoded blocks.
+    ///
+    /// \param size The number of elements in `f`, which is kept up-to-date while writing.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    open(tpie::temp_file& f, size_t& size)
+    {
+      if (is_open()) { close(); }
+
+      _stream.open(f, tpie::access_type::access_write);
+      _stream.seek(0, tpie::file_stream_base::end);
+
+      __reset_block();
+
+      _size = &size;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the writer is currently open.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_open() const
+    {
+      return _stream.is_open();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Flush the last block and close the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    close()
+    {
+      if (!is_open()) { return; }
+
+      __flush();
+      _stream.close();
+      _size = nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Append an element to the file.
+    ///
+    /// \pre `is_open() == true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    write(const value_type& e)
+    {
+      adiar_assert(is_open());
+
+      uint8_t encoded[codec_type::max_bytes];
+      size_t bytes = codec_type::encode(_prev, e, encoded);
+
+      if (codec_block::capacity < _block.bytes + bytes) {
+        __flush();
+        bytes = codec_type::encode(_prev, e, encoded);
+      }
+
+      std::memcpy(_block.data + _block.bytes, encoded, bytes);
+      _block.bytes += bytes;
+      _block.elements += 1u;
+
+      _prev = e;
+      *_size += 1u;
+    }
+
+  private:
+    void
+    __reset_block()
+    {
+      _block.elements = 0u;
+      _block.bytes    = 0u;
+      std::memset(&_prev, 0, sizeof(value_type));
+    }
+
+    void
+    __flush()
+    {
+      if (_block.elements == 0u) { return; }
+
+      _stream.write(_block);
+      __reset_block();
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Reader of the elements of a compressed file in a one-way reading direction.
+  ///
+  /// \tparam T       Type of the file's elements.
+  ///
+  /// \tparam Reverse Whether the reading direction should be reversed.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T, bool Reverse = false>
+  class codec_reader
+  {
+  public:
+    using value_type = T;
+    using codec_type = file_codec<value_type>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Maximum number of elements within a single block.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t max_elements = codec_block::capacity / codec_type::words;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage()
+    {
+      return tpie::file_stream<codec_block>::memory_usage() + max_elements * sizeof(value_type);
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief TPIE's file stream object to read the blocks with.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable tpie::file_stream<codec_block> _stream;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The decoded elements of the current block.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<value_type> _elems;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Position of the read head within `_elems`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _idx = 0u;
+
+  public:
+    codec_reader() = default;
+
+    codec_reader(const codec_reader&) = delete;
+
+    ~codec_reader()
+    {
+      close();
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Open a compressed file and move the read head to its beginning.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    open(tpie::temp_file& f)
+    {
+      if (is_open()) { close(); }
+
+      _stream.open(f, tpie::access_type::access_read);
+      _elems.reserve(max_elements);
+      reset();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the reader is currently open.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_open() const
+    {
+      return _stream.is_open();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Close the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    close()
+    {
+      _stream.close();
+      std::vector<value_type>().swap(_elems);
+      _idx = 0u;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move the read head back to the beginning (relatively to the reading direction).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    reset()
+    {
+      _elems.clear();
+      _idx = 0u;
+
+      if constexpr (Reverse) {
+        _stream.seek(0, tpie::file_stream_base::end);
+      } else {
+        _stream.seek(0);
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether there are more elements to read.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_read() const
+    {
+      if constexpr (Reverse) {
+        return 0u < _idx || _stream.can_read_back();
+      } else {
+        return _idx < _elems.size() || _stream.can_read();
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read the next element.
+    ///
+    /// \pre `can_read() == true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type
+    read()
+    {
+      adiar_assert(can_read());
+      if constexpr (Reverse) {
+        if (_idx == 0u) { __decode(_stream.read_back()); }
+        return _elems[--_idx];
+      } else {
+        if (_idx == _elems.size()) { __decode(_stream.read()); }
+        return _elems[_idx++];
+      }
+    }
+
+  private:
+    void
+    __decode(const codec_block& b)
+    {
+      adiar_assert(0u < b.elements && b.elements <= max_elements);
+
+      _elems.resize(b.elements);
+
+      value_type prev;
+      std::memset(&prev, 0, sizeof(value_type));
+
+      size_t offset = 0u;
+      for (size_t i = 0u; i < b.elements; ++i) {
+        offset += codec_type::decode(prev, b.data + offset, _elems[i]);
+        prev = _elems[i];
+      }
+      adiar_assert(offset == b.bytes, "Block must be decoded exactly");
+
+      _idx = Reverse ? _elems.size() : 0u;
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_IO_CODEC_H
@@ -0,0 +1,8 @@
+#include "file.h"
+
+namespace adiar::internal
+{
+  memory_file_pool global_memory_file_pool;
+
+  std::atomic<bool> global_file_codec = false;
+}
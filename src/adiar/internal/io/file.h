@@ -1,9 +1,12 @@
 #ifndef ADIAR_INTERNAL_IO_FILE_H
 #define ADIAR_INTERNAL_IO_FILE_H
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <limits> // TODO <-- remove?
 #include <string>
+#include <vector>
 
 #include <adiar/exception.h>
 #include <tpie/file_stream.h>
@@ -12,6 +15,11 @@
 #include <tpie/tpie.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/data_structures/sorter.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/data_types/node_uint32.h>
+#include <adiar/internal/io/codec.h>
+#include <adiar/internal/io/mmap_file.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -30,6 +38,371 @@ namespace adiar::internal
   template <typename T>
   struct file_traits;
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Narrower layout of the elements of a `file<elem_type>` on disk.
+  ///
+  /// \details If `enabled`, then the content of a temporary file on disk is stored with elements of
+  ///          type `narrow_type` as long as every element `fits`. The first element that does not
+  ///          fit moves the entire content (back) into its wide layout.
+  ///
+  /// \tparam T
+  ///    Element type in the file.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  struct file_layout
+  {
+    static constexpr bool enabled = false;
+
+    using narrow_type = T;
+
+    static bool
+    fits(const T&)
+    {
+      return false;
+    }
+
+    static narrow_type
+    narrow(const T& t)
+    {
+      return t;
+    }
+
+    static T
+    widen(const narrow_type& t)
+    {
+      return t;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Nodes are stored on disk with 32-bit pointers, if the diagram is small enough.
+  ///
+  /// \see node_uint32
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <>
+  struct file_layout<node>
+  {
+    static constexpr bool enabled = true;
+
+    using narrow_type = node_uint32;
+
+    static bool
+    fits(const node& n)
+    {
+      return fits_uint32(n);
+    }
+
+    static narrow_type
+    narrow(const node& n)
+    {
+      return internal::narrow(n);
+    }
+
+    static node
+    widen(const narrow_type& n)
+    {
+      return internal::widen(n);
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Memory set aside to keep temporary files in internal memory.
+  ///
+  /// \details A new temporary file starts out in internal memory, if this pool has any capacity.
+  ///          It is spilled to disk when it outgrows the per-file limit or the pool is exhausted.
+  ///
+  /// \see adiar_memfile_init
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class memory_file_pool
+  {
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Total number of bytes that may be used by all files.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> _capacity = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes a single file may use before it is spilled to disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> _file_limit = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes currently used by all files.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> _used = 0u;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Set the total capacity and the per-file limit (in bytes).
+    ///
+    /// \remark Files that already are in internal memory stay there until they are destructed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    set_capacity(const size_t capacity, const size_t file_limit)
+    {
+      _capacity   = capacity;
+      _file_limit = file_limit;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Total number of bytes that may be used by all files.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    capacity() const
+    {
+      return _capacity;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes currently used by all files.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    used() const
+    {
+      return _used;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether new temporary files are to start in internal memory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    enabled() const
+    {
+      return 0u < _capacity;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Try to take more memory for a single file.
+    ///
+    /// \param bytes      Number of additional bytes.
+    ///
+    /// \param file_bytes Number of bytes the file uses afterwards.
+    ///
+    /// \returns Whether the memory was taken; if not, the file should be spilled to disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    allocate(const size_t bytes, const size_t file_bytes)
+    {
+      if (_file_limit < file_bytes) { return false; }
+
+      size_t used = _used;
+      do {
+        if (_capacity < used + bytes) { return false; }
+      } while (!_used.compare_exchange_weak(used, used + bytes));
+      return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Give back memory of a file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    deallocate(const size_t bytes)
+    {
+      adiar_assert(bytes <= _used, "Cannot give back more memory than was taken");
+      _used -= bytes;
+    }
+  };
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Memory shared by all temporary files that are kept in internal memory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  extern memory_file_pool global_memory_file_pool;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Content of a file that is kept in internal memory.
+  ///
+  /// \details All memory is taken from (and given back to) the `global_memory_file_pool`.
+  ///
+  /// \tparam T Type of the file's content.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class memory_file_buffer
+  {
+  public:
+    using value_type = T;
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The elements of the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<value_type> _elems;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements for which memory has been taken from the pool.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _capacity = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of readers that currently read the elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::atomic<size_t> _readers = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the elements are to be released when the last reader is detached.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _release_pending = false;
+
+  public:
+    memory_file_buffer() = default;
+
+    memory_file_buffer(const memory_file_buffer&) = delete;
+
+    memory_file_buffer(memory_file_buffer&& o)
+      : _elems(std::move(o._elems))
+      , _capacity(o._capacity)
+    {
+      adiar_assert(o._readers == 0u, "Cannot move elements that are being read");
+      o._elems.clear();
+      o._capacity = 0u;
+    }
+
+    memory_file_buffer&
+    operator=(memory_file_buffer&& o)
+    {
+      if (this != &o) {
+        adiar_assert(o._readers == 0u, "Cannot move elements that are being read");
+        release();
+        _elems      = std::move(o._elems);
+        _capacity   = o._capacity;
+        o._elems.clear();
+        o._capacity = 0u;
+      }
+      return *this;
+    }
+
+    ~memory_file_buffer()
+    {
+      adiar_assert(_readers == 0u, "Cannot destruct elements that are being read");
+      release();
+    }
+
+  private:
+    bool
+    reserve(const size_t capacity)
+    {
+      if (capacity <= _capacity) { return true; }
+
+      // While the elements are moved to a larger vector, both the old and the new one are alive.
+      // Hence, the entire new vector is taken from the pool before the old one is given back.
+      const size_t bytes = capacity * sizeof(value_type);
+      if (!global_memory_file_pool.allocate(bytes, bytes)) { return false; }
+
+      _elems.reserve(capacity);
+      global_memory_file_pool.deallocate(_capacity * sizeof(value_type));
+      _capacity = capacity;
+      return true;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Add an element to the end.
+    ///
+    /// \returns Whether there was memory for the element; if not, nothing has been changed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    push(const value_type& e)
+    {
+      adiar_assert(_readers == 0u, "Cannot write elements that are being read");
+      if (_elems.size() == _capacity && !reserve(std::max<size_t>(2u * _capacity, 16u))) {
+        return false;
+      }
+      _elems.push_back(e);
+      return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Replace the content with a copy of another buffer.
+    ///
+    /// \returns Whether there was memory for the copy; if not, nothing has been changed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    assign(const memory_file_buffer& o)
+    {
+      adiar_assert(_readers == 0u, "Cannot write elements that are being read");
+      if (!reserve(o.size())) { return false; }
+      _elems = o._elems;
+      return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Remove all elements and give back their memory to the pool.
+    ///
+    /// \details If any reader is attached, then this is postponed until the last one is detached.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    release()
+    {
+      if (0u < _readers) {
+        _release_pending = true;
+        return;
+      }
+      std::vector<value_type>().swap(_elems);
+      global_memory_file_pool.deallocate(_capacity * sizeof(value_type));
+      _capacity        = 0u;
+      _release_pending = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Register a reader of the elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    attach_reader()
+    {
+      _readers++;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Unregister a reader of the elements (and release them, if this was postponed).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    detach_reader()
+    {
+      adiar_assert(0u < _readers, "Cannot detach more readers than were attached");
+      if (--_readers == 0u && _release_pending) { release(); }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of readers that currently read the elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    readers() const
+    {
+      return _readers;
+    }
+
+    size_t
+    size() const
+    {
+      return _elems.size();
+    }
+
+    const value_type*
+    data() const
+    {
+      return _elems.data();
+    }
+
+    const value_type&
+    operator[](const size_t idx) const
+    {
+      adiar_assert(idx < size());
+      return _elems[idx];
+    }
+
+    typename std::vector<value_type>::iterator
+    begin()
+    {
+      adiar_assert(_readers == 0u, "Cannot write elements that are being read");
+      return _elems.begin();
+    }
+
+    typename std::vector<value_type>::iterator
+    end()
+    {
+      return _elems.end();
+    }
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief     A file on disk.
   ///
@@ -71,7 +444,77 @@ namespace adiar::internal
     mutable tpie::temp_file _tpie_file;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    // TODO: atomic read-write counter?
+    /// \brief The file's content while it is kept in internal memory.
+    ///
+    /// \remark This variable is made 'mutable' for the same reason as `_tpie_file`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable memory_file_buffer<value_type> _memory;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content is (still) kept in `_memory` rather than in `_tpie_file`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable bool _in_memory = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content in `_memory` has been created, i.e. whether the file would exist
+    ///        on disk by now.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable bool _memory_exists = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file's content in compressed blocks, if `_compressed`.
+    ///
+    /// \remark This variable is made 'mutable' for the same reason as `_tpie_file`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable tpie::temp_file _codec_file;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements in `_codec_file`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable size_t _codec_size = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content on disk is stored in `_codec_file` rather than in `_tpie_file`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable bool _compressed = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Narrower layout of the elements on disk (if any).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using layout = file_layout<value_type>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the elements on disk, if `_narrow`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using narrow_type = typename layout::narrow_type;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file's content in its narrow layout, if `_narrow`.
+    ///
+    /// \remark This variable is made 'mutable' for the same reason as `_tpie_file`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable tpie::temp_file _narrow_file;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content on disk is stored in `_narrow_file` rather than in `_tpie_file`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable bool _narrow = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read-only memory mapping of the (saved) file on disk that contains the content, if
+    ///        any. If so, then `_tpie_file` names this file but is not used to read it.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    shared_ptr<const mmap_file> _mapping;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Start of the content within `_mapping`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type* _mapped_data = nullptr;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements at `_mapped_data`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _mapped_size = 0u;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Befriend the few places that need direct access to these variables.
@@ -91,12 +534,17 @@ namespace adiar::internal
     template <typename value_type>
     friend class levelized_ofstream;
 
+    friend class saved_file;
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Constructor for a new unammed \em temporary file.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     file()
       : _tpie_file()
+      , _in_memory(global_memory_file_pool.enabled())
+      , _compressed(global_file_codec)
+      , _narrow(layout::enabled && !_compressed)
     {}
 
   public:
@@ -134,6 +582,7 @@ namespace adiar::internal
     void
     make_persistent()
     {
+      __decompress();
       _tpie_file.set_persistent(true);
       if (!exists()) { touch(); }
     }
@@ -150,14 +599,224 @@ namespace adiar::internal
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Whether the file actually exists on disk.
+    /// \brief Whether the file's content is kept in internal memory rather than on disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_in_memory() const
+    {
+      return _in_memory;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file's content on disk is compressed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_compressed() const
+    {
+      return _compressed;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file's content on disk is stored in a narrower layout.
+    ///
+    /// \see file_layout
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_narrow() const
+    {
+      return _narrow;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file's content is read directly from a memory-mapped file on disk.
+    ///
+    /// \see mapped_data
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_mapped() const
+    {
+      return _mapped_data != nullptr;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the first element of the memory-mapped content.
+    ///
+    /// \pre `is_mapped() == true`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type*
+    mapped_data() const
+    {
+      adiar_assert(is_mapped());
+      return _mapped_data;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read the content directly from a part of a memory-mapped file.
+    ///
+    /// \details The file is persistent and read-only, i.e. it is neither written to nor removed.
+    ///
+    /// \param mapping The memory-mapped file.
+    ///
+    /// \param offset  Number of bytes before the first element.
+    ///
+    /// \param size    Number of elements.
+    ///
+    /// \pre `exists() == false`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __map(const shared_ptr<const mmap_file>& mapping, const size_t offset, const size_t size)
+    {
+      adiar_assert(!exists(), "Content would be lost");
+      adiar_assert(offset % alignof(value_type) == 0u, "Elements should be aligned");
+      adiar_assert(offset + size * sizeof(value_type) <= mapping->size(), "Elements are mapped");
+
+      _memory.release();
+      _in_memory     = false;
+      _memory_exists = false;
+      _compressed    = false;
+      _narrow        = false;
+
+      _tpie_file.set_path(mapping->path(), true);
+
+      _mapping     = mapping;
+      _mapped_data = reinterpret_cast<const value_type*>(mapping->data() + offset);
+      _mapped_size = size;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move the content from internal memory to disk (if need be).
+    ///
+    /// \details Readers that are attached to the content in internal memory keep reading it. Its
+    ///          memory is only given back when the last of them is detached.
+    ///
+    /// \pre No `ofstream` is currently attached to this file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __spill() const
+    {
+      if (!_in_memory) { return; }
+
+      _in_memory = false;
+
+      // Nothing is to be written, if the file does not exist yet.
+      if (!_memory_exists) {
+        _memory.release();
+        return;
+      }
+
+      // Only use the narrow layout, if all of the content fits.
+      for (size_t i = 0u; _narrow && i < _memory.size(); ++i) {
+        _narrow = layout::fits(_memory[i]);
+      }
+
+      if (_compressed) {
+        codec_writer<value_type> cw;
+        cw.open(_codec_file, _codec_size);
+        for (size_t i = 0u; i < _memory.size(); ++i) { cw.write(_memory[i]); }
+      } else if (_narrow) {
+        tpie::file_stream<narrow_type> fs;
+        fs.open(_narrow_file, w_access);
+        for (size_t i = 0u; i < _memory.size(); ++i) { fs.write(layout::narrow(_memory[i])); }
+      } else {
+        tpie::file_stream<value_type> fs;
+        fs.open(_tpie_file, w_access);
+        for (size_t i = 0u; i < _memory.size(); ++i) { fs.write(_memory[i]); }
+      }
+
+      _memory.release();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Store the content on disk in its wide layout (if need be).
+    ///
+    /// \pre `_in_memory == false` and no `ifstream` or `ofstream` is currently attached to this
+    ///      file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __widen() const
+    {
+      adiar_assert(!_in_memory, "Content must be on disk");
+      if (!_narrow) { return; }
+
+      if (std::filesystem::exists(_narrow_file.path())) {
+        tpie::file_stream<narrow_type> in;
+        in.open(_narrow_file, r_access);
+
+        tpie::file_stream<value_type> out;
+        out.open(_tpie_file, w_access);
+        while (in.can_read()) { out.write(layout::widen(in.read())); }
+      }
+
+      _narrow_file.free();
+      _narrow = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move the content to disk (if need be) and store it uncompressed in its wide layout.
+    ///
+    /// \details Writers with random access and persistent files are only supported on uncompressed
+    ///          files.
+    ///
+    /// \pre No `ifstream` or `ofstream` is currently attached to this file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __decompress() const
+    {
+      // Content in internal memory is written to disk uncompressed and wide right away.
+      if (_in_memory) {
+        _compressed = false;
+        _narrow     = false;
+      }
+
+      __spill();
+      __widen();
+      if (!_compressed) { return; }
+
+      if (std::filesystem::exists(_codec_file.path())) {
+        codec_reader<value_type> cr;
+        cr.open(_codec_file);
+
+        tpie::file_stream<value_type> fs;
+        fs.open(_tpie_file, w_access);
+        while (cr.can_read()) { fs.write(cr.read()); }
+      }
+
+      _codec_file.free();
+      _codec_size = 0u;
+      _compressed = false;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file actually exists, i.e. it has been created in internal memory or on
+    ///        disk.
     ///
     /// \see path
     ////////////////////////////////////////////////////////////////////////////////////////////////
     bool
     exists() const
     {
-      return std::filesystem::exists(path());
+      if (_in_memory) { return _memory_exists; }
+      if (is_mapped()) { return true; }
+      return std::filesystem::exists(__disk_path());
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Path of the file on disk that (is to) contain the content.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const std::string&
+    __disk_path() const
+    {
+      if (_compressed) { return _codec_file.path(); }
+      if (_narrow) { return _narrow_file.path(); }
+      return path();
     }
 
   public:
@@ -167,13 +826,35 @@ namespace adiar::internal
     size_t
     size() const
     {
+      if (_in_memory) { return _memory.size(); }
+      if (_compressed) { return _codec_size; }
+      if (is_mapped()) { return _mapped_size; }
       if (!exists()) { return 0u; }
 
+      if (_narrow) {
+        tpie::file_stream<narrow_type> fs;
+        fs.open(_narrow_file, r_access);
+        return fs.size();
+      }
+
       tpie::file_stream<value_type> fs;
       fs.open(_tpie_file, r_access);
       return fs.size();
     }
 
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes taken up by the file's content on disk, i.e. zero if it is in
+    ///        internal memory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    disk_size() const
+    {
+      if (_in_memory || !exists()) { return 0u; }
+      if (is_mapped()) { return _mapped_size * sizeof(value_type); }
+      return std::filesystem::file_size(__disk_path());
+    }
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Whether the file is empty.
@@ -190,14 +871,28 @@ namespace adiar::internal
     {
       if (exists()) return;
 
+      // The file exists in internal memory, after it has been touched.
+      if (_in_memory) {
+        _memory_exists = true;
+        return;
+      }
+
       // The file exists on disk, after opening it with write access.
-      tpie::file_stream<value_type> fs;
-      fs.open(_tpie_file, w_access);
+      if (_compressed) {
+        tpie::file_stream<codec_block> fs;
+        fs.open(_codec_file, w_access);
+      } else if (_narrow) {
+        tpie::file_stream<narrow_type> fs;
+        fs.open(_narrow_file, w_access);
+      } else {
+        tpie::file_stream<value_type> fs;
+        fs.open(_tpie_file, w_access);
+      }
     }
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Creates the file on disk, if it does not yet exist.
+    /// \brief Creates the file (in internal memory or on disk), if it does not yet exist.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void
     touch()
@@ -245,6 +940,14 @@ namespace adiar::internal
     void
     set_path(const std::string& p)
     {
+      adiar_assert(!_in_memory || _memory.size() == 0u, "Content in memory would be lost");
+      _memory.release();
+      _in_memory     = false;
+      _memory_exists = false;
+
+      adiar_assert(!_compressed, "Compressed content would be lost");
+      adiar_assert(!_narrow, "Narrow content would be lost");
+      adiar_assert(!is_mapped(), "Mapped content would be lost");
       _tpie_file.set_path(p);
     }
 
@@ -282,6 +985,9 @@ namespace adiar::internal
         throw runtime_error("'" + new_path + "' already exists.");
       }
 
+      // Make sure the (uncompressed) content is on disk to be moved.
+      __decompress();
+
       // Move the file on disk, if it exists.
       if (exists()) {
         try { // Try to move it in O(1) time.
@@ -330,14 +1036,86 @@ namespace adiar::internal
       // If empty, just skip all the work
       if (size() == 0u) return;
 
-      // Use TPIE's file sorting.
-      tpie::file_stream<value_type> fs;
-      fs.open(_tpie_file);
+      // Sort in internal memory, if the content is there
+      if (_in_memory) {
+        std::sort(_memory.begin(), _memory.end(), pred);
+        return;
+      }
+
+      // Sort compressed content without decompressing it on disk
+      if (_compressed) {
+        __sort_compressed(pred);
+        return;
+      }
 
       tpie::progress_indicator_null pi;
+
+      // Sort narrow content without widening it on disk
+      if (_narrow) {
+        tpie::file_stream<narrow_type> fs;
+        fs.open(_narrow_file);
+        tpie::sort(fs, __narrow_pred(pred), pi);
+        return;
+      }
+
+      // Use TPIE's file sorting
+      tpie::file_stream<value_type> fs;
+      fs.open(_tpie_file);
       tpie::sort(fs, pred, pi);
     }
 
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Lift a predicate on elements to their narrow layout.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename pred_t>
+    static auto
+    __narrow_pred(pred_t pred)
+    {
+      return [pred](const narrow_type& a, const narrow_type& b) {
+        return pred(layout::widen(a), layout::widen(b));
+      };
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Sort the compressed content on disk by decoding it into an external sorter and then
+    ///        encoding its output into a new compressed file.
+    ///
+    /// \pre `_compressed == true`, `_in_memory == false`, and no `ifstream` nor `ofstream` is
+    ///      attached to this file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename pred_t>
+    void
+    __sort_compressed(pred_t pred) const
+    {
+      adiar_assert(_compressed && !_in_memory, "Content must be compressed on disk");
+
+      const size_t codec_memory =
+        codec_reader<value_type>::memory_usage() + codec_writer<value_type>::memory_usage();
+      const size_t available_memory = tpie::get_memory_manager().available();
+
+      external_sorter<value_type, pred_t> sorter(
+        codec_memory < available_memory ? available_memory - codec_memory : 0u,
+        _codec_size,
+        1u,
+        pred);
+
+      {
+        codec_reader<value_type> cr;
+        cr.open(_codec_file);
+        while (cr.can_read()) { sorter.push(cr.read()); }
+      }
+      sorter.sort();
+
+      _codec_file.free();
+      _codec_size = 0u;
+
+      codec_writer<value_type> cw;
+      cw.open(_codec_file, _codec_size);
+      while (sorter.can_pull()) { cw.write(sorter.pull()); }
+    }
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Create a copy of a file.
@@ -351,7 +1129,49 @@ namespace adiar::internal
       if (!f.exists()) { return file<value_type>(); }
 
       file<value_type> ret;
-      std::filesystem::copy(f.path(), ret.path());
+
+      if (f._in_memory) {
+        // Copy within internal memory, if possible. Otherwise, write the copy to disk.
+        if (ret._in_memory && ret._memory.assign(f._memory)) {
+          ret._memory_exists = true;
+          return ret;
+        }
+
+        ret._in_memory  = false;
+        ret._compressed = false;
+        ret._narrow     = false;
+        {
+          tpie::file_stream<value_type> fs;
+          fs.open(ret._tpie_file, w_access);
+          for (size_t i = 0u; i < f._memory.size(); ++i) { fs.write(f._memory[i]); }
+        }
+        return ret;
+      }
+
+      ret._in_memory = false;
+
+      if (f.is_mapped()) {
+        ret._compressed = false;
+        ret._narrow     = false;
+        {
+          tpie::file_stream<value_type> fs;
+          fs.open(ret._tpie_file, w_access);
+          for (size_t i = 0u; i < f._mapped_size; ++i) { fs.write(f._mapped_data[i]); }
+        }
+        return ret;
+      }
+
+      if (f._compressed) {
+        ret._compressed = true;
+        ret._narrow     = false;
+        ret._codec_size = f._codec_size;
+        std::filesystem::copy(f._codec_file.path(), ret._codec_file.path());
+        return ret;
+      }
+
+      ret._compressed = false;
+      ret._narrow     = f._narrow;
+      std::filesystem::copy(f.__disk_path(), ret.__disk_path());
       return ret;
     }
   };
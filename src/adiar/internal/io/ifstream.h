@@ -1,12 +1,16 @@
 #ifndef ADIAR_INTERNAL_IO_IFSTREAM_H
 #define ADIAR_INTERNAL_IO_IFSTREAM_H
 
+#include <algorithm>
+
 #include <tpie/file_stream.h>
 #include <tpie/sort.h>
 #include <tpie/tpie.h>
 
 #include <adiar/internal/assert.h>
+#include <adiar/internal/io/codec.h>
 #include <adiar/internal/io/file.h>
+#include <adiar/internal/io/prefetch.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -27,12 +31,28 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     using value_type = T;
 
+  private:
+    using layout      = file_layout<value_type>;
+    using narrow_type = typename layout::narrow_type;
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     static size_t
     memory_usage()
     {
-      return tpie::file_stream<value_type>::memory_usage();
+      // Only one of the three streams is open at a time.
+      return std::max({ tpie::file_stream<value_type>::memory_usage(),
+                        tpie::file_stream<narrow_type>::memory_usage(),
+                        codec_reader<value_type, Reverse>::memory_usage() });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used when reading ahead the given number of blocks.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(const size_t read_ahead_blocks)
+    {
+      return memory_usage() + prefetcher<value_type>::memory_usage(read_ahead_blocks);
     }
 
   private:
@@ -47,6 +67,54 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     mutable typename tpie::file_stream<value_type> _stream;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief TPIE's file stream object to read the file with, if its content is stored in its
+    ///        narrow layout. If so, then `_stream` is unused.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable typename tpie::file_stream<narrow_type> _narrow_stream;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file, if its content is kept in internal memory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const file<value_type>* _memory_file = nullptr;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content is read directly from `_span`, i.e. it is kept in internal memory
+    ///        or it is memory-mapped. If so, then `_stream` is unused.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _span_open = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file's content, if it is read directly.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type* _span = nullptr;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements in `_span`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _span_size = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Position of the read head within `_span`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable size_t _span_idx = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Reader of the file's content, if it is compressed. If so, then `_stream` is unused.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable codec_reader<value_type, Reverse> _codec;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of blocks to read ahead (if zero, then `_prefetcher` is unused).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _read_ahead = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Background reader of `_stream`, `_narrow_stream`, or `_codec`. While it runs, none of
+    ///        them may be touched by this thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mutable prefetcher<value_type> _prefetcher;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Buffer of a single element, since TPIE does not support a `peek_back` function yet
     ///        (TPIE Issue #187).
@@ -107,6 +175,40 @@ namespace adiar::internal
       // '__touch()' member function instead.
       f.__touch();
 
+      // Read directly from internal memory, if the content is there
+      if (f._in_memory) {
+        _memory_file = &f;
+        _memory_file->_memory.attach_reader();
+
+        _span_open = true;
+        _span      = f._memory.data();
+        _span_size = f._memory.size();
+        reset();
+        return;
+      }
+
+      // Read directly from the mapped file, if the content is memory-mapped
+      if (f.is_mapped()) {
+        _span_open = true;
+        _span      = f._mapped_data;
+        _span_size = f._mapped_size;
+        reset();
+        return;
+      }
+
+      // Decode the blocks, if the content is compressed
+      if (f._compressed) {
+        _codec.open(f._codec_file);
+        return;
+      }
+
+      // Widen the elements while reading, if the content is stored in its narrow layout
+      if (f._narrow) {
+        _narrow_stream.open(f._narrow_file, file<value_type>::r_access);
+        reset();
+        return;
+      }
+
       // Open the stream to the file
       _stream.open(f._tpie_file, file<value_type>::r_access);
       reset();
@@ -146,7 +248,7 @@ namespace adiar::internal
     bool
     is_open() const
     {
-      return _stream.is_open();
+      return _span_open || _codec.is_open() || _narrow_stream.is_open() || _stream.is_open();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +257,17 @@ namespace adiar::internal
     void
     close()
     {
+      _prefetcher.stop();
+      _read_ahead = 0u;
+      if (_memory_file) {
+        _memory_file->_memory.detach_reader();
+        _memory_file = nullptr;
+      }
+      _span_open = false;
+      _span      = nullptr;
+      _span_size = 0u;
+      _codec.close();
+      _narrow_stream.close();
       _stream.close();
       if (_file_ptr) { _file_ptr.reset(); }
     }
@@ -165,18 +278,107 @@ namespace adiar::internal
     void
     reset()
     {
-      if constexpr (Reverse) {
+      if (_span_open) {
+        _span_idx = Reverse ? _span_size : 0u;
+        return;
+      }
+      _prefetcher.stop();
+      if (_codec.is_open()) {
+        _codec.reset();
+      } else if (_narrow_stream.is_open()) {
+        _narrow_stream.seek(0,
+                            Reverse ? tpie::file_stream_base::end
+                                    : tpie::file_stream_base::beginning);
+      } else if constexpr (Reverse) {
         _stream.seek(0, tpie::file_stream_base::end);
       } else {
         _stream.seek(0);
       }
+      __start_read_ahead();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read up to `blocks` many blocks ahead in a background thread while the file is open.
+    ///
+    /// \details This overlaps the latency of the disk with the computation of the caller. Content
+    ///          kept in internal memory or memory-mapped is not read ahead. If `blocks` is zero, then
+    ///          reading ahead is turned off.
+    ///
+    /// \pre `is_open() == true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    read_ahead(const size_t blocks)
+    {
+      adiar_assert(is_open());
+      _prefetcher.stop();
+      _read_ahead = blocks;
+      __start_read_ahead();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether blocks are read ahead in a background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_reading_ahead() const
+    {
+      return _prefetcher.is_running();
     }
 
   private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Start the background reader from the current read head (if requested).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __start_read_ahead()
+    {
+      if (_read_ahead == 0u || _span_open) { return; }
+
+      _prefetcher.start(_read_ahead, [this](value_type* out, const size_t max) -> size_t {
+        size_t n = 0u;
+        if (_codec.is_open()) {
+          while (n < max && _codec.can_read()) { out[n++] = _codec.read(); }
+        } else if (_narrow_stream.is_open()) {
+          while (n < max && __can_read_narrow()) { out[n++] = __read_narrow(); }
+        } else if constexpr (Reverse) {
+          while (n < max && _stream.can_read_back()) { out[n++] = _stream.read_back(); }
+        } else {
+          while (n < max && _stream.can_read()) { out[n++] = _stream.read(); }
+        }
+        return n;
+      });
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    __can_read_narrow() const
+    {
+      if constexpr (Reverse) {
+        return _narrow_stream.can_read_back();
+      } else {
+        return _narrow_stream.can_read();
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type
+    __read_narrow() const
+    {
+      if constexpr (Reverse) {
+        return layout::widen(_narrow_stream.read_back());
+      } else {
+        return layout::widen(_narrow_stream.read());
+      }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     bool
     __can_read() const
     {
+      if (_span_open) { return Reverse ? 0u < _span_idx : _span_idx < _span_size; }
+      if (_prefetcher.is_running()) { return _prefetcher.can_read(); }
+      if (_codec.is_open()) { return _codec.can_read(); }
+      if (_narrow_stream.is_open()) { return __can_read_narrow(); }
       if constexpr (Reverse) {
         return _stream.can_read_back();
       } else {
@@ -201,6 +403,10 @@ namespace adiar::internal
     const value_type
     __read()
     {
+      if (_span_open) { return Reverse ? _span[--_span_idx] : _span[_span_idx++]; }
+      if (_prefetcher.is_running()) { return _prefetcher.read(); }
+      if (_codec.is_open()) { return _codec.read(); }
+      if (_narrow_stream.is_open()) { return __read_narrow(); }
       if constexpr (Reverse) {
         return _stream.read_back();
       } else {
@@ -85,7 +85,11 @@ namespace adiar::internal
       // Hook into reference counting.
       this->_file_ptr = shared_ptr;
 
-      // Open the stream to the file
+      // Memory-mapped content is read-only
+      if (f.is_mapped()) { throw runtime_error("Cannot attach writer to a memory-mapped file"); }
+
+      // Open the stream to the file (which requires its content to be uncompressed on disk)
+      f.__decompress();
       this->_stream.open(f._tpie_file, file<value_type>::rw_access);
     }
 
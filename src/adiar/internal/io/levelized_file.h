@@ -34,6 +34,9 @@ namespace adiar::internal
   template <typename T, bool SplitOnLevels = false>
   class levelized_file;
 
+  // Forward declarations
+  class saved_file;
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief   Files that combined represent a DAG.
   ///
@@ -120,6 +123,8 @@ namespace adiar::internal
     template <bool tparam__REVERSE>
     friend class level_info_ifstream;
 
+    friend class saved_file;
+
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Copy of file statistics but without its content.
@@ -246,17 +251,67 @@ namespace adiar::internal
 
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Whether the file(s) actually exists on disk.
+    /// \brief Whether the file(s) are kept in internal memory rather than on disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_in_memory() const
+    {
+      bool res = _level_info_file.is_in_memory();
+      for (size_t idx = 0; idx < FILES; idx++) { res &= _files[idx].is_in_memory(); }
+      return res;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file(s) are stored compressed on disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_compressed() const
+    {
+      bool res = _level_info_file.is_compressed();
+      for (size_t idx = 0; idx < FILES; idx++) { res &= _files[idx].is_compressed(); }
+      return res;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the element file(s) are stored in a narrower layout on disk.
+    ///
+    /// \see file_layout
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_narrow() const
+    {
+      bool res = true;
+      for (size_t idx = 0; idx < FILES; idx++) { res &= _files[idx].is_narrow(); }
+      return res;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file(s) are read directly from a memory-mapped file on disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_mapped() const
+    {
+      bool res = _level_info_file.is_mapped();
+      for (size_t idx = 0; idx < FILES; idx++) { res &= _files[idx].is_mapped(); }
+      return res;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the file(s) actually exists, i.e. are in internal memory or on disk.
     ///
     /// \see path
     ////////////////////////////////////////////////////////////////////////////////////////////////
     bool
     exists() const
     {
-      const bool res = std::filesystem::exists(_level_info_file.path());
+      const bool res = _level_info_file.exists();
 #ifndef NDEBUG
       for (size_t idx = 0; idx < FILES; idx++) {
-        adiar_assert(std::filesystem::exists(_files[idx].path()) == res,
+        adiar_assert(_files[idx].exists() == res,
                      "Persistence ought to be synchronised.");
       }
 #endif
@@ -274,6 +329,19 @@ namespace adiar::internal
       return _files[idx].size();
     }
 
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the first element of a specific file that is memory-mapped.
+    ///
+    /// \pre `is_mapped() == true`
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type*
+    mapped_data(const size_t idx) const
+    {
+      throw_if_bad_idx(idx);
+      return _files[idx].mapped_data();
+    }
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The number of elements in the file(s).
@@ -286,6 +354,19 @@ namespace adiar::internal
       return sum_size;
     }
 
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The number of bytes taken up by the file(s) and the levelized meta information on
+    ///        disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    disk_size() const
+    {
+      size_t sum_size = _level_info_file.disk_size();
+      for (size_t idx = 0u; idx < FILES; idx++) sum_size += _files[idx].disk_size();
+      return sum_size;
+    }
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief The number of elements in the levelized meta information file
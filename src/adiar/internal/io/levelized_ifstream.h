@@ -42,6 +42,12 @@ namespace adiar::internal
       return streams * ifstream<value_type, Reverse>::memory_usage();
     }
 
+    static size_t
+    memory_usage(const size_t read_ahead_blocks)
+    {
+      return streams * ifstream<value_type, Reverse>::memory_usage(read_ahead_blocks);
+    }
+
   protected:
     ifstream<value_type, Reverse> _ifstreams[streams];
 
@@ -135,6 +141,17 @@ namespace adiar::internal
       for (size_t s_idx = 0; s_idx < streams; s_idx++) _ifstreams[s_idx].reset();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read up to `blocks` many blocks ahead of each sub-stream in the background.
+    ///
+    /// \see ifstream::read_ahead
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    read_ahead(const size_t blocks)
+    {
+      for (size_t s_idx = 0; s_idx < streams; s_idx++) _ifstreams[s_idx].read_ahead(blocks);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Whether the sub-stream contains more elements.
     ////////////////////////////////////////////////////////////////////////////////////////////////
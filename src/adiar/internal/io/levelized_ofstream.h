@@ -29,6 +29,18 @@ namespace adiar::internal
         + 1u * ofstream<level_info>::memory_usage();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used when each file with 'value_type' writes the given number of blocks
+    ///        behind.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(const size_t write_behind_blocks)
+    {
+      return file_traits<value_type>::files
+        * ofstream<value_type>::memory_usage(write_behind_blocks)
+        + 1u * ofstream<level_info>::memory_usage();
+    }
+
   protected:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Pointer to update the meta information.
@@ -144,6 +156,41 @@ namespace adiar::internal
       _file_ptr.reset();
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Write up to `blocks` many blocks of each file with 'value_type' in the background.
+    ///
+    /// \see ofstream::write_behind
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    write_behind(const size_t blocks)
+    {
+      for (size_t s_idx = 0; s_idx < elem_ofstreams; s_idx++) {
+        _elem_ofstreams[s_idx].write_behind(blocks);
+      }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Wait for everything to be written to the files with 'value_type'.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    flush()
+    {
+      for (size_t s_idx = 0; s_idx < elem_ofstreams; s_idx++) { _elem_ofstreams[s_idx].flush(); }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Time (in nanoseconds) spent waiting for the background writers.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t
+    write_stall() const
+    {
+      uint64_t acc = 0u;
+      for (size_t s_idx = 0; s_idx < elem_ofstreams; s_idx++) {
+        acc += _elem_ofstreams[s_idx].write_stall();
+      }
+      return acc;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Write directly to the level_info file.
     ///
@@ -1,6 +1,8 @@
 #ifndef ADIAR_INTERNAL_IO_LEVELIZED_RACCESS_H
 #define ADIAR_INTERNAL_IO_LEVELIZED_RACCESS_H
 
+#include <type_traits>
+
 #include <tpie/array.h>
 
 #include <adiar/internal/dd.h>
@@ -12,6 +14,10 @@ namespace adiar::internal
   /// \brief Random-access to the contents of a levelized file.
   ///
   /// \tparam StreamType Stream to wrap with a *levelized random access* buffer.
+  ///
+  /// \details If the file is memory-mapped (see `saved_file`) and no negation or shift is to be
+  ///          applied, then the elements of each level are accessed in-place rather than being
+  ///          copied into a buffer.
   //
   // TODO: Generalize parts of 'node_raccess' to reuse it with levelized files with other
   //       types of content. Yet, what use-case do we have for this?
@@ -51,11 +57,28 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     const idx_type _max_width;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The memory-mapped elements of the file (if any). If so, then `_level_buffer` is
+    ///        unused.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type* _mapped;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements within `_mapped` that are yet to be read. Since the elements are
+    ///        stored bottom-up, these are the ones at its very start.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _mapped_left;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Buffer with all elements of the current level.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     tpie::array<value_type> _level_buffer;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Start of the elements of the current level within `_mapped` (in descending order).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type* _curr_mapped = nullptr;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Buffer with all elements of the current level.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -92,7 +115,9 @@ namespace adiar::internal
                       const typename T::signed_label_type& shift = 0)
       : _ifstream(f, negate, shift)
       , _max_width(f.width)
-      , _level_buffer(f.width)
+      , _mapped(mapped_data(f, negate, shift))
+      , _mapped_left(_mapped ? f.size(0) : 0u)
+      , _level_buffer(_mapped ? 0u : f.width)
       , _root(_ifstream.peek().uid())
     {
       init();
@@ -107,7 +132,9 @@ namespace adiar::internal
                       const typename T::signed_label_type shift = 0)
       : _ifstream(f, negate, shift)
       , _max_width(f.width)
-      , _level_buffer(f.width)
+      , _mapped(mapped_data(f, negate, shift))
+      , _mapped_left(_mapped ? f.size(0) : 0u)
+      , _level_buffer(_mapped ? 0u : f.width)
       , _root(_ifstream.peek().uid())
     {
       init();
@@ -122,13 +149,28 @@ namespace adiar::internal
                       const typename T::signed_label_type shift = 0)
       : _ifstream(f, negate, shift)
       , _max_width(f->width)
-      , _level_buffer(f->width)
+      , _mapped(mapped_data(*f, negate, shift))
+      , _mapped_left(_mapped ? f->size(0) : 0u)
+      , _level_buffer(_mapped ? 0u : f->width)
       , _root(_ifstream.peek().uid())
     {
       init();
     }
 
   private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The memory-mapped elements of a file, if they can be used as-is.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static const value_type*
+    mapped_data(const levelized_file<T>& f, const bool negate, const signed_label_type shift)
+    {
+      if constexpr (std::is_same_v<T, value_type>) {
+        if (!negate && shift == 0 && f.is_mapped()) { return f.mapped_data(0); }
+      }
+      return nullptr;
+    }
+
     void
     init()
     {
@@ -136,7 +178,10 @@ namespace adiar::internal
 
       // Skip the terminal node for terminal only BDDs. This way, 'has_next_level' is a mere
       // 'can_pull' on the underlying stream.
-      if (_root.is_terminal()) { _ifstream.pull(); }
+      if (_root.is_terminal()) {
+        _ifstream.pull();
+        if (_mapped) { _mapped_left -= 1u; }
+      }
     }
 
   public:
@@ -155,6 +200,7 @@ namespace adiar::internal
     bool
     has_next_level() const
     {
+      if (_mapped) { return 0u < _mapped_left; }
       return _ifstream.can_pull();
     }
 
@@ -166,6 +212,7 @@ namespace adiar::internal
     signed_label_type
     next_level()
     {
+      if (_mapped) { return _mapped[_mapped_left - 1u].uid().label(); }
       return _ifstream.peek().uid().label();
     }
 
@@ -190,6 +237,24 @@ namespace adiar::internal
       // Stop early when going "beyond" the available levels
       if (!has_next_level()) { return; }
 
+      // Point into the requested level of the mapped elements
+      if (_mapped) {
+        while (0u < _mapped_left
+               && static_cast<signed_label_type>(next_level()) < level) {
+          _mapped_left--;
+        }
+
+        const size_t level_end = _mapped_left;
+        while (0u < _mapped_left
+               && static_cast<signed_label_type>(next_level()) == level) {
+          _mapped_left--;
+        }
+
+        _curr_width  = level_end - _mapped_left;
+        _curr_mapped = _mapped + _mapped_left;
+        return;
+      }
+
       // Skip all levels not of interest
       while (_ifstream.can_pull()
              && static_cast<signed_label_type>(_ifstream.peek().uid().label()) < level) {
@@ -259,6 +324,7 @@ namespace adiar::internal
     at(idx_type idx) const
     {
       adiar_assert(idx < current_width());
+      if (_mapped) { return _curr_mapped[_curr_width - 1u - idx]; }
       return _level_buffer[idx];
     }
   };
@@ -0,0 +1,131 @@
+#ifndef ADIAR_INTERNAL_IO_MMAP_FILE_H
+#define ADIAR_INTERNAL_IO_MMAP_FILE_H
+
+#include <string>
+
+#include <adiar/exception.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ADIAR_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Read-only memory mapping of an entire file.
+  ///
+  /// \details The file is mapped as shared, i.e. all processes mapping the same file read the very
+  ///          same pages of the operating system's page cache. Hence, the file must neither change
+  ///          nor be removed while it is mapped.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class mmap_file
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether memory mapping is supported on this platform.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+#ifdef ADIAR_HAS_MMAP
+    static constexpr bool supported = true;
+#else
+    static constexpr bool supported = false;
+#endif
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Path of the mapped file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::string _path;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Start of the mapped memory (`nullptr` if the file is empty).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void* _addr = nullptr;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of mapped bytes.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _size = 0u;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Map the entire file at the given path.
+    ///
+    /// \throws runtime_error If the file cannot be opened or mapped.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    mmap_file(const std::string& path)
+      : _path(path)
+    {
+#ifdef ADIAR_HAS_MMAP
+      const int fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0) { throw runtime_error("'" + path + "' cannot be opened"); }
+
+      struct stat st;
+      if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw runtime_error("'" + path + "' cannot be opened");
+      }
+      _size = static_cast<size_t>(st.st_size);
+
+      if (0u < _size) {
+        void* addr = ::mmap(nullptr, _size, PROT_READ, MAP_SHARED, fd, 0);
+        if (addr == MAP_FAILED) {
+          ::close(fd);
+          throw runtime_error("'" + path + "' cannot be memory mapped");
+        }
+        _addr = addr;
+      }
+      // The mapping stays valid after the descriptor is closed.
+      ::close(fd);
+#else
+      throw runtime_error("Memory mapping of '" + path + "' is not supported on this platform");
+#endif
+    }
+
+    mmap_file(const mmap_file&) = delete;
+    mmap_file(mmap_file&&)      = delete;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Unmaps the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ~mmap_file()
+    {
+#ifdef ADIAR_HAS_MMAP
+      if (_addr) { ::munmap(_addr, _size); }
+#endif
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Path of the mapped file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const std::string&
+    path() const
+    {
+      return _path;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes in the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    size() const
+    {
+      return _size;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Pointer to the first byte of the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const char*
+    data() const
+    {
+      return static_cast<const char*>(_addr);
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_IO_MMAP_FILE_H
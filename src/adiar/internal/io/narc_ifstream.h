@@ -5,6 +5,7 @@
 #include <adiar/internal/data_types/arc.h>
 #include <adiar/internal/data_types/convert.h>
 #include <adiar/internal/data_types/node.h>
+#include <adiar/internal/io/arc_file.h>
 #include <adiar/internal/io/arc_ifstream.h>
 #include <adiar/internal/io/levelized_file.h>
 #include <adiar/internal/io/levelized_ifstream.h>
@@ -25,12 +26,24 @@ namespace adiar::internal
   public:
     using value_type = node;
 
+    static constexpr size_t streams = arc_ifstream<!Reverse>::streams;
+
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Arc-based input to-be converted into nodes on-the-fly.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     arc_ifstream<!Reverse> _ifstream;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether nodes should be \em negated on-the-fly.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _negate = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of levels with which a node ought to be shifted.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    node::signed_label_type _shift = 0;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Whether a converted node has been buffered.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,6 +61,12 @@ namespace adiar::internal
       return arc_ifstream<!Reverse>::memory_usage();
     }
 
+    static size_t
+    memory_usage(const size_t read_ahead_blocks)
+    {
+      return arc_ifstream<!Reverse>::memory_usage(read_ahead_blocks);
+    }
+
   private:
     static constexpr size_t idx__internal = file_traits<arc>::idx__internal;
 
@@ -66,69 +85,99 @@ namespace adiar::internal
     /// \brief Create attached to an arc file.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     narc_ifstream(levelized_file<arc>& file,
-                  [[maybe_unused]] const bool negate                         = false,
-                  [[maybe_unused]] const node::signed_label_type level_shift = 0)
+                  const bool negate                         = false,
+                  const node::signed_label_type level_shift = 0)
       : _ifstream(/*need to sort before attach*/)
     {
-      adiar_assert(negate == false);
-      adiar_assert(level_shift == 0);
-      open(file);
+      open(file, negate, level_shift);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Create attached to a shared arc file.
+    ///
+    /// \pre Its internal arcs are sorted on their source or no one else reads from it.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     narc_ifstream(const shared_ptr<levelized_file<arc>>& file,
-                  [[maybe_unused]] const bool negate                         = false,
-                  [[maybe_unused]] const node::signed_label_type level_shift = 0)
+                  const bool negate                         = false,
+                  const node::signed_label_type level_shift = 0)
       : _ifstream(/*need to sort before attach*/)
     {
-      adiar_assert(negate == false);
-      adiar_assert(level_shift == 0);
-      open(file);
+      open(file, negate, level_shift);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Create attached to an Decision Diagram.
     ///
-    /// \pre The given diagram should contain an unreduced diagram.
+    /// \pre The given diagram should contain an unreduced diagram. Its internal arcs are sorted on
+    ///      their source or no one else reads from it.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     narc_ifstream(const __dd& diagram)
       : _ifstream(/*need to sort before attach*/)
     {
       adiar_assert(diagram.template has<__dd::shared_arc_file_type>());
-      adiar_assert(diagram._negate == false);
-      open(diagram.template get<__dd::shared_arc_file_type>());
+      open(diagram.template get<__dd::shared_arc_file_type>(), diagram._negate, diagram._shift);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief  Open an arc file.
     ///
-    /// \remark This sorts the internal arcs of the file.
+    /// \remark This sorts the internal arcs of the file on their source (if not already).
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void
-    open(levelized_file<arc>& file)
+    open(levelized_file<arc>& file,
+         const bool negate                         = false,
+         const node::signed_label_type level_shift = 0)
     {
-      if (file.semi_transposed) {
-        file.sort<arc_source_lt>(idx__internal);
-        file.semi_transposed = false;
-      }
+      untranspose(file);
       _ifstream.open(file);
+
+      _negate = negate;
+      _shift  = level_shift;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief  Open a shared arc file.
     ///
-    /// \remark This sorts the internal arcs of the file.
+    /// \pre    Its internal arcs are sorted on their source or no one else reads from it.
+    ///
+    /// \remark Usually, the producer of the file already sorts the internal arcs on their source
+    ///         while it is not yet shared (see `exec_policy::chain`). Otherwise, the internal arcs
+    ///         are sorted in-place.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void
-    open(const shared_ptr<levelized_file<arc>>& file)
+    open(const shared_ptr<levelized_file<arc>>& file,
+         const bool negate                         = false,
+         const node::signed_label_type level_shift = 0)
     {
       if (file->semi_transposed) {
-        file->sort<arc_source_lt>(idx__internal);
-        file->semi_transposed = false;
+        adiar_assert(file.use_count() == 1, "Cannot sort a shared arc file in-place");
+        untranspose(*file);
       }
       _ifstream.open(file);
+
+      _negate = negate;
+      _shift  = level_shift;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Close the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    close()
+    {
+      _ifstream.close();
+      _has_peeked = false;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read up to `blocks` many blocks of arcs ahead in the background.
+    ///
+    /// \see ifstream::read_ahead
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    read_ahead(const size_t blocks)
+    {
+      _ifstream.read_ahead(blocks);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,15 +222,18 @@ namespace adiar::internal
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief   Obtain the first node past the seeked value.
+    /// \brief   Obtain the first node "greater than" or "equal" the seeked uid.
     ///
     /// \param u Unique Identifier to seek for.
     ///
-    /// \pre     `can_pull() == true`.
+    /// \pre     `can_pull() == true` and such a node exists.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     const node
-    seek(const node::uid_type& u);
-    // TODO
+    seek(const node::uid_type& u)
+    {
+      while (Reverse ? u < peek().uid() : peek().uid() < u) { pull(); }
+      return peek();
+    }
 
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,11 +244,8 @@ namespace adiar::internal
       const arc a_second = take_internal() ? _ifstream.pull_internal() : _ifstream.pull_terminal();
 
       // Merge into a node (providing low arc first)
-      if constexpr (Reverse) {
-        return node_of(a_second, a_first);
-      } else {
-        return node_of(a_first, a_second);
-      }
+      const node n = Reverse ? node_of(a_second, a_first) : node_of(a_first, a_second);
+      return shift_replace(cnot(n, _negate), _shift);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
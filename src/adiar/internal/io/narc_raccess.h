@@ -35,13 +35,11 @@ namespace adiar::internal
     /// \pre The given levelized file is *indexable*.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     narc_raccess(levelized_file<arc>& f,
-                 const bool negate                                   = false,
-                 [[maybe_unused]] const arc::signed_label_type shift = 0)
-      : parent_type(f, negate)
+                 const bool negate                  = false,
+                 const arc::signed_label_type shift = 0)
+      : parent_type(f, negate, shift)
     {
       // adiar_assert(f.indexable);
-      adiar_assert(negate == false);
-      adiar_assert(shift == false);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,13 +48,11 @@ namespace adiar::internal
     /// \pre The given shared levelized file is *indexable*.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     narc_raccess(const shared_ptr<levelized_file<arc>>& f,
-                 const bool negate                                   = false,
-                 [[maybe_unused]] const arc::signed_label_type shift = 0)
-      : parent_type(f, negate)
+                 const bool negate                  = false,
+                 const arc::signed_label_type shift = 0)
+      : parent_type(f, negate, shift)
     {
       // adiar_assert(f->indexable);
-      adiar_assert(negate == false);
-      adiar_assert(shift == false);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -65,7 +61,9 @@ namespace adiar::internal
     /// \pre The unreduced decision diagram is indexable. This is (almost) always the case.
     ////////////////////////////////////////////////////////////////////////////////////////////////
     narc_raccess(const __dd& diagram)
-      : narc_raccess(diagram.template get<__dd::shared_arc_file_type>(), diagram._negate)
+      : narc_raccess(diagram.template get<__dd::shared_arc_file_type>(),
+                     diagram._negate,
+                     diagram._shift)
     {}
 
   public:
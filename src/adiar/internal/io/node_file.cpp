@@ -2,5 +2,5 @@
 
 namespace adiar::internal
 {
-  statistics::node_file_t stats_node_file;
+  thread_local thread_statistics<&statistics::node_file> stats_node_file;
 }
@@ -1,20 +1,19 @@
 #ifndef ADIAR_INTERNAL_IO_NODE_FILE_H
 #define ADIAR_INTERNAL_IO_NODE_FILE_H
 
-#include <adiar/statistics.h>
-
 #include <adiar/internal/assert.h>
 #include <adiar/internal/data_types/node.h>
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/levelized_file.h>
 #include <adiar/internal/io/shared_file_ptr.h>
+#include <adiar/internal/statistics.h>
 
 namespace adiar::internal
 {
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Struct holding statistics on node files
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  extern statistics::node_file_t stats_node_file;
+  extern thread_local thread_statistics<&statistics::node_file> stats_node_file;
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief A reduced Decision Diagram.
@@ -81,6 +80,18 @@ namespace adiar::internal
         return this->sorted && this->indexable;
       }
 
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief   Structural hash of all nodes in the file. Index 0 gives the hash of the nodes as
+      ///          they are while index 1 gives the hash with all terminal values negated.
+      ///
+      /// \details The children of each node are hashed relative to the node's own level. Hence, the
+      ///          value does not depend on any shift applied to the diagram. If two diagrams are on
+      ///          canonical form and their fingerprints differ, then they are not isomorphic.
+      ///
+      /// \see is_canonical
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uint64_t fingerprint[2] = { 0u, 0u };
+
       //////////////////////////////////////////////////////////////////////////////////////////////
       /// \brief The diagram's width, i.e. the size of the largest level.
       //////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +119,13 @@ namespace adiar::internal
       //////////////////////////////////////////////////////////////////////////////////////////////
       size_t number_of_terminals[2] = { 0, 0 };
 
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief The number of numeric terminals other than `0` and `1`, e.g. in an ADD. Since a
+      ///        numeric terminal is `true` if its value is non-zero, these are also included in
+      ///        the number of true terminals above.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      size_t number_of_numeric_terminals = 0;
+
       //////////////////////////////////////////////////////////////////////////////////////////////
       /// \brief      Check whether this file represents a terminal-only DAG.
       ///
@@ -154,7 +172,7 @@ namespace adiar::internal
       inline bool
       is_true() const
       {
-        return this->is_terminal() && this->value();
+        return this->is_terminal() && this->value() && this->number_of_numeric_terminals == 0u;
       }
     };
   };
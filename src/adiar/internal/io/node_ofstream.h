@@ -1,6 +1,8 @@
 #ifndef ADIAR_INTERNAL_IO_NODE_OFSTREAM_H
 #define ADIAR_INTERNAL_IO_NODE_OFSTREAM_H
 
+#include <algorithm>
+
 #include <adiar/exception.h>
 
 #include <adiar/internal/assert.h>
@@ -76,6 +78,8 @@ namespace adiar::internal
     {
       _file_ptr->sorted    = !levelized_ofstream::has_pushed();
       _file_ptr->indexable = !levelized_ofstream::has_pushed();
+
+      if (!levelized_ofstream::has_pushed()) { reset_fingerprint(); }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -86,6 +90,8 @@ namespace adiar::internal
     {
       _file_ptr->sorted    = !levelized_ofstream::has_pushed();
       _file_ptr->indexable = !levelized_ofstream::has_pushed();
+
+      if (!levelized_ofstream::has_pushed()) { reset_fingerprint(); }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -117,6 +123,8 @@ namespace adiar::internal
 
       _long_internal_ptr            = node::pointer_type::nil();
       _number_of_long_internal_arcs = 0u;
+
+      if (!levelized_ofstream::has_pushed()) { reset_fingerprint(); }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,6 +183,11 @@ namespace adiar::internal
       // Run final i-level cut computations
       fixup_ilevel_cuts();
 
+      levelized_ofstream::flush();
+#ifdef ADIAR_STATS
+      stats_node_file.write_stall += levelized_ofstream::write_stall();
+#endif
+
       levelized_ofstream::close();
     }
 
@@ -209,7 +222,7 @@ namespace adiar::internal
       if (n.is_terminal()) {
         adiar_assert(first_push, "A terminal can only be pushed once and into an empty file");
         adiar_assert(!has_pushed(), "A terminal can only be pushed into an empty file");
-        _file_ptr->number_of_terminals[n.uid().value()]++;
+        inc_terminals(n.uid());
       }
 
       // -------------------------------------------------------------------------------------------
@@ -281,6 +294,46 @@ namespace adiar::internal
       return *this;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Write all nodes of a single level in canonical order.
+    ///
+    /// \details The nodes are sorted in descending order of their children, i.e. as Reduce does,
+    ///          and given identifiers from `node::max_id` and downwards.
+    ///
+    /// \param label       The label of the level.
+    ///
+    /// \param begin, end  References to the (unique) nodes on the level. These are sorted in place.
+    ///
+    /// \param children_of Function to obtain the (already written) children of a reference.
+    ///
+    /// \param on_push     Function called with each reference and the uid of its node.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename RandomIt, typename ChildrenOf, typename OnPush>
+    void
+    push_level(const node::label_type label,
+               RandomIt begin,
+               RandomIt end,
+               const ChildrenOf& children_of,
+               const OnPush& on_push)
+    {
+      std::sort(begin, end, [&children_of](const auto& a, const auto& b) {
+        const node::children_type a_children = children_of(a);
+        const node::children_type b_children = children_of(b);
+
+        return b_children[true] < a_children[true]
+          || (a_children[true] == b_children[true] && b_children[false] < a_children[false]);
+      });
+
+      node::id_type id = node::max_id;
+      for (RandomIt it = begin; it != end; ++it) {
+        const node::children_type children = children_of(*it);
+        const node n(label, id--, children[false], children[true]);
+
+        on_push(*it, n.uid());
+        this->push(n);
+      }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Write directly to level information file without any checks.
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,8 +356,10 @@ namespace adiar::internal
 #ifdef ADIAR_STATS
       stats_node_file.push_node += 1;
 #endif
-      if (n.low().is_terminal()) { _file_ptr->number_of_terminals[n.low().value()]++; }
-      if (n.high().is_terminal()) { _file_ptr->number_of_terminals[n.high().value()]++; }
+      if (n.low().is_terminal()) { inc_terminals(n.low()); }
+      if (n.high().is_terminal()) { inc_terminals(n.high()); }
+
+      update_fingerprint(n);
 
       levelized_ofstream::template push<0>(n);
     }
@@ -337,13 +392,20 @@ namespace adiar::internal
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \brief Overwrite the number of false and true arcs.
+    /// \brief Overwrite the number of false and true arcs (and how many of the latter are to numeric
+    ///        terminals other than `1`).
     ////////////////////////////////////////////////////////////////////////////////////////////////
     void
-    unsafe_set_number_of_terminals(const size_t number_of_false, const size_t number_of_true)
+    unsafe_set_number_of_terminals(const size_t number_of_false,
+                                   const size_t number_of_true,
+                                   const size_t number_of_numeric = 0u)
     {
-      _file_ptr->number_of_terminals[false] = number_of_false;
-      _file_ptr->number_of_terminals[true]  = number_of_true;
+      adiar_assert(number_of_numeric <= number_of_true,
+                   "Numeric terminals are a subset of the true terminals");
+
+      _file_ptr->number_of_terminals[false]  = number_of_false;
+      _file_ptr->number_of_terminals[true]   = number_of_true;
+      _file_ptr->number_of_numeric_terminals = number_of_numeric;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -393,6 +455,75 @@ namespace adiar::internal
     }
 
   private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Count an arc to the terminal `t`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    inc_terminals(const node::pointer_type& t)
+    {
+      _file_ptr->number_of_terminals[t.value()]++;
+      _file_ptr->number_of_numeric_terminals += 1u < t.numeric_value();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Combine the hash value `h` with the value `x`.
+    ///
+    /// \details Uses the finalizer of *SplitMix64* to spread each bit of `x` across all of `h`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static uint64_t
+    fingerprint_combine(const uint64_t h, const uint64_t x)
+    {
+      uint64_t z = h + x + 0x9E3779B97F4A7C15ull;
+      z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+      z          = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+      return z ^ (z >> 31);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Combine the hash value `h` with the child `c` of the node `n`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static uint64_t
+    fingerprint_combine(uint64_t h, const node& n, const node::pointer_type& c, const bool negate)
+    {
+      if (c.is_terminal()) {
+        const uint64_t c_value = c.numeric_value() ^ negate;
+        return fingerprint_combine(h, 2u | (c_value << 2));
+      }
+
+      h = fingerprint_combine(h, 0u);
+      h = fingerprint_combine(h, c.label() - n.label());
+      return fingerprint_combine(h, c.id());
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Reset the fingerprint of the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    reset_fingerprint()
+    {
+      _file_ptr->fingerprint[false] = 0u;
+      _file_ptr->fingerprint[true]  = 0u;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Add the node `n` to the fingerprint of the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    update_fingerprint(const node& n)
+    {
+      for (const bool negate : { false, true }) {
+        uint64_t& h = _file_ptr->fingerprint[negate];
+
+        if (n.is_terminal()) {
+          h = fingerprint_combine(h, n.numeric_value() ^ negate);
+        } else {
+          h = fingerprint_combine(h, n.id());
+          h = fingerprint_combine(h, n, n.low(), negate);
+          h = fingerprint_combine(h, n, n.high(), negate);
+        }
+      }
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Helper function to bound derived 1-level and 2-level cuts with their trivial upper
     ///        bounds (assuming nothing is pushed later).
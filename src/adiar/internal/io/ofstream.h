@@ -1,13 +1,17 @@
 #ifndef ADIAR_INTERNAL_IO_OFSTREAM_H
 #define ADIAR_INTERNAL_IO_OFSTREAM_H
 
+#include <algorithm>
+
 #include <tpie/file_stream.h>
 #include <tpie/sort.h>
 
 #include <adiar/internal/assert.h>
 #include <adiar/internal/data_types/level_info.h>
 #include <adiar/internal/data_types/ptr.h>
+#include <adiar/internal/io/codec.h>
 #include <adiar/internal/io/file.h>
+#include <adiar/internal/io/write_behind.h>
 #include <adiar/internal/memory.h>
 
 namespace adiar::internal
@@ -27,11 +31,28 @@ namespace adiar::internal
   public:
     using value_type = T;
 
+  private:
+    using layout      = file_layout<value_type>;
+    using narrow_type = typename layout::narrow_type;
+
   public:
     static size_t
     memory_usage()
     {
-      return tpie::file_stream<value_type>::memory_usage();
+      // Only one of the three streams is open at a time.
+      return std::max({ tpie::file_stream<value_type>::memory_usage(),
+                        tpie::file_stream<narrow_type>::memory_usage(),
+                        codec_writer<value_type>::memory_usage() });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used when queueing up the given number of blocks for a background writer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(const size_t write_behind_blocks)
+    {
+      return memory_usage()
+        + internal::write_behind<value_type>::memory_usage(write_behind_blocks);
     }
 
   private:
@@ -46,6 +67,49 @@ namespace adiar::internal
     ////////////////////////////////////////////////////////////////////////////////////////////////
     tpie::file_stream<value_type> _stream;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file, while its content is kept in internal memory. If so, then `_stream` is not
+    ///        yet used.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    file<value_type>* _memory_file = nullptr;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Writer of the file's content, if it is compressed. If so, then `_stream` is unused.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    codec_writer<value_type> _codec;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file, while its content is written compressed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    file<value_type>* _compressed_file = nullptr;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief TPIE's file stream object to write elements in their narrow layout with. If open,
+    ///        then `_stream` is unused.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    tpie::file_stream<narrow_type> _narrow_stream;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief The file, while its content is written in its narrow layout.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    file<value_type>* _narrow_file = nullptr;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Background writer to `_stream`, `_narrow_stream`, or `_codec`. While it runs, none of
+    ///        them may be touched by this thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    internal::write_behind<value_type> _writer;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements in the file when `_writer` was started.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _writer_offset = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Time (in nanoseconds) spent waiting for prior background writers.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t _write_stall = 0u;
+
   public:
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Construct unattached to any file.
@@ -92,12 +156,95 @@ namespace adiar::internal
       if (f.is_persistent()) throw runtime_error("Cannot attach writer to a persisted file");
 
       if (is_open()) { close(); }
-      _file_ptr = p;
+      _file_ptr    = p;
+      _write_stall = 0u;
+
+      // Write directly into internal memory, if the content is there
+      if (f._in_memory) {
+        adiar_assert(f._memory.readers() == 0u, "Cannot attach writer to a file being read");
+        f.__touch();
+        _memory_file = &f;
+        return;
+      }
+
+      __open_disk(f);
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Open the stream to append to the file's content on disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __open_disk(file<value_type>& f)
+    {
+      if (f._compressed) {
+        _codec.open(f._codec_file, f._codec_size);
+        _compressed_file = &f;
+        return;
+      }
+
+      if (f._narrow) {
+        _narrow_stream.open(f._narrow_file, file<value_type>::w_access);
+        _narrow_stream.seek(0, tpie::file_stream_base::end);
+        _narrow_file = &f;
+        return;
+      }
 
       _stream.open(f._tpie_file, file<value_type>::w_access);
       _stream.seek(0, tpie::file_stream_base::end);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move the file's content on disk into its wide layout and continue writing there.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    widen()
+    {
+      adiar_assert(_narrow_file != nullptr);
+
+      file<value_type>& f = *_narrow_file;
+      _narrow_file        = nullptr;
+      _narrow_stream.close();
+
+      f.__widen();
+      __open_disk(f);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Write an element to the file's content on disk.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __write(const value_type& e)
+    {
+      if (_compressed_file) {
+        _codec.write(e);
+        return;
+      }
+      if (_narrow_file) {
+        if (layout::fits(e)) {
+          _narrow_stream.write(layout::narrow(e));
+          return;
+        }
+        widen();
+      }
+      _stream.write(e);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Move the file's content to disk and continue writing there.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    spill()
+    {
+      adiar_assert(_memory_file != nullptr);
+
+      file<value_type>& f = *_memory_file;
+      _memory_file        = nullptr;
+
+      f.__spill();
+      __open_disk(f);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Befriend the few places that need direct access to the above 'attach'.
     template <typename tparam__elem_t>
@@ -135,7 +282,8 @@ namespace adiar::internal
     bool
     is_open() const
     {
-      return _stream.is_open();
+      return _memory_file != nullptr || _codec.is_open() || _narrow_stream.is_open()
+        || _stream.is_open();
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,10 +292,70 @@ namespace adiar::internal
     void
     close()
     {
+      flush();
+      _memory_file = nullptr;
+      _codec.close();
+      _compressed_file = nullptr;
+      _narrow_stream.close();
+      _narrow_file = nullptr;
       _stream.close();
       if (_file_ptr) { _file_ptr.reset(); }
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Hand full blocks to a background thread that writes them to disk. Up to `blocks` many
+    ///        of them may be queued up before `push` has to wait.
+    ///
+    /// \details Content kept in internal memory is not written behind. If `blocks` is zero, then
+    ///          all queued up elements are written and writing behind is turned off.
+    ///
+    /// \pre `is_open() == true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    write_behind(const size_t blocks)
+    {
+      adiar_assert(is_open());
+      flush();
+
+      if (blocks == 0u || _memory_file) { return; }
+
+      _writer_offset = size();
+      _writer.start(blocks, [this](const value_type* in, const size_t n) {
+        for (size_t i = 0u; i < n; ++i) { __write(in[i]); }
+      });
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether full blocks are written by a background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_writing_behind() const
+    {
+      return _writer.is_running();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Wait for all elements to be written and continue without writing behind.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    flush()
+    {
+      if (!_writer.is_running()) { return; }
+
+      _writer.stop();
+      _write_stall += _writer.stall_time();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Time (in nanoseconds) spent waiting for the background writer since the file was
+    ///        opened.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t
+    write_stall() const
+    {
+      return _write_stall + (_writer.is_running() ? _writer.stall_time() : 0u);
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Push an element to the end of the file.
     ///
@@ -156,7 +364,15 @@ namespace adiar::internal
     void
     push(const value_type& e)
     {
-      _stream.write(e);
+      if (_writer.is_running()) {
+        _writer.push(e);
+        return;
+      }
+      if (_memory_file) {
+        if (_memory_file->_memory.push(e)) { return; }
+        spill();
+      }
+      __write(e);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,7 +395,7 @@ namespace adiar::internal
     bool
     has_pushed() const
     {
-      return _stream.size() > 0;
+      return size() > 0;
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////
@@ -201,6 +417,10 @@ namespace adiar::internal
     size_t
     size() const
     {
+      if (_writer.is_running()) { return _writer_offset + _writer.pushed(); }
+      if (_memory_file) { return _memory_file->_memory.size(); }
+      if (_compressed_file) { return _compressed_file->_codec_size; }
+      if (_narrow_file) { return _narrow_stream.size(); }
       return _stream.size();
     }
 
@@ -214,8 +434,27 @@ namespace adiar::internal
     sort(const pred_t pred = pred_t())
     {
       if (empty()) return;
+      flush();
+
+      if (_memory_file) {
+        std::sort(_memory_file->_memory.begin(), _memory_file->_memory.end(), pred);
+        return;
+      }
+
+      // Sort the compressed content and then continue appending to it.
+      if (_compressed_file) {
+        _codec.close();
+        _compressed_file->__sort_compressed(pred);
+        _codec.open(_compressed_file->_codec_file, _compressed_file->_codec_size);
+        return;
+      }
 
       tpie::progress_indicator_null pi;
+
+      if (_narrow_file) {
+        tpie::sort(_narrow_stream, file<value_type>::__narrow_pred(pred), pi);
+        return;
+      }
       tpie::sort(_stream, pred, pi);
     }
   };
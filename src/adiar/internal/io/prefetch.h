@@ -0,0 +1,281 @@
+#ifndef ADIAR_INTERNAL_IO_PREFETCH_H
+#define ADIAR_INTERNAL_IO_PREFETCH_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <adiar/exec_policy.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/block_size.h>
+#include <adiar/internal/parallel.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Maximum number of blocks a single stream may have in flight when reading ahead.
+  ///
+  /// \details A handful of blocks already suffices to hide the latency of the disk behind the
+  ///          computation; more blocks only take memory away from the auxiliary data structures.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  constexpr size_t max_read_ahead_blocks = 4u;
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of blocks to read ahead for each of `streams` many input streams.
+  ///
+  /// \details Read-ahead is only used if the execution policy provides more than a single thread.
+  ///          Furthermore, the blocks of all streams together (including the one each stream is
+  ///          currently consuming) may at most use up the given amount of memory.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  read_ahead_blocks(const exec_policy& ep, const size_t memory, const size_t streams = 1u)
+  {
+    if (worker_threads(ep) <= 1u || streams == 0u) { return 0u; }
+
+    const size_t blocks_fit = memory / (streams * get_block_size());
+    return blocks_fit <= 1u ? 0u : std::min(max_read_ahead_blocks, blocks_fit - 1u);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Ring of blocks that a background thread fills with the next elements of a stream.
+  ///
+  /// \details The background thread obtains the elements in reading order from the given `fill`
+  ///          function. It keeps up to `blocks` many blocks ahead of the block currently consumed.
+  ///
+  /// \tparam T Type of the stream's elements.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class prefetcher
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the stream's elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using value_type = T;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Function to fill a buffer with at most the given number of elements. It returns the
+    ///        number of elements written; zero signals the end of the stream.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using fill_function = std::function<size_t(value_type*, size_t)>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements in a single block.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    block_elements()
+    {
+      return std::max<size_t>(1u, get_block_size() / sizeof(value_type));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used for `blocks` many blocks in flight (and the one being consumed).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(const size_t blocks)
+    {
+      return blocks == 0u ? 0u : (blocks + 1u) * block_elements() * sizeof(value_type);
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Blocks of the ring together with the number of elements in each.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<std::vector<value_type>> _blocks;
+    std::vector<size_t> _sizes;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the block to consume next and the number of filled blocks after it.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _head   = 0u;
+    size_t _filled = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the consumer currently holds the block at `_head` and its read position.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _holding = false;
+    size_t _idx   = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the background thread has reached the end or is asked to stop.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _done = false;
+    bool _stop = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Exception thrown within the background thread (rethrown to the consumer).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::exception_ptr _error;
+
+    std::mutex _mutex;
+    std::condition_variable _cv_filled;
+    std::condition_variable _cv_free;
+    std::thread _thread;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Construct without any background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    prefetcher() = default;
+
+    prefetcher(const prefetcher&) = delete;
+    prefetcher(prefetcher&&)      = delete;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Stops the background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ~prefetcher()
+    {
+      stop();
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Start a background thread to keep `blocks` many blocks read ahead.
+    ///
+    /// \pre `is_running() == false` and `0 < blocks`.
+    ///
+    /// \remark Until `stop()` is called, the background thread has exclusive access to whatever
+    ///         `fill` reads from.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    start(const size_t blocks, fill_function fill)
+    {
+      adiar_assert(!is_running());
+      adiar_assert(0u < blocks);
+
+      // One more block than in flight, since the consumer holds on to one of them.
+      const size_t ring_size = blocks + 1u;
+      if (_blocks.size() != ring_size) {
+        _blocks.assign(ring_size, std::vector<value_type>(block_elements()));
+        _sizes.assign(ring_size, 0u);
+      }
+
+      _head    = 0u;
+      _filled  = 0u;
+      _holding = false;
+      _idx     = 0u;
+      _done    = false;
+      _stop    = false;
+      _error   = nullptr;
+
+      _thread = helper_thread(&prefetcher::__run, this, std::move(fill));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a background thread is reading ahead.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_running() const
+    {
+      return _thread.joinable();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Stop and join the background thread (if any) and drop all blocks read ahead.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    stop()
+    {
+      if (!is_running()) { return; }
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+      }
+      _cv_free.notify_all();
+      _thread.join();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether there are more elements.
+    ///
+    /// \details Blocks until the background thread has provided the next block or has reached the
+    ///          end of the stream.
+    ///
+    /// \pre `is_running() == true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    can_read()
+    {
+      if (_holding && _idx < _sizes[_head]) { return true; }
+
+      std::unique_lock<std::mutex> lock(_mutex);
+      if (_holding) {
+        // Hand the consumed block back to the background thread.
+        _holding = false;
+        _head    = (_head + 1u) % _blocks.size();
+        _filled -= 1u;
+        _cv_free.notify_one();
+      }
+      _cv_filled.wait(lock, [this]() { return 0u < _filled || _done; });
+
+      if (_filled == 0u) {
+        if (_error) { std::rethrow_exception(_error); }
+        return false;
+      }
+      _holding = true;
+      _idx     = 0u;
+      return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Obtain the next element.
+    ///
+    /// \pre `can_read() == true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    const value_type&
+    read()
+    {
+      adiar_assert(_holding && _idx < _sizes[_head]);
+      return _blocks[_head][_idx++];
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __run(fill_function fill)
+    {
+      const size_t ring_size = _blocks.size();
+      size_t tail            = 0u;
+
+      while (true) {
+        {
+          std::unique_lock<std::mutex> lock(_mutex);
+          _cv_free.wait(lock, [this, ring_size]() { return _filled < ring_size || _stop; });
+          if (_stop) { break; }
+        }
+
+        // The block at 'tail' is not visible to the consumer. Hence, it can be filled without
+        // holding onto the lock.
+        size_t n = 0u;
+        try {
+          n = fill(_blocks[tail].data(), _blocks[tail].size());
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _error = std::current_exception();
+          n      = 0u;
+        }
+        _sizes[tail] = n;
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (n == 0u) {
+          _done = true;
+          _cv_filled.notify_one();
+          break;
+        }
+        _filled += 1u;
+        tail = (tail + 1u) % ring_size;
+        _cv_filled.notify_one();
+      }
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_IO_PREFETCH_H
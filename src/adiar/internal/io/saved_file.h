@@ -0,0 +1,295 @@
+#ifndef ADIAR_INTERNAL_IO_SAVED_FILE_H
+#define ADIAR_INTERNAL_IO_SAVED_FILE_H
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <type_traits>
+
+#include <adiar/exception.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/cut.h>
+#include <adiar/internal/data_types/level_info.h>
+#include <adiar/internal/data_types/node.h>
+#include <adiar/internal/data_types/ptr.h>
+#include <adiar/internal/io/file.h>
+#include <adiar/internal/io/ifstream.h>
+#include <adiar/internal/io/levelized_file.h>
+#include <adiar/internal/io/mmap_file.h>
+#include <adiar/internal/io/node_file.h>
+#include <adiar/internal/io/ofstream.h>
+#include <adiar/internal/io/shared_file_ptr.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   A node file saved on disk as a single self-describing file.
+  ///
+  /// \details The file starts with a header of `header_size` bytes:
+  ///
+  ///          | Offset | Size | Field                                                      |
+  ///          |--------|------|------------------------------------------------------------|
+  ///          | 0      | 8    | `magic`                                                    |
+  ///          | 8      | 4    | `current_version`                                          |
+  ///          | 12     | 4    | `ADIAR_LEVEL_BITS`                                         |
+  ///          | 16     | 4    | `sizeof(node)`                                             |
+  ///          | 20     | 4    | Flags (bit 0: `sorted`, bit 1: `indexable`)                |
+  ///          | 24     | 8    | Number of levels                                           |
+  ///          | 32     | 8    | Number of nodes                                            |
+  ///          | 40     | 16   | `fingerprint[0]`, `fingerprint[1]`                         |
+  ///          | 56     | 8    | `width`                                                    |
+  ///          | 64     | 32   | `max_1level_cut[0]`, ..., `max_1level_cut[3]`              |
+  ///          | 96     | 32   | `max_2level_cut[0]`, ..., `max_2level_cut[3]`              |
+  ///          | 128    | 16   | `number_of_terminals[false]`, `number_of_terminals[true]`  |
+  ///          | 144    | 8    | `number_of_numeric_terminals`                              |
+  ///
+  ///          This is followed by the level information (16 bytes each: the level, 4 bytes of
+  ///          padding, and then the width) and then the nodes (their three 8 byte words: uid, low,
+  ///          and high). Both are in the order they were written. Every value is stored in
+  ///          little-endian byte order.
+  ///
+  ///          On a little-endian machine, these two sections have the very same layout as a
+  ///          `level_info` and a `node` in memory. Hence, a saved file can be memory-mapped and
+  ///          then be read in-place.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  class saved_file
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Magic bytes at the very start of the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr char magic[8] = { 'A', 'D', 'I', 'A', 'R', 'D', 'D', '\0' };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Version of the on-disk format; to be incremented on any change to it.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr uint32_t current_version = 1u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes of the header.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t header_size = 152u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes of each level information.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t level_info_size = 16u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of bytes of each node.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static constexpr size_t node_size = 3u * sizeof(uint64_t);
+
+    static_assert(sizeof(node) == node_size, "Nodes are stored as three 64-bit words");
+    static_assert(std::is_trivially_copyable_v<node>, "Nodes are stored as three 64-bit words");
+
+    static_assert(sizeof(level_info) == level_info_size, "Level information is stored in 16 bytes");
+    static_assert(header_size % alignof(node) == 0u, "Sections are aligned");
+
+  private:
+    using stats_type = file_traits<node>::stats;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Write an unsigned integer in little-endian byte order.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static void
+    write_le(std::ostream& out, const T v)
+    {
+      unsigned char bytes[sizeof(T)];
+      for (size_t i = 0u; i < sizeof(T); ++i) { bytes[i] = (v >> (8u * i)) & 0xFFu; }
+      out.write(reinterpret_cast<const char*>(bytes), sizeof(T));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Read an unsigned integer in little-endian byte order.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    static T
+    read_le(std::istream& in)
+    {
+      unsigned char bytes[sizeof(T)] = {};
+      in.read(reinterpret_cast<char*>(bytes), sizeof(T));
+
+      T v = 0u;
+      for (size_t i = 0u; i < sizeof(T); ++i) { v |= static_cast<T>(bytes[i]) << (8u * i); }
+      return v;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the content of a saved file can be read in-place, i.e. memory mapping is
+    ///        supported and the level information is laid out in memory as in the file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static bool
+    can_map()
+    {
+      if constexpr (!mmap_file::supported) { return false; }
+
+      const level_info li(1u, 2u);
+
+      uint64_t words[2];
+      std::memcpy(words, &li, sizeof(words));
+      return (words[0] & 0xFFFFFFFFu) == 1u && words[1] == 2u;
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Save a node file at the given path.
+    ///
+    /// \throws runtime_error If a file already exists at `path` or it cannot be written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static void
+    write(const levelized_file<node>& f, const std::string& path)
+    {
+      if (std::filesystem::exists(path)) { throw runtime_error("'" + path + "' already exists."); }
+
+      std::ofstream out(path, std::ios::binary | std::ios::trunc);
+      if (!out) { throw runtime_error("Cannot write to '" + path + "'"); }
+
+      // Header
+      const stats_type& stats = f;
+
+      out.write(magic, sizeof(magic));
+      write_le<uint32_t>(out, current_version);
+      write_le<uint32_t>(out, ADIAR_LEVEL_BITS);
+      write_le<uint32_t>(out, sizeof(node));
+      write_le<uint32_t>(out, (stats.sorted ? 1u : 0u) | (stats.indexable ? 2u : 0u));
+      write_le<uint64_t>(out, f.levels());
+      write_le<uint64_t>(out, f.size());
+      for (const uint64_t fp : stats.fingerprint) { write_le<uint64_t>(out, fp); }
+      write_le<uint64_t>(out, stats.width);
+      for (const cut::size_type c : stats.max_1level_cut) { write_le<uint64_t>(out, c); }
+      for (const cut::size_type c : stats.max_2level_cut) { write_le<uint64_t>(out, c); }
+      write_le<uint64_t>(out, stats.number_of_terminals[false]);
+      write_le<uint64_t>(out, stats.number_of_terminals[true]);
+      write_le<uint64_t>(out, stats.number_of_numeric_terminals);
+
+      // Level information
+      ifstream<level_info> ls(f._level_info_file);
+      while (ls.can_pull()) {
+        const level_info li = ls.pull();
+        write_le<uint32_t>(out, li.level());
+        write_le<uint32_t>(out, 0u);
+        write_le<uint64_t>(out, li.width());
+      }
+
+      // Nodes
+      ifstream<node> ns(f._files[0]);
+      while (ns.can_pull()) {
+        const node n = ns.pull();
+
+        uint64_t words[3];
+        std::memcpy(words, &n, sizeof(words));
+        for (const uint64_t w : words) { write_le<uint64_t>(out, w); }
+      }
+
+      if (!out) { throw runtime_error("Cannot write to '" + path + "'"); }
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Load a node file saved with `write`.
+    ///
+    /// \details The header is validated against this very configuration of Adiar. If possible, the
+    ///          file is then memory-mapped and its level information and nodes are read in-place,
+    ///          i.e. without copying them. The result then is a persistent (read-only) node file and
+    ///          the saved file must neither be changed nor removed while it is in use. Otherwise,
+    ///          the content is copied into a new temporary node file.
+    ///
+    /// \throws runtime_error If the file does not exist, is not a saved node file, was saved by an
+    ///                       incompatible version or configuration, or is truncated.
+    ///
+    /// \see can_map
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static shared_levelized_file<node>
+    read(const std::string& path)
+    {
+      if (!std::filesystem::exists(path)) { throw runtime_error("'" + path + "' does not exist"); }
+
+      std::ifstream in(path, std::ios::binary);
+      if (!in) { throw runtime_error("Cannot read '" + path + "'"); }
+
+      // Header
+      char m[sizeof(magic)] = {};
+      in.read(m, sizeof(m));
+      if (!in || std::memcmp(m, magic, sizeof(magic)) != 0) {
+        throw runtime_error("'" + path + "' is not a saved decision diagram");
+      }
+      if (read_le<uint32_t>(in) != current_version) {
+        throw runtime_error("'" + path + "' uses an unsupported format version");
+      }
+      if (read_le<uint32_t>(in) != ADIAR_LEVEL_BITS) {
+        throw runtime_error("'" + path + "' was saved with a different number of level bits");
+      }
+      if (read_le<uint32_t>(in) != sizeof(node)) {
+        throw runtime_error("'" + path + "' was saved with a different node size");
+      }
+
+      shared_levelized_file<node> res;
+      stats_type& stats = *res;
+
+      const uint32_t flags = read_le<uint32_t>(in);
+      stats.sorted         = flags & 1u;
+      stats.indexable      = flags & 2u;
+
+      const uint64_t levels = read_le<uint64_t>(in);
+      const uint64_t size   = read_le<uint64_t>(in);
+
+      for (uint64_t& fp : stats.fingerprint) { fp = read_le<uint64_t>(in); }
+      stats.width = read_le<uint64_t>(in);
+      for (cut::size_type& c : stats.max_1level_cut) { c = read_le<uint64_t>(in); }
+      for (cut::size_type& c : stats.max_2level_cut) { c = read_le<uint64_t>(in); }
+      stats.number_of_terminals[false]  = read_le<uint64_t>(in);
+      stats.number_of_terminals[true]   = read_le<uint64_t>(in);
+      stats.number_of_numeric_terminals = read_le<uint64_t>(in);
+
+      if (!in
+          || std::filesystem::file_size(path)
+            != header_size + levels * level_info_size + size * node_size) {
+        throw runtime_error("'" + path + "' is truncated");
+      }
+
+      // Read the level information and nodes in-place, if possible.
+      if (can_map()) {
+        const shared_ptr<const mmap_file> mapping = adiar::make_shared<const mmap_file>(path);
+
+        res->_level_info_file.__map(mapping, header_size, levels);
+        res->_files[0].__map(mapping, header_size + levels * level_info_size, size);
+        return res;
+      }
+
+      // Level information
+      {
+        ofstream<level_info> ls(res->_level_info_file);
+        for (uint64_t i = 0u; i < levels; ++i) {
+          const uint32_t level = read_le<uint32_t>(in);
+          read_le<uint32_t>(in);
+          const uint64_t width = read_le<uint64_t>(in);
+          ls << level_info(level, width);
+        }
+      }
+
+      // Nodes
+      {
+        ofstream<node> ns(res->_files[0]);
+        for (uint64_t i = 0u; i < size; ++i) {
+          uint64_t words[3];
+          for (uint64_t& w : words) { w = read_le<uint64_t>(in); }
+
+          node n;
+          std::memcpy(&n, words, sizeof(words));
+          ns << n;
+        }
+      }
+
+      if (!in) { throw runtime_error("Cannot read '" + path + "'"); }
+      return res;
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_IO_SAVED_FILE_H
@@ -0,0 +1,316 @@
+#ifndef ADIAR_INTERNAL_IO_WRITE_BEHIND_H
+#define ADIAR_INTERNAL_IO_WRITE_BEHIND_H
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <adiar/exec_policy.h>
+
+#include <adiar/internal/assert.h>
+#include <adiar/internal/block_size.h>
+#include <adiar/internal/io/prefetch.h>
+#include <adiar/internal/parallel.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of full blocks to queue up for a background writer for each of `streams` many
+  ///        output streams.
+  ///
+  /// \details This is bounded in the same way as the number of blocks read ahead.
+  ///
+  /// \see read_ahead_blocks
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  write_behind_blocks(const exec_policy& ep, const size_t memory, const size_t streams = 1u)
+  {
+    return read_ahead_blocks(ep, memory, streams);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Ring of blocks that a background thread writes to a stream once they are full.
+  ///
+  /// \details The elements are handed over to the given `drain` function in the order they were
+  ///          pushed. Up to `blocks` many full blocks may be queued up while the next one is being
+  ///          filled. If the queue is full, then `push` waits for the background thread.
+  ///
+  /// \tparam T Type of the stream's elements.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename T>
+  class write_behind
+  {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Type of the stream's elements.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using value_type = T;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Function to write the given number of elements to the stream.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    using drain_function = std::function<void(const value_type*, size_t)>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements in a single block.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    block_elements()
+    {
+      return std::max<size_t>(1u, get_block_size() / sizeof(value_type));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Memory used for `blocks` many queued blocks (and the one being filled).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    static size_t
+    memory_usage(const size_t blocks)
+    {
+      return blocks == 0u ? 0u : (blocks + 1u) * block_elements() * sizeof(value_type);
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Blocks of the ring together with the number of elements in each.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::vector<std::vector<value_type>> _blocks;
+    std::vector<size_t> _sizes;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the block to write next and the number of full blocks queued up from it.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _head   = 0u;
+    size_t _filled = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Index of the block currently being filled and the number of elements in it.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _tail = 0u;
+    size_t _idx  = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements pushed since `start`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t _pushed = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Time spent waiting for the background thread since `start` (in nanoseconds).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t _stall_time = 0u;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether the background thread is asked to stop once all full blocks are written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool _stop = false;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Exception thrown within the background thread (rethrown to the producer).
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    std::exception_ptr _error;
+
+    std::mutex _mutex;
+    std::condition_variable _cv_filled;
+    std::condition_variable _cv_free;
+    std::thread _thread;
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Construct without any background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    write_behind() = default;
+
+    write_behind(const write_behind&) = delete;
+    write_behind(write_behind&&)      = delete;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Writes all remaining elements and stops the background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    ~write_behind()
+    {
+      __join();
+    }
+
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Start a background thread that writes up to `blocks` many full blocks.
+    ///
+    /// \pre `is_running() == false` and `0 < blocks`.
+    ///
+    /// \remark Until `stop()` is called, the background thread has exclusive access to whatever
+    ///         `drain` writes to.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    start(const size_t blocks, drain_function drain)
+    {
+      adiar_assert(!is_running());
+      adiar_assert(0u < blocks);
+
+      // One more block than queued up, since the producer fills one of them.
+      const size_t ring_size = blocks + 1u;
+      if (_blocks.size() != ring_size) {
+        _blocks.assign(ring_size, std::vector<value_type>(block_elements()));
+        _sizes.assign(ring_size, 0u);
+      }
+
+      _head   = 0u;
+      _filled = 0u;
+      _tail   = 0u;
+      _idx    = 0u;
+      _pushed     = 0u;
+      _stall_time = 0u;
+      _stop       = false;
+      _error      = nullptr;
+
+      _thread = helper_thread(&write_behind::__run, this, std::move(drain));
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Whether a background thread is writing behind.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    bool
+    is_running() const
+    {
+      return _thread.joinable();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Write all remaining elements and join the background thread (if any).
+    ///
+    /// \throws Any exception the background thread encountered while writing.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    stop()
+    {
+      if (!is_running()) { return; }
+      __join();
+      if (_error) { std::rethrow_exception(std::exchange(_error, nullptr)); }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Push an element to the end of the stream.
+    ///
+    /// \pre `is_running() == true`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    push(const value_type& e)
+    {
+      _blocks[_tail][_idx++] = e;
+      _pushed += 1u;
+
+      if (_idx == _blocks[_tail].size()) { __hand_over(); }
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Number of elements pushed since the background thread was started.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    size_t
+    pushed() const
+    {
+      return _pushed;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Time (in nanoseconds) that `push` and `stop` have waited for the background thread to
+    ///        catch up since `start`.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    uint64_t
+    stall_time() const
+    {
+      return _stall_time;
+    }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Queue up the block currently being filled and wait for a free one.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __hand_over()
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+
+      _sizes[_tail] = _idx;
+      _filled += 1u;
+      _cv_filled.notify_one();
+
+      const size_t ring_size = _blocks.size();
+      if (ring_size <= _filled && !_error) {
+        const auto stall_start = std::chrono::steady_clock::now();
+        _cv_free.wait(lock, [this, ring_size]() { return _filled < ring_size || _error; });
+        _stall_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         std::chrono::steady_clock::now() - stall_start)
+                         .count();
+      }
+      if (_error) { std::rethrow_exception(_error); }
+
+      _tail = (_tail + 1u) % ring_size;
+      _idx  = 0u;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Queue up the remaining elements, wait for them to be written, and join.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __join()
+    {
+      if (!is_running()) { return; }
+
+      const auto stall_start = std::chrono::steady_clock::now();
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (0u < _idx) {
+          _sizes[_tail] = _idx;
+          _filled += 1u;
+          _idx = 0u;
+        }
+        _stop = true;
+      }
+      _cv_filled.notify_one();
+      _thread.join();
+      _stall_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - stall_start)
+                       .count();
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Body of the background thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    __run(drain_function drain)
+    {
+      const size_t ring_size = _blocks.size();
+
+      while (true) {
+        {
+          std::unique_lock<std::mutex> lock(_mutex);
+          _cv_filled.wait(lock, [this]() { return 0u < _filled || _stop; });
+          if (_filled == 0u) { break; }
+        }
+
+        // The block at '_head' is not touched by the producer until it is handed back. Hence, it
+        // can be written without holding onto the lock.
+        try {
+          drain(_blocks[_head].data(), _sizes[_head]);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _error = std::current_exception();
+          _cv_free.notify_one();
+          break;
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _head = (_head + 1u) % ring_size;
+        _filled -= 1u;
+        _cv_free.notify_one();
+      }
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_IO_WRITE_BEHIND_H
@@ -1,6 +1,8 @@
 #ifndef ADIAR_INTERNAL_MEMORY_H
 #define ADIAR_INTERNAL_MEMORY_H
 
+#include <algorithm>
+#include <atomic>
 #include <string>
 
 #include <tpie/memory.h>
@@ -11,12 +13,43 @@
 namespace adiar::internal
 {
   //////////////////////////////////////////////////////////////////////////////
-  /// \brief Obtain from TPIE the amount of available memory.
+  /// \brief Share of the memory (in bytes) set aside for the calling thread
+  ///        with `adiar_thread_init`. If `0`, then the thread is not limited to
+  ///        a partition.
+  //////////////////////////////////////////////////////////////////////////////
+  extern thread_local size_t thread_memory_limit;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of calls to `adiar_deinit`. A thread's partition is only
+  ///        valid, if it was made since the last of these calls.
+  //////////////////////////////////////////////////////////////////////////////
+  extern std::atomic<size_t> memory_epoch;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Value of `memory_epoch` when `thread_memory_limit` was set.
+  //////////////////////////////////////////////////////////////////////////////
+  extern thread_local size_t thread_memory_epoch;
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief The calling thread's partition of the memory (or `0` if it has none
+  ///        or `adiar_deinit` has been called since it was set aside).
+  //////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  thread_memory_partition()
+  {
+    return thread_memory_epoch == memory_epoch.load() ? thread_memory_limit : 0u;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain from TPIE the amount of available memory (restricted to the
+  ///        partition of the calling thread).
   //////////////////////////////////////////////////////////////////////////////
   inline size_t
   memory_available()
   {
-    return tpie::get_memory_manager().available();
+    const size_t available = tpie::get_memory_manager().available();
+    const size_t partition = thread_memory_partition();
+    return partition == 0u ? available : std::min(available, partition);
   }
 
   //////////////////////////////////////////////////////////////////////////////
@@ -26,11 +59,16 @@ namespace adiar::internal
   ///          data structure: (1) that handles enormous amounts of data by
   ///          using the external memory (the disk) and (2) an implementation
   ///          that is much faster but is limited to internal memory (the RAM).
+  ///
+  ///          The (3) *adaptive* data structures start out with the internal
+  ///          memory implementation and only switch over to the external one,
+  ///          if they actually outgrow their share of the memory.
   //////////////////////////////////////////////////////////////////////////////
   enum class memory_mode
   {
     Internal,
-    External
+    External,
+    Adaptive
   };
 }
 
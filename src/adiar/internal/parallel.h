@@ -0,0 +1,54 @@
+#ifndef ADIAR_INTERNAL_PARALLEL_H
+#define ADIAR_INTERNAL_PARALLEL_H
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <utility>
+
+#include <adiar/exec_policy.h>
+
+#include <adiar/internal/memory.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Number of worker threads to use based on the given execution policy.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline size_t
+  worker_threads(const exec_policy& ep)
+  {
+    const exec_policy::threads::value_type t = ep.template get<exec_policy::threads>().value();
+
+    if (t == exec_policy::threads::Auto) {
+      return std::max<size_t>(1u, std::thread::hardware_concurrency());
+    }
+    return t;
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Start a helper thread for the calling thread's current operation.
+  ///
+  /// \details The helper works on the data structures of the operation, so it is also charged to
+  ///          the calling thread's partition of the memory (see `adiar_thread_init`) rather than
+  ///          to the memory shared by all threads.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <typename F, typename... Args>
+  inline std::thread
+  helper_thread(F&& f, Args&&... args)
+  {
+    const size_t limit = thread_memory_limit;
+    const size_t epoch = thread_memory_epoch;
+
+    return std::thread(
+      [limit, epoch](auto&& f, auto&&... args) {
+        thread_memory_limit = limit;
+        thread_memory_epoch = epoch;
+        std::invoke(std::forward<decltype(f)>(f), std::forward<decltype(args)>(args)...);
+      },
+      std::forward<F>(f),
+      std::forward<Args>(args)...);
+  }
+}
+
+#endif // ADIAR_INTERNAL_PARALLEL_H
@@ -0,0 +1,71 @@
+#ifndef ADIAR_INTERNAL_STATISTICS_H
+#define ADIAR_INTERNAL_STATISTICS_H
+
+#include <adiar/statistics.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Add the statistics of a thread that exits to the ones of all prior exited threads.
+  ///
+  /// \see statistics_get
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  statistics_exit(const statistics& s);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Reset the statistics of the calling thread (but not the ones of exited threads).
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  statistics_reset_thread();
+
+  /// \cond
+  template <typename MemberPtr>
+  struct __statistics_member;
+
+  template <typename Stats>
+  struct __statistics_member<Stats statistics::*>
+  {
+    using type = Stats;
+  };
+  /// \endcond
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Thread-local statistics for the member `Field` of `statistics`.
+  ///
+  /// \details When a thread exits, its statistics are merged into the ones of all threads that
+  ///          have exited before it. This way, nothing recorded by a helper thread is lost.
+  ///
+  /// \tparam Field Pointer to the member of `statistics` these are for, e.g. `&statistics::reduce`.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  template <auto Field>
+  class thread_statistics : public __statistics_member<decltype(Field)>::type
+  {
+  public:
+    using value_type = typename __statistics_member<decltype(Field)>::type;
+
+  public:
+    thread_statistics() = default;
+
+    thread_statistics(const thread_statistics&) = delete;
+    thread_statistics(thread_statistics&&)      = delete;
+
+    ~thread_statistics()
+    {
+      statistics s;
+      s.*Field = *this;
+      statistics_exit(s);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Reset all values to their default.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    void
+    reset()
+    {
+      static_cast<value_type&>(*this) = value_type();
+    }
+  };
+}
+
+#endif // ADIAR_INTERNAL_STATISTICS_H
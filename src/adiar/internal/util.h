@@ -135,6 +135,27 @@ namespace adiar::internal
     request_foreach(pq_2, target, handler);
   }
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Obtain the semi-transposition of an unreduced decision diagram's arcs.
+  ///
+  /// \details The internal arcs of an unreduced diagram that was prepared to be piped (see
+  ///          `exec_policy::chain`) are sorted on their source. These are sorted back on their
+  ///          target; in-place if no one else reads from the file and otherwise in a copy.
+  ///
+  /// \see reduce
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  inline shared_levelized_file<arc>
+  transposed(const shared_levelized_file<arc>& af)
+  {
+    if (af->semi_transposed) { return af; }
+
+    shared_levelized_file<arc> res =
+      af.use_count() == 1 ? af : shared_levelized_file<arc>::copy(af);
+
+    transpose(*res);
+    return res;
+  }
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief Obtain the semi-transposition of a decision diagram.
   ///
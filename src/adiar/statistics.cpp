@@ -1,7 +1,9 @@
 #include "statistics.h"
 
 #include "adiar/internal/algorithms/optmin.h"
+#include <algorithm>
 #include <iomanip>
+#include <mutex>
 
 #include <adiar/bdd/if_then_else.h>
 
@@ -11,13 +13,362 @@
 #include <adiar/internal/algorithms/pred.h>
 #include <adiar/internal/algorithms/prod2b.h>
 #include <adiar/internal/algorithms/prod2u.h>
+#include <adiar/internal/algorithms/prodn.h>
 #include <adiar/internal/algorithms/quantify.h>
 #include <adiar/internal/algorithms/reduce.h>
+#include <adiar/internal/algorithms/reorder.h>
 #include <adiar/internal/algorithms/replace.h>
 #include <adiar/internal/algorithms/select.h>
+#include <adiar/internal/algorithms/small.h>
 #include <adiar/internal/data_structures/levelized_priority_queue.h>
+#include <adiar/internal/data_structures/result_cache.h>
 #include <adiar/internal/io/arc_file.h>
 #include <adiar/internal/io/node_file.h>
+#include <adiar/internal/statistics.h>
+
+namespace adiar::internal
+{
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Helper functions to merge the statistics of two threads
+  inline void
+  __merge(uintwide& a, const uintwide& b)
+  {
+    a += b;
+  }
+
+  inline void
+  __merge(size_t& a, const size_t b)
+  {
+    a += b;
+  }
+
+  inline void
+  __merge(double& a, const double b)
+  {
+    a += b;
+  }
+
+  template <size_t N>
+  inline void
+  __merge(uintwide (&a)[N], const uintwide (&b)[N])
+  {
+    for (size_t i = 0; i < N; ++i) { __merge(a[i], b[i]); }
+  }
+
+  inline void
+  __merge_max(uintwide& a, const uintwide& b)
+  {
+    if (a < b) { a = b; }
+  }
+
+  inline void
+  __merge(statistics::arc_file_t& a, const statistics::arc_file_t& b)
+  {
+    __merge(a.push_internal, b.push_internal);
+    __merge(a.push_in_order, b.push_in_order);
+    __merge(a.push_out_of_order, b.push_out_of_order);
+    __merge(a.push_level, b.push_level);
+    __merge(a.sort_out_of_order, b.sort_out_of_order);
+    __merge(a.write_stall, b.write_stall);
+  }
+
+  inline void
+  __merge(statistics::node_file_t& a, const statistics::node_file_t& b)
+  {
+    __merge(a.push_node, b.push_node);
+    __merge(a.push_level, b.push_level);
+    __merge(a.write_stall, b.write_stall);
+  }
+
+  inline void
+  __merge(statistics::levelized_priority_queue_t& a,
+          const statistics::levelized_priority_queue_t& b)
+  {
+    __merge(a.push_bucket, b.push_bucket);
+    __merge(a.push_overflow, b.push_overflow);
+    __merge(a.sum_predicted_max_size, b.sum_predicted_max_size);
+    __merge(a.sum_actual_max_size, b.sum_actual_max_size);
+    __merge(a.sum_max_size_ratio, b.sum_max_size_ratio);
+    __merge(a.sum_destructors, b.sum_destructors);
+    __merge(a.sort_ahead, b.sort_ahead);
+    __merge(a.sort_ahead_memory, b.sort_ahead_memory);
+    __merge(a.sort_ahead_elements, b.sort_ahead_elements);
+  }
+
+  inline void
+  __merge(statistics::result_cache_t& a, const statistics::result_cache_t& b)
+  {
+    __merge(a.hits, b.hits);
+    __merge(a.misses, b.misses);
+    __merge(a.evictions, b.evictions);
+    __merge(a.expired, b.expired);
+  }
+
+  inline void
+  __merge(statistics::__alg_base& a, const statistics::__alg_base& b)
+  {
+    __merge(static_cast<statistics::levelized_priority_queue_t&>(a.lpq), b.lpq);
+    __merge(a.lpq.unbucketed, b.lpq.unbucketed);
+    __merge(a.lpq.internal, b.lpq.internal);
+    __merge(a.lpq.external, b.lpq.external);
+    __merge(a.lpq.adaptive, b.lpq.adaptive);
+  }
+
+  inline void
+  __merge(statistics::__raccess_base& a, const statistics::__raccess_base& b)
+  {
+    __merge(a.runs, b.runs);
+    __merge(a.used_narrowest, b.used_narrowest);
+    __merge(a.acc_width, b.acc_width);
+    a.min_width = std::min(a.min_width, b.min_width);
+    a.max_width = std::max(a.max_width, b.max_width);
+  }
+
+  inline void
+  __merge(statistics::__pq2_base& a, const statistics::__pq2_base& b)
+  {
+    __merge(a.runs, b.runs);
+    __merge(a.pq_2_elems, b.pq_2_elems);
+  }
+
+  inline void
+  __merge(statistics::equality_t& a, const statistics::equality_t& b)
+  {
+    __merge(static_cast<statistics::__alg_base&>(a), b);
+    __merge(a.exit_on_same_file, b.exit_on_same_file);
+    __merge(a.exit_on_nodecount, b.exit_on_nodecount);
+    __merge(a.exit_on_varcount, b.exit_on_varcount);
+    __merge(a.exit_on_width, b.exit_on_width);
+    __merge(a.exit_on_terminalcount, b.exit_on_terminalcount);
+    __merge(a.exit_on_fingerprint, b.exit_on_fingerprint);
+    __merge(a.exit_on_levels_mismatch, b.exit_on_levels_mismatch);
+
+    __merge(a.slow_check.runs, b.slow_check.runs);
+    __merge(a.slow_check.exit_on_root, b.slow_check.exit_on_root);
+    __merge(a.slow_check.exit_on_processed_on_level, b.slow_check.exit_on_processed_on_level);
+    __merge(a.slow_check.exit_on_children, b.slow_check.exit_on_children);
+
+    __merge(a.fast_check.runs, b.fast_check.runs);
+    __merge(a.fast_check.exit_on_mismatch, b.fast_check.exit_on_mismatch);
+  }
+
+  inline void
+  __merge(statistics::prod2b_t& a, const statistics::prod2b_t& b)
+  {
+    __merge(static_cast<statistics::__alg_base&>(a), b);
+    __merge(a.trivial_file, b.trivial_file);
+    __merge(a.trivial_terminal, b.trivial_terminal);
+    __merge(a.ra, b.ra);
+    __merge(a.pq, b.pq);
+    __merge(a.piped_inputs, b.piped_inputs);
+  }
+
+  inline void
+  __merge(statistics::prod2u_t& a, const statistics::prod2u_t& b)
+  {
+    __merge(static_cast<statistics::__alg_base&>(a), b);
+    __merge(a.ra, b.ra);
+    __merge(a.pq, b.pq);
+    __merge(a.requests, b.requests);
+    __merge(a.requests_unique, b.requests_unique);
+  }
+
+  inline void
+  __merge(statistics::prodn_t& a, const statistics::prodn_t& b)
+  {
+    __merge(static_cast<statistics::__alg_base&>(a), b);
+    __merge(a.sweeps, b.sweeps);
+    __merge(a.binary, b.binary);
+    __merge(a.shortcut, b.shortcut);
+  }
+
+  inline void
+  __merge(statistics::quantify_t& a, const statistics::quantify_t& b)
+  {
+    __merge(a.runs, b.runs);
+    __merge(a.skipped, b.skipped);
+    __merge(a.singleton_sweeps, b.singleton_sweeps);
+    __merge(a.nested_sweeps, b.nested_sweeps);
+
+    __merge(a.nested_transposition.none, b.nested_transposition.none);
+    __merge(a.nested_transposition.simple, b.nested_transposition.simple);
+    __merge(a.nested_transposition.singleton, b.nested_transposition.singleton);
+    __merge(a.nested_transposition.pruning, b.nested_transposition.pruning);
+
+    __merge(a.nested_policy.shortcut_terminal, b.nested_policy.shortcut_terminal);
+    __merge(a.nested_policy.shortcut_node, b.nested_policy.shortcut_node);
+    __merge(a.nested_policy.products, b.nested_policy.products);
+  }
+
+  inline void
+  __merge(statistics::reduce_t& a, const statistics::reduce_t& b)
+  {
+    __merge(static_cast<statistics::__alg_base&>(a), b);
+    __merge(a.sum_node_arcs, b.sum_node_arcs);
+    __merge(a.sum_terminal_arcs, b.sum_terminal_arcs);
+    __merge(a.removed_by_rule_1, b.removed_by_rule_1);
+    __merge(a.removed_by_rule_2, b.removed_by_rule_2);
+    __merge(a.levels_sorted, b.levels_sorted);
+    __merge(a.levels_hashed, b.levels_hashed);
+  }
+
+  inline void
+  __merge(statistics::reorder_t& a, const statistics::reorder_t& b)
+  {
+    __merge(a.sifting, b.sifting);
+    __merge(a.window, b.window);
+    __merge(a.swaps, b.swaps);
+    __merge(a.skipped_swaps, b.skipped_swaps);
+    __merge(a.reduced_swaps, b.reduced_swaps);
+  }
+
+  inline void
+  __merge(statistics::replace_t& a, const statistics::replace_t& b)
+  {
+    __merge(a.terminal_returns, b.terminal_returns);
+    __merge(a.identity_returns, b.identity_returns);
+    __merge(a.identity_reduces, b.identity_reduces);
+    __merge(a.shift_returns, b.shift_returns);
+    __merge(a.monotonic_scans, b.monotonic_scans);
+    __merge(a.monotonic_reduces, b.monotonic_reduces);
+    __merge(a.level_moves, b.level_moves);
+    __merge(a.level_jumps, b.level_jumps);
+  }
+
+  inline void
+  __merge(statistics::small_t& a, const statistics::small_t& b)
+  {
+    __merge(a.runs, b.runs);
+    __merge(a.aborted, b.aborted);
+    __merge(a.nodes, b.nodes);
+  }
+
+  inline void
+  __merge(statistics::nested_sweeping_t& a, const statistics::nested_sweeping_t& b)
+  {
+    __merge(a.skips, b.skips);
+    __merge(a.runs, b.runs);
+
+    __merge(static_cast<statistics::reduce_t&>(a.outer_up), b.outer_up);
+    __merge(a.outer_up.reduced_levels, b.outer_up.reduced_levels);
+    __merge(a.outer_up.reduced_levels__fast, b.outer_up.reduced_levels__fast);
+    __merge(a.outer_up.nested_levels, b.outer_up.nested_levels);
+    __merge(a.outer_up.skipped_nested_levels, b.outer_up.skipped_nested_levels);
+    __merge(a.outer_up.skipped_nested_levels__prune, b.outer_up.skipped_nested_levels__prune);
+    __merge(a.outer_up.collapse_to_terminal, b.outer_up.collapse_to_terminal);
+
+    __merge(a.inner_down.inputs.acc_size, b.inner_down.inputs.acc_size);
+    __merge_max(a.inner_down.inputs.max_size, b.inner_down.inputs.max_size);
+    __merge(a.inner_down.inputs.acc_width, b.inner_down.inputs.acc_width);
+    __merge_max(a.inner_down.inputs.max_width, b.inner_down.inputs.max_width);
+    __merge(a.inner_down.inputs.acc_levels, b.inner_down.inputs.acc_levels);
+    __merge_max(a.inner_down.inputs.max_levels, b.inner_down.inputs.max_levels);
+    __merge(a.inner_down.requests.terminals, b.inner_down.requests.terminals);
+    __merge(a.inner_down.requests.preserving, b.inner_down.requests.preserving);
+    __merge(a.inner_down.requests.modifying, b.inner_down.requests.modifying);
+    __merge(a.inner_down.removed_by_rule_1, b.inner_down.removed_by_rule_1);
+    __merge(a.inner_down.ra_runs, b.inner_down.ra_runs);
+    __merge(a.inner_down.pq_runs, b.inner_down.pq_runs);
+
+    __merge(static_cast<statistics::reduce_t&>(a.inner_up), b.inner_up);
+    __merge(a.inner_up.inner_arcs, b.inner_up.inner_arcs);
+    __merge(a.inner_up.outer_arcs, b.inner_up.outer_arcs);
+    __merge(a.inner_up.reduced_levels, b.inner_up.reduced_levels);
+    __merge(a.inner_up.reduced_levels__fast, b.inner_up.reduced_levels__fast);
+  }
+
+  inline void
+  __merge(statistics& a, const statistics& b)
+  {
+    // i/o
+    __merge(a.arc_file, b.arc_file);
+    __merge(a.node_file, b.node_file);
+
+    // data structures
+    __merge(a.levelized_priority_queue, b.levelized_priority_queue);
+    __merge(a.result_cache, b.result_cache);
+
+    // top-down sweeps
+    __merge(static_cast<statistics::__alg_base&>(a.count), b.count);
+    __merge(a.equality, b.equality);
+    __merge(static_cast<statistics::__alg_base&>(a.intercut), b.intercut);
+    __merge(static_cast<statistics::__alg_base&>(a.optmin), b.optmin);
+    __merge(a.prod2b, b.prod2b);
+    __merge(a.prod2u, b.prod2u);
+    __merge(a.prodn, b.prodn);
+    __merge(static_cast<statistics::__alg_base&>(a.prod3), b.prod3);
+    __merge(a.quantify, b.quantify);
+    __merge(static_cast<statistics::__alg_base&>(a.select), b.select);
+
+    // bottom-up sweeps
+    __merge(a.reduce, b.reduce);
+
+    // other algorithms
+    __merge(a.reorder, b.reorder);
+    __merge(a.replace, b.replace);
+    __merge(a.small, b.small);
+    __merge(a.nested_sweeping, b.nested_sweeping);
+  }
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  // Statistics of all threads that have exited.
+  //
+  // These are function-local statics, such that they are initialised before the first thread (in
+  // particular the main thread) adds to them on exit.
+  inline statistics&
+  __exited_statistics()
+  {
+    static statistics s;
+    return s;
+  }
+
+  inline std::mutex&
+  __exited_statistics_mutex()
+  {
+    static std::mutex m;
+    return m;
+  }
+
+  void
+  statistics_exit(const statistics& s)
+  {
+    const std::lock_guard<std::mutex> lock(__exited_statistics_mutex());
+    __merge(__exited_statistics(), s);
+  }
+
+  void
+  statistics_reset_thread()
+  {
+    // i/o
+    stats_arc_file.reset();
+    stats_node_file.reset();
+
+    // data structures
+    stats_levelized_priority_queue.reset();
+    stats_result_cache.reset();
+
+    // top-down sweeps
+    stats_count.reset();
+    stats_equality.reset();
+    stats_intercut.reset();
+    stats_optmin.reset();
+    stats_prod2b.reset();
+    stats_prod2u.reset();
+    stats_prodn.reset();
+    stats_prod3.reset();
+    stats_quantify.reset();
+    stats_select.reset();
+
+    // bottom-up sweeps
+    stats_reduce.reset();
+
+    // other algorithms
+    stats_reorder.reset();
+    stats_replace.reset();
+    stats_small.reset();
+    nested_sweeping::stats.reset();
+  }
+}
 
 namespace adiar
 {
@@ -32,64 +383,53 @@ namespace adiar
     std::cerr << "Statistics not gathered. Please compile with 'ADIAR_STATS'" << std::endl;
 #endif
 
-    return { // i/o
-             internal::stats_arc_file,
-             internal::stats_node_file,
-
-             // data structures
-             internal::stats_levelized_priority_queue,
-
-             // top-down sweeps
-             internal::stats_count,
-             internal::stats_equality,
-             internal::stats_intercut,
-             internal::stats_optmin,
-             internal::stats_prod2b,
-             internal::stats_prod2u,
-             stats_prod3,
-             internal::stats_quantify,
-             internal::stats_select,
-
-             // bottom-up sweeps
-             internal::stats_reduce,
-
-             // other algorithms
-             internal::stats_replace,
-             internal::nested_sweeping::stats
+    statistics s = { // i/o
+                     internal::stats_arc_file,
+                     internal::stats_node_file,
+
+                     // data structures
+                     internal::stats_levelized_priority_queue,
+                     internal::stats_result_cache,
+
+                     // top-down sweeps
+                     internal::stats_count,
+                     internal::stats_equality,
+                     internal::stats_intercut,
+                     internal::stats_optmin,
+                     internal::stats_prod2b,
+                     internal::stats_prod2u,
+                     internal::stats_prodn,
+                     stats_prod3,
+                     internal::stats_quantify,
+                     internal::stats_select,
+
+                     // bottom-up sweeps
+                     internal::stats_reduce,
+
+                     // other algorithms
+                     internal::stats_reorder,
+                     internal::stats_replace,
+                     internal::stats_small,
+                     internal::nested_sweeping::stats
     };
+
+    const std::lock_guard<std::mutex> lock(internal::__exited_statistics_mutex());
+    internal::__merge(s, internal::__exited_statistics());
+    return s;
   }
 
   void
   statistics_reset()
   {
-    // i/o
-    internal::stats_arc_file  = {};
-    internal::stats_node_file = {};
-
-    // data structures
-    internal::stats_levelized_priority_queue = {};
-
-    // top-down sweeps
-    internal::stats_count    = {};
-    internal::stats_equality = {};
-    internal::stats_intercut = {};
-    internal::stats_optmin   = {};
-    internal::stats_prod2b   = {};
-    stats_prod3              = {};
-    internal::stats_quantify = {};
-    internal::stats_select   = {};
-
-    // bottom-up sweeps
-    internal::stats_reduce = {};
+    internal::statistics_reset_thread();
 
-    // other algorithms
-    internal::stats_replace          = {};
-    internal::nested_sweeping::stats = {};
+    const std::lock_guard<std::mutex> lock(internal::__exited_statistics_mutex());
+    internal::__exited_statistics() = {};
   }
 
   //////////////////////////////////////////////////////////////////////////////
   // Helper functions for pretty printing (UNIX)
-  int indent_level = 0;
+  thread_local int indent_level = 0;
 
   constexpr int FLOAT_PRECISION = 2;
 
@@ -132,14 +472,14 @@ namespace adiar
   }
 
   void
-  __printstat_arc_file(std::ostream& o)
+  __printstat_arc_file(std::ostream& o, const statistics& s)
   {
     o << indent << bold_on << "Arc Files" << bold_off << endl;
 
     indent_level++;
 
-    uintwide total_pushes = internal::stats_arc_file.push_internal
-      + internal::stats_arc_file.push_in_order + internal::stats_arc_file.push_out_of_order;
+    uintwide total_pushes = s.arc_file.push_internal
+      + s.arc_file.push_in_order + s.arc_file.push_out_of_order;
 
     if (total_pushes == 0u) {
       o << indent << "No writes" << endl;
@@ -150,34 +490,37 @@ namespace adiar
     o << indent << bold_on << label << "unsafe_push(arc ...)" << bold_off << total_pushes << endl;
 
     indent_level++;
-    o << indent << label << "internal" << internal::stats_arc_file.push_internal << " = "
-      << internal::percent_frac(internal::stats_arc_file.push_internal, total_pushes) << percent
+    o << indent << label << "internal" << s.arc_file.push_internal << " = "
+      << internal::percent_frac(s.arc_file.push_internal, total_pushes) << percent
       << endl;
-    o << indent << label << "terminals (in-order)" << internal::stats_arc_file.push_in_order
-      << " = " << internal::percent_frac(internal::stats_arc_file.push_in_order, total_pushes)
+    o << indent << label << "terminals (in-order)" << s.arc_file.push_in_order
+      << " = " << internal::percent_frac(s.arc_file.push_in_order, total_pushes)
       << percent << endl;
-    o << indent << label << "terminals (out-of-order)" << internal::stats_arc_file.push_out_of_order
-      << " = " << internal::percent_frac(internal::stats_arc_file.push_out_of_order, total_pushes)
+    o << indent << label << "terminals (out-of-order)" << s.arc_file.push_out_of_order
+      << " = " << internal::percent_frac(s.arc_file.push_out_of_order, total_pushes)
       << percent << endl;
     indent_level--;
 
     o << indent << bold_on << label << "push(level_info ...)" << bold_off
-      << internal::stats_arc_file.push_level << endl;
+      << s.arc_file.push_level << endl;
 
     o << indent << bold_on << label << "out-of-order sortings" << bold_off
-      << internal::stats_arc_file.sort_out_of_order << endl;
+      << s.arc_file.sort_out_of_order << endl;
+
+    o << indent << bold_on << label << "write stall time (ns)" << bold_off
+      << s.arc_file.write_stall << endl;
 
     indent_level--;
   }
 
   void
-  __printstat_node_file(std::ostream& o)
+  __printstat_node_file(std::ostream& o, const statistics& s)
   {
     o << indent << bold_on << "Node Files" << bold_off << endl;
 
     indent_level++;
 
-    if (internal::stats_node_file.push_node == 0u) {
+    if (s.node_file.push_node == 0u) {
       o << indent << "No writes" << endl;
       indent_level--;
       return;
@@ -186,10 +529,13 @@ namespace adiar
     o << indent << bold_on << label << "unsafe_push(...)" << bold_off << endl;
 
     indent_level++;
-    o << indent << label << "node" << internal::stats_node_file.push_node << endl;
-    o << indent << label << "level_info" << internal::stats_node_file.push_level << endl;
+    o << indent << label << "node" << s.node_file.push_node << endl;
+    o << indent << label << "level_info" << s.node_file.push_level << endl;
     indent_level--;
 
+    o << indent << bold_on << label << "write stall time (ns)" << bold_off
+      << s.node_file.write_stall << endl;
+
     indent_level--;
   }
 
@@ -231,9 +577,51 @@ namespace adiar
       << stats.sum_predicted_max_size << " = "
       << internal::percent_frac(stats.sum_actual_max_size, stats.sum_predicted_max_size) << percent
       << endl;
+    indent_level--;
+
+    o << indent << endl;
+
+    o << indent << bold_on << label << "sort ahead" << bold_off << stats.sort_ahead << " = "
+      << internal::percent_frac(stats.sort_ahead, stats.sum_destructors) << percent << endl;
+
+    indent_level++;
+    o << indent << label << "merge memory (bytes)" << stats.sort_ahead_memory << endl;
+    o << indent << label << "sorted elements" << stats.sort_ahead_elements << endl;
     indent_level -= 2;
   }
 
+  void
+  __printstat_result_cache(std::ostream& o, const statistics& s)
+  {
+    o << indent << bold_on << "Result Cache" << bold_off << endl;
+
+    indent_level++;
+
+    const uintwide total_lookups =
+      s.result_cache.hits + s.result_cache.misses;
+    if (total_lookups == 0) {
+      o << indent << "Not used" << endl;
+      indent_level--;
+      return;
+    }
+
+    o << indent << bold_on << label << "lookups" << bold_off << total_lookups << endl;
+
+    indent_level++;
+    o << indent << label << "hits" << s.result_cache.hits << " = "
+      << internal::percent_frac(s.result_cache.hits, total_lookups) << percent
+      << endl;
+    o << indent << label << "misses" << s.result_cache.misses << " = "
+      << internal::percent_frac(s.result_cache.misses, total_lookups) << percent
+      << endl;
+    indent_level--;
+
+    o << indent << label << "evictions" << s.result_cache.evictions << endl;
+    o << indent << label << "expired" << s.result_cache.expired << endl;
+
+    indent_level--;
+  }
+
   void
   __printstat_alg_base(std::ostream& o, const statistics::__alg_base& stats)
   {
@@ -247,6 +635,9 @@ namespace adiar
     o << indent << label << "external memory" << stats.lpq.external << " = "
       << internal::percent_frac(stats.lpq.external, total_lpqs) << percent << endl;
 
+    o << indent << label << "adaptive memory" << stats.lpq.adaptive << " = "
+      << internal::percent_frac(stats.lpq.adaptive, total_lpqs) << percent << endl;
+
     o << indent << label << "internal memory" << total_internal_lpqs << " = "
       << internal::percent_frac(total_internal_lpqs, total_lpqs) << percent << endl;
 
@@ -261,9 +652,9 @@ namespace adiar
   }
 
   void
-  __printstat_count(std::ostream& o)
+  __printstat_count(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = internal::stats_count.lpq.total();
+    uintwide total_runs = s.count.lpq.total();
     o << indent << bold_on << label << "Count" << bold_off << total_runs << endl;
 
     indent_level++;
@@ -273,14 +664,14 @@ namespace adiar
       return;
     }
 
-    __printstat_alg_base(o, internal::stats_count);
+    __printstat_alg_base(o, s.count);
     indent_level--;
   }
 
   void
-  __printstat_comparison_check(std::ostream& o)
+  __printstat_comparison_check(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = internal::stats_equality.lpq.total();
+    uintwide total_runs = s.equality.lpq.total();
     o << indent << bold_on << label << "Comparison Check" << bold_off << total_runs << endl;
 
     indent_level++;
@@ -290,14 +681,14 @@ namespace adiar
       return;
     }
 
-    __printstat_alg_base(o, internal::stats_equality);
+    __printstat_alg_base(o, s.equality);
     indent_level--;
   }
 
   void
-  __printstat_intercut(std::ostream& o)
+  __printstat_intercut(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = internal::stats_intercut.lpq.total();
+    uintwide total_runs = s.intercut.lpq.total();
     o << indent << bold_on << label << "Intercut" << bold_off << total_runs << endl;
 
     indent_level++;
@@ -307,18 +698,19 @@ namespace adiar
       return;
     }
 
-    __printstat_alg_base(o, internal::stats_intercut);
+    __printstat_alg_base(o, s.intercut);
     indent_level--;
   }
 
   void
-  __printstat_isomorphism(std::ostream& o)
+  __printstat_isomorphism(std::ostream& o, const statistics& s)
   {
-    const uintwide total_runs = internal::stats_equality.exit_on_same_file
-      + internal::stats_equality.exit_on_nodecount + internal::stats_equality.exit_on_varcount
-      + internal::stats_equality.exit_on_width + internal::stats_equality.exit_on_terminalcount
-      + internal::stats_equality.exit_on_levels_mismatch + internal::stats_equality.slow_check.runs
-      + internal::stats_equality.fast_check.runs;
+    const uintwide total_runs = s.equality.exit_on_same_file
+      + s.equality.exit_on_nodecount + s.equality.exit_on_varcount
+      + s.equality.exit_on_width + s.equality.exit_on_terminalcount
+      + s.equality.exit_on_fingerprint
+      + s.equality.exit_on_levels_mismatch + s.equality.slow_check.runs
+      + s.equality.fast_check.runs;
 
     o << indent << bold_on << label << "Isomorphism Check" << bold_off << total_runs << endl;
 
@@ -334,14 +726,16 @@ namespace adiar
     indent_level++;
     o << indent << "O(1) termination cases" << endl;
     indent_level++;
-    o << indent << label << "same file" << internal::stats_equality.exit_on_same_file << endl;
-    o << indent << label << "node count mismatch" << internal::stats_equality.exit_on_nodecount
+    o << indent << label << "same file" << s.equality.exit_on_same_file << endl;
+    o << indent << label << "node count mismatch" << s.equality.exit_on_nodecount
       << endl;
-    o << indent << label << "var count mismatch" << internal::stats_equality.exit_on_varcount
+    o << indent << label << "var count mismatch" << s.equality.exit_on_varcount
       << endl;
-    o << indent << label << "width mismatch" << internal::stats_equality.exit_on_width << endl;
+    o << indent << label << "width mismatch" << s.equality.exit_on_width << endl;
     o << indent << label << "terminal count mismatch"
-      << internal::stats_equality.exit_on_terminalcount << endl;
+      << s.equality.exit_on_terminalcount << endl;
+    o << indent << label << "fingerprint mismatch" << s.equality.exit_on_fingerprint
+      << endl;
     indent_level--;
 
     o << indent << endl;
@@ -349,27 +743,27 @@ namespace adiar
     o << indent << "O(L/B) termination cases" << endl;
     indent_level++;
     o << indent << label << "level info mismatch"
-      << internal::stats_equality.exit_on_levels_mismatch << endl;
+      << s.equality.exit_on_levels_mismatch << endl;
     indent_level--;
 
     o << indent << endl;
 
-    o << indent << label << "O(sort(N)) algorithm" << internal::stats_equality.slow_check.runs
+    o << indent << label << "O(sort(N)) algorithm" << s.equality.slow_check.runs
       << endl;
     indent_level++;
     o << indent << label << "local violation (root)"
-      << internal::stats_equality.slow_check.exit_on_root << endl;
+      << s.equality.slow_check.exit_on_root << endl;
     o << indent << label << "local violation (other)"
-      << internal::stats_equality.slow_check.exit_on_children << endl;
+      << s.equality.slow_check.exit_on_children << endl;
     o << indent << label << "too many requests"
-      << internal::stats_equality.slow_check.exit_on_processed_on_level << endl;
+      << s.equality.slow_check.exit_on_processed_on_level << endl;
     indent_level--;
 
     o << indent << endl;
 
-    o << indent << label << "O(N/B) algorithm" << internal::stats_equality.fast_check.runs << endl;
+    o << indent << label << "O(N/B) algorithm" << s.equality.fast_check.runs << endl;
     indent_level++;
-    o << indent << label << "node mismatch" << internal::stats_equality.fast_check.exit_on_mismatch
+    o << indent << label << "node mismatch" << s.equality.fast_check.exit_on_mismatch
       << endl;
 
     indent_level -= 2;
@@ -384,9 +778,9 @@ namespace adiar
   }
 
   void
-  __printstat_optmin(std::ostream& o)
+  __printstat_optmin(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = internal::stats_optmin.lpq.total();
+    uintwide total_runs = s.optmin.lpq.total();
     o << indent << bold_on << label << "Optimal Minimum" << bold_off << total_runs << endl;
 
     indent_level++;
@@ -396,16 +790,16 @@ namespace adiar
       return;
     }
 
-    __printstat_alg_base(o, internal::stats_optmin);
+    __printstat_alg_base(o, s.optmin);
     indent_level--;
   }
 
   void
-  __printstat_prod2b(std::ostream& o)
+  __printstat_prod2b(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = internal::stats_prod2b.trivial_file
-      + internal::stats_prod2b.trivial_terminal + internal::stats_prod2b.ra.runs
-      + internal::stats_prod2b.pq.runs;
+    uintwide total_runs = s.prod2b.trivial_file
+      + s.prod2b.trivial_terminal + s.prod2b.ra.runs
+      + s.prod2b.pq.runs;
 
     o << indent << bold_on << label << "Product Construction (2-ary) <binary>" << bold_off
       << total_runs << endl;
@@ -418,26 +812,26 @@ namespace adiar
     }
 
     o << indent << bold_on << label << "case [same file]" << bold_off
-      << internal::stats_prod2b.trivial_file << " = "
-      << internal::percent_frac(internal::stats_prod2b.trivial_file, total_runs) << percent << endl;
+      << s.prod2b.trivial_file << " = "
+      << internal::percent_frac(s.prod2b.trivial_file, total_runs) << percent << endl;
 
     o << indent << endl;
 
     o << indent << bold_on << label << "case [terminal]" << bold_off
-      << internal::stats_prod2b.trivial_terminal << " = "
-      << internal::percent_frac(internal::stats_prod2b.trivial_terminal, total_runs) << percent
+      << s.prod2b.trivial_terminal << " = "
+      << internal::percent_frac(s.prod2b.trivial_terminal, total_runs) << percent
       << endl;
 
     o << indent << endl;
 
     o << indent << bold_on << label << "case [random access]" << bold_off
-      << internal::stats_prod2b.ra.runs << " = "
-      << internal::percent_frac(internal::stats_prod2b.ra.runs, total_runs) << percent << endl;
-    if (internal::stats_prod2b.ra.runs > 0u) {
+      << s.prod2b.ra.runs << " = "
+      << internal::percent_frac(s.prod2b.ra.runs, total_runs) << percent << endl;
+    if (s.prod2b.ra.runs > 0u) {
       indent_level++;
-      o << indent << label << "used narrowest:" << internal::stats_prod2b.ra.used_narrowest << " = "
-        << internal::percent_frac(internal::stats_prod2b.ra.used_narrowest,
-                                  internal::stats_prod2b.ra.runs)
+      o << indent << label << "used narrowest:" << s.prod2b.ra.used_narrowest << " = "
+        << internal::percent_frac(s.prod2b.ra.used_narrowest,
+                                  s.prod2b.ra.runs)
         << percent << endl;
 
       o << indent << endl;
@@ -445,12 +839,12 @@ namespace adiar
       o << indent << bold_on << label << "width:" << bold_off << endl;
       indent_level++;
 
-      o << indent << label << "minimum:" << internal::stats_prod2b.ra.min_width << endl;
+      o << indent << label << "minimum:" << s.prod2b.ra.min_width << endl;
 
-      o << indent << label << "maximum:" << internal::stats_prod2b.ra.max_width << endl;
+      o << indent << label << "maximum:" << s.prod2b.ra.max_width << endl;
 
-      o << indent << label << "accumulated:" << internal::stats_prod2b.ra.acc_width << " (avg = "
-        << internal::frac(internal::stats_prod2b.ra.acc_width, internal::stats_prod2b.ra.runs)
+      o << indent << label << "accumulated:" << s.prod2b.ra.acc_width << " (avg = "
+        << internal::frac(s.prod2b.ra.acc_width, s.prod2b.ra.runs)
         << ")" << endl;
 
       indent_level -= 2;
@@ -459,24 +853,26 @@ namespace adiar
     o << indent << endl;
 
     o << indent << bold_on << label << "case [priority queue]" << bold_off
-      << internal::stats_prod2b.pq.runs << " = "
-      << internal::percent_frac(internal::stats_prod2b.pq.runs, total_runs) << percent << endl;
-    if (internal::stats_prod2b.pq.runs > 0u) {
+      << s.prod2b.pq.runs << " = "
+      << internal::percent_frac(s.prod2b.pq.runs, total_runs) << percent << endl;
+    if (s.prod2b.pq.runs > 0u) {
       indent_level++;
-      o << indent << label << "pq2 elements:" << internal::stats_prod2b.pq.pq_2_elems << endl;
+      o << indent << label << "pq2 elements:" << s.prod2b.pq.pq_2_elems << endl;
+
+      o << indent << label << "piped inputs:" << s.prod2b.piped_inputs << endl;
 
       indent_level--;
     }
 
     o << indent << endl;
-    __printstat_alg_base(o, internal::stats_prod2b);
+    __printstat_alg_base(o, s.prod2b);
     indent_level--;
   }
 
   void
-  __printstat_prod2u(std::ostream& o)
+  __printstat_prod2u(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = internal::stats_prod2u.ra.runs + internal::stats_prod2u.pq.runs;
+    uintwide total_runs = s.prod2u.ra.runs + s.prod2u.pq.runs;
     o << indent << bold_on << label << "Product Construction (2-ary) <unary>" << bold_off
       << total_runs << endl;
 
@@ -488,13 +884,13 @@ namespace adiar
     }
 
     o << indent << bold_on << label << "case [random access]" << bold_off
-      << internal::stats_prod2u.ra.runs << " = "
-      << internal::percent_frac(internal::stats_prod2u.ra.runs, total_runs) << percent << endl;
-    if (internal::stats_prod2u.ra.runs > 0u) {
+      << s.prod2u.ra.runs << " = "
+      << internal::percent_frac(s.prod2u.ra.runs, total_runs) << percent << endl;
+    if (s.prod2u.ra.runs > 0u) {
       indent_level++;
-      o << indent << label << "used narrowest:" << internal::stats_prod2u.ra.used_narrowest << " = "
-        << internal::percent_frac(internal::stats_prod2u.ra.used_narrowest,
-                                  internal::stats_prod2u.ra.runs)
+      o << indent << label << "used narrowest:" << s.prod2u.ra.used_narrowest << " = "
+        << internal::percent_frac(s.prod2u.ra.used_narrowest,
+                                  s.prod2u.ra.runs)
         << percent << endl;
 
       o << indent << endl;
@@ -502,12 +898,12 @@ namespace adiar
       o << indent << bold_on << label << "width:" << bold_off << endl;
       indent_level++;
 
-      o << indent << label << "minimum:" << internal::stats_prod2u.ra.min_width << endl;
+      o << indent << label << "minimum:" << s.prod2u.ra.min_width << endl;
 
-      o << indent << label << "maximum:" << internal::stats_prod2u.ra.max_width << endl;
+      o << indent << label << "maximum:" << s.prod2u.ra.max_width << endl;
 
-      o << indent << label << "accumulated:" << internal::stats_prod2u.ra.acc_width << " (avg = "
-        << internal::frac(internal::stats_prod2u.ra.acc_width, internal::stats_prod2u.ra.runs)
+      o << indent << label << "accumulated:" << s.prod2u.ra.acc_width << " (avg = "
+        << internal::frac(s.prod2u.ra.acc_width, s.prod2u.ra.runs)
         << ")" << endl;
 
       indent_level -= 2;
@@ -516,17 +912,17 @@ namespace adiar
     o << indent << endl;
 
     o << indent << bold_on << label << "case [priority queue]" << bold_off
-      << internal::stats_prod2u.pq.runs << " = "
-      << internal::percent_frac(internal::stats_prod2u.pq.runs, total_runs) << percent << endl;
-    if (internal::stats_prod2u.pq.runs > 0u) {
+      << s.prod2u.pq.runs << " = "
+      << internal::percent_frac(s.prod2u.pq.runs, total_runs) << percent << endl;
+    if (s.prod2u.pq.runs > 0u) {
       indent_level++;
-      o << indent << label << "pq2 elements:" << internal::stats_prod2u.pq.pq_2_elems << endl;
+      o << indent << label << "pq2 elements:" << s.prod2u.pq.pq_2_elems << endl;
 
       indent_level--;
     }
 
     o << indent << endl;
-    __printstat_alg_base(o, internal::stats_prod2u);
+    __printstat_alg_base(o, s.prod2u);
     indent_level--;
 
     o << indent << endl;
@@ -536,7 +932,7 @@ namespace adiar
       indent_level++;
       {
         const uintwide total_requests =
-          internal::stats_prod2u.requests[0] + internal::stats_prod2u.requests[1];
+          s.prod2u.requests[0] + s.prod2u.requests[1];
 
         o << indent << label << "incl. duplicates" << total_requests << endl;
 
@@ -546,8 +942,8 @@ namespace adiar
           t += static_cast<char>('1' + arity_idx);
           t += "-ary";
 
-          o << indent << label << t << internal::stats_prod2u.requests[arity_idx] << " = "
-            << internal::percent_frac(internal::stats_prod2u.requests[arity_idx], total_requests)
+          o << indent << label << t << s.prod2u.requests[arity_idx] << " = "
+            << internal::percent_frac(s.prod2u.requests[arity_idx], total_requests)
             << percent << endl;
         }
         indent_level--;
@@ -557,7 +953,7 @@ namespace adiar
 
       {
         const uintwide total_unique =
-          internal::stats_prod2u.requests_unique[0] + internal::stats_prod2u.requests_unique[1];
+          s.prod2u.requests_unique[0] + s.prod2u.requests_unique[1];
 
         o << indent << label << "excl. duplicates" << total_unique << endl;
 
@@ -567,8 +963,8 @@ namespace adiar
           t += static_cast<char>('1' + arity_idx);
           t += "-ary";
 
-          o << indent << label << t << internal::stats_prod2u.requests_unique[arity_idx] << " = "
-            << internal::percent_frac(internal::stats_prod2u.requests_unique[arity_idx],
+          o << indent << label << t << s.prod2u.requests_unique[arity_idx] << " = "
+            << internal::percent_frac(s.prod2u.requests_unique[arity_idx],
                                       total_unique)
             << percent << endl;
         }
@@ -579,9 +975,41 @@ namespace adiar
   }
 
   void
-  __printstat_prod3(std::ostream& o)
+  __printstat_prodn(std::ostream& o, const statistics& s)
+  {
+    const uintwide total_runs = s.prodn.lpq.total();
+    o << indent << bold_on << label << "Product Construction (n-ary)" << bold_off << total_runs
+      << endl;
+
+    indent_level++;
+    if (total_runs == 0u && s.prodn.binary == 0u) {
+      o << indent << "Not used" << endl;
+      indent_level--;
+      return;
+    }
+
+    o << indent << bold_on << "arity" << bold_off << endl;
+
+    indent_level++;
+    o << indent << label << "3-ary" << s.prodn.sweeps[0] << " = "
+      << internal::percent_frac(s.prodn.sweeps[0], total_runs) << percent << endl;
+    o << indent << label << "4-ary" << s.prodn.sweeps[1] << " = "
+      << internal::percent_frac(s.prodn.sweeps[1], total_runs) << percent << endl;
+    o << indent << label << "2-ary (delegated)" << s.prodn.binary << endl;
+    indent_level--;
+
+    o << indent << endl;
+    o << indent << label << "shortcut" << s.prodn.shortcut << endl;
+
+    o << indent << endl;
+    __printstat_alg_base(o, s.prodn);
+    indent_level--;
+  }
+
+  void
+  __printstat_prod3(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = stats_prod3.lpq.total();
+    uintwide total_runs = s.prod3.lpq.total();
     o << indent << bold_on << label << "Product Construction (3-ary)" << bold_off << total_runs
       << endl;
 
@@ -592,14 +1020,14 @@ namespace adiar
       return;
     }
 
-    __printstat_alg_base(o, stats_prod3);
+    __printstat_alg_base(o, s.prod3);
     indent_level--;
   }
 
   void
-  __printstat_quantify(std::ostream& o)
+  __printstat_quantify(std::ostream& o, const statistics& s)
   {
-    const uintwide total_runs = internal::stats_quantify.runs;
+    const uintwide total_runs = s.quantify.runs;
 
     o << indent << bold_on << label << "Quantification" << bold_off << total_runs << endl;
 
@@ -612,23 +1040,23 @@ namespace adiar
 
     {
       o << indent << bold_on << label << "case [skipped]" << bold_off
-        << internal::stats_quantify.skipped << " = "
-        << internal::percent_frac(internal::stats_quantify.skipped, total_runs) << percent << endl;
+        << s.quantify.skipped << " = "
+        << internal::percent_frac(s.quantify.skipped, total_runs) << percent << endl;
     }
 
     {
       o << indent << endl;
 
       o << indent << bold_on << label << "case [singleton sweep]" << bold_off
-        << internal::stats_quantify.singleton_sweeps << endl;
+        << s.quantify.singleton_sweeps << endl;
     }
 
     {
       o << indent << endl;
 
       o << indent << bold_on << label << "case [nested sweep]" << bold_off
-        << internal::stats_quantify.nested_sweeps << " = "
-        << internal::percent_frac(internal::stats_quantify.nested_sweeps, total_runs) << percent
+        << s.quantify.nested_sweeps << " = "
+        << internal::percent_frac(s.quantify.nested_sweeps, total_runs) << percent
         << endl;
 
       indent_level++;
@@ -637,43 +1065,43 @@ namespace adiar
         o << indent << bold_on << label << "transposition" << bold_off << endl;
 
         indent_level++;
-        o << indent << label << "none" << internal::stats_quantify.nested_transposition.none
+        o << indent << label << "none" << s.quantify.nested_transposition.none
           << endl;
 
-        o << indent << label << "simple" << internal::stats_quantify.nested_transposition.simple
+        o << indent << label << "simple" << s.quantify.nested_transposition.simple
           << endl;
 
         o << indent << label << "singleton quantification"
-          << internal::stats_quantify.nested_transposition.singleton << endl;
+          << s.quantify.nested_transposition.singleton << endl;
 
-        o << indent << label << "pruning" << internal::stats_quantify.nested_transposition.pruning
+        o << indent << label << "pruning" << s.quantify.nested_transposition.pruning
           << endl;
 
         indent_level--;
       }
       o << indent << endl;
 
-      const uintwide total_roots = internal::stats_quantify.nested_policy.shortcut_terminal
-        + internal::stats_quantify.nested_policy.shortcut_node
-        + internal::stats_quantify.nested_policy.products;
+      const uintwide total_roots = s.quantify.nested_policy.shortcut_terminal
+        + s.quantify.nested_policy.shortcut_node
+        + s.quantify.nested_policy.products;
 
       o << indent << label << "root requests" << total_roots << endl;
 
       indent_level++;
 
       o << indent << label << "shortcut (terminal)"
-        << internal::stats_quantify.nested_policy.shortcut_terminal << " = "
-        << internal::percent_frac(internal::stats_quantify.nested_policy.shortcut_terminal,
+        << s.quantify.nested_policy.shortcut_terminal << " = "
+        << internal::percent_frac(s.quantify.nested_policy.shortcut_terminal,
                                   total_roots)
         << percent << endl;
 
       o << indent << label << "shortcut (node)"
-        << internal::stats_quantify.nested_policy.shortcut_node << " = "
-        << internal::percent_frac(internal::stats_quantify.nested_policy.shortcut_node, total_roots)
+        << s.quantify.nested_policy.shortcut_node << " = "
+        << internal::percent_frac(s.quantify.nested_policy.shortcut_node, total_roots)
         << percent << endl;
 
-      o << indent << label << "products" << internal::stats_quantify.nested_policy.products << " = "
-        << internal::percent_frac(internal::stats_quantify.nested_policy.products, total_roots)
+      o << indent << label << "products" << s.quantify.nested_policy.products << " = "
+        << internal::percent_frac(s.quantify.nested_policy.products, total_roots)
         << percent << endl;
 
       indent_level -= 2;
@@ -682,9 +1110,9 @@ namespace adiar
   }
 
   void
-  __printstat_select(std::ostream& o)
+  __printstat_select(std::ostream& o, const statistics& s)
   {
-    uintwide total_runs = internal::stats_select.lpq.total();
+    uintwide total_runs = s.select.lpq.total();
     o << indent << bold_on << label << "Selection" << bold_off << total_runs << endl;
 
     indent_level++;
@@ -694,12 +1122,12 @@ namespace adiar
       return;
     }
 
-    __printstat_alg_base(o, internal::stats_select);
+    __printstat_alg_base(o, s.select);
     indent_level--;
   }
 
   void
-  __printstat_reduce(std::ostream& o, statistics::reduce_t& stats_struct = internal::stats_reduce)
+  __printstat_reduce(std::ostream& o, const statistics::reduce_t& stats_struct)
   {
     const bool is_outer = indent_level == 0;
     if (is_outer) {
@@ -744,6 +1172,20 @@ namespace adiar
       o << "none" << endl;
     }
 
+    const uintwide total_levels = stats_struct.levels_sorted + stats_struct.levels_hashed;
+    if (total_levels > 0u) {
+      o << indent << endl;
+      o << indent << bold_on << label << "levels" << bold_off << total_levels << endl;
+
+      indent_level++;
+      o << indent << label << "rule 2 by sorting:" << stats_struct.levels_sorted << " = "
+        << internal::percent_frac(stats_struct.levels_sorted, total_levels) << percent << endl;
+
+      o << indent << label << "rule 2 by hashing:" << stats_struct.levels_hashed << " = "
+        << internal::percent_frac(stats_struct.levels_hashed, total_levels) << percent << endl;
+      indent_level--;
+    }
+
     o << indent << endl;
     __printstat_alg_base(o, stats_struct);
 
@@ -751,12 +1193,12 @@ namespace adiar
   }
 
   void
-  __printstat_replace(std::ostream& o)
+  __printstat_replace(std::ostream& o, const statistics& s)
   {
-    const uintwide total_runs = internal::stats_replace.terminal_returns
-      + internal::stats_replace.identity_returns + internal::stats_replace.identity_reduces
-      + internal::stats_replace.monotonic_scans + internal::stats_replace.monotonic_reduces
-      + internal::stats_replace.nested_sweeps;
+    const uintwide total_runs = s.replace.terminal_returns
+      + s.replace.identity_returns + s.replace.identity_reduces
+      + s.replace.monotonic_scans + s.replace.monotonic_reduces
+      + s.replace.level_moves;
 
     o << indent << bold_on << label << "Replace" << bold_off << total_runs << endl;
 
@@ -768,18 +1210,18 @@ namespace adiar
     }
 
     const uintwide const_runs =
-      internal::stats_replace.terminal_returns + internal::stats_replace.identity_returns;
+      s.replace.terminal_returns + s.replace.identity_returns;
 
     o << indent << bold_on << label << "case O(1)" << bold_off << const_runs << " = "
       << internal::percent_frac(const_runs, total_runs) << percent << endl;
 
     indent_level++;
-    o << indent << label << "terminal" << internal::stats_replace.terminal_returns << " = "
-      << internal::percent_frac(internal::stats_replace.terminal_returns, total_runs) << percent
+    o << indent << label << "terminal" << s.replace.terminal_returns << " = "
+      << internal::percent_frac(s.replace.terminal_returns, total_runs) << percent
       << endl;
 
-    o << indent << label << "identity" << internal::stats_replace.identity_returns << " = "
-      << internal::percent_frac(internal::stats_replace.identity_returns, total_runs) << percent
+    o << indent << label << "identity" << s.replace.identity_returns << " = "
+      << internal::percent_frac(s.replace.identity_returns, total_runs) << percent
       << endl;
     indent_level--;
 
@@ -788,55 +1230,109 @@ namespace adiar
     o << indent << bold_on << label << "case O(N/B)" << bold_off << endl;
 
     indent_level++;
-    o << indent << label << "monotonic" << internal::stats_replace.monotonic_scans << " = "
-      << internal::percent_frac(internal::stats_replace.monotonic_scans, total_runs) << percent
+    o << indent << label << "monotonic" << s.replace.monotonic_scans << " = "
+      << internal::percent_frac(s.replace.monotonic_scans, total_runs) << percent
       << endl;
     indent_level--;
 
     o << indent << endl;
 
     const uintwide reduce_runs =
-      internal::stats_replace.identity_reduces + internal::stats_replace.monotonic_reduces;
+      s.replace.identity_reduces + s.replace.monotonic_reduces;
 
     o << indent << bold_on << label << "case O(sort(N))" << bold_off << reduce_runs << " = "
       << internal::percent_frac(reduce_runs, total_runs) << percent << endl;
 
     indent_level++;
-    o << indent << label << "identity" << internal::stats_replace.identity_reduces << " = "
-      << internal::percent_frac(internal::stats_replace.identity_reduces, total_runs) << percent
+    o << indent << label << "identity" << s.replace.identity_reduces << " = "
+      << internal::percent_frac(s.replace.identity_reduces, total_runs) << percent
       << endl;
 
-    o << indent << label << "monotonic" << internal::stats_replace.monotonic_reduces << " = "
-      << internal::percent_frac(internal::stats_replace.monotonic_reduces, total_runs) << percent
+    o << indent << label << "monotonic" << s.replace.monotonic_reduces << " = "
+      << internal::percent_frac(s.replace.monotonic_reduces, total_runs) << percent
       << endl;
     indent_level--;
 
     o << indent << endl;
 
-    o << indent << bold_on << label << "case O(N sort(T))" << bold_off << endl;
+    o << indent << bold_on << label << "case O(L sort(N))" << bold_off << endl;
 
     indent_level++;
-    o << indent << label << "non-monotonic" << internal::stats_replace.nested_sweeps << " = "
-      << internal::percent_frac(internal::stats_replace.nested_sweeps, total_runs) << percent
+    o << indent << label << "non-monotonic" << s.replace.level_moves << " = "
+      << internal::percent_frac(s.replace.level_moves, total_runs) << percent
       << endl;
+
+    indent_level++;
+    o << indent << label << "levels jumped" << s.replace.level_jumps << endl;
+    indent_level--;
+    indent_level--;
+
+    indent_level--;
+  }
+
+  void
+  __printstat_reorder(std::ostream& o, const statistics& s)
+  {
+    const uintwide total_runs = s.reorder.sifting + s.reorder.window;
+    o << indent << bold_on << label << "Variable Reordering" << bold_off << total_runs << endl;
+
+    indent_level++;
+    if (total_runs == 0u) {
+      o << indent << "Not used" << endl;
+      indent_level--;
+      return;
+    }
+
+    o << indent << bold_on << label << "heuristic" << bold_off << endl;
+
+    indent_level++;
+    o << indent << label << "sifting" << s.reorder.sifting << " = "
+      << internal::percent_frac(s.reorder.sifting, total_runs) << percent << endl;
+    o << indent << label << "window" << s.reorder.window << " = "
+      << internal::percent_frac(s.reorder.window, total_runs) << percent << endl;
     indent_level--;
 
+    o << indent << endl;
+    o << indent << label << "swaps" << s.reorder.swaps << endl;
+    o << indent << label << "skipped swaps" << s.reorder.skipped_swaps << endl;
+    o << indent << label << "reduced swaps" << s.reorder.reduced_swaps << endl;
+
     indent_level--;
   }
 
   void
-  __printstat_nested_sweeping(std::ostream& o)
+  __printstat_small(std::ostream& o, const statistics& s)
+  {
+    const uintwide total_runs = s.small.runs;
+    o << indent << bold_on << label << "Small Decision Diagrams" << bold_off << total_runs << endl;
+
+    indent_level++;
+    if (total_runs == 0u) {
+      o << indent << "Not used" << endl;
+      indent_level--;
+      return;
+    }
+
+    o << indent << label << "aborted" << s.small.aborted << " = "
+      << internal::percent_frac(s.small.aborted, total_runs) << percent << endl;
+    o << indent << label << "nodes created" << s.small.nodes << endl;
+
+    indent_level--;
+  }
+
+  void
+  __printstat_nested_sweeping(std::ostream& o, const statistics& s)
   {
     const uintwide total_runs =
-      internal::nested_sweeping::stats.skips + internal::nested_sweeping::stats.runs;
+      s.nested_sweeping.skips + s.nested_sweeping.runs;
 
     if (total_runs == 0u) {
       o << indent << "Not used" << endl;
       return;
     }
 
-    o << indent << label << "skips" << internal::nested_sweeping::stats.skips << endl
-      << indent << label << "runs" << internal::nested_sweeping::stats.runs << endl;
+    o << indent << label << "skips" << s.nested_sweeping.skips << endl
+      << indent << label << "runs" << s.nested_sweeping.runs << endl;
 
     o << indent << endl;
 
@@ -845,62 +1341,62 @@ namespace adiar
 
       indent_level++;
 
-      const uintwide total_nested = internal::nested_sweeping::stats.outer_up.nested_levels
-        + internal::nested_sweeping::stats.outer_up.skipped_nested_levels;
+      const uintwide total_nested = s.nested_sweeping.outer_up.nested_levels
+        + s.nested_sweeping.outer_up.skipped_nested_levels;
 
       o << indent << bold_on << label << "nested levels" << bold_off << total_nested << endl;
 
       indent_level++;
-      o << indent << label << "executed" << internal::nested_sweeping::stats.outer_up.nested_levels
+      o << indent << label << "executed" << s.nested_sweeping.outer_up.nested_levels
         << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.outer_up.nested_levels,
+        << internal::percent_frac(s.nested_sweeping.outer_up.nested_levels,
                                   total_nested)
         << percent << endl;
 
       const uintwide unpruned_skipped =
-        internal::nested_sweeping::stats.outer_up.skipped_nested_levels
-        - internal::nested_sweeping::stats.outer_up.skipped_nested_levels__prune;
+        s.nested_sweeping.outer_up.skipped_nested_levels
+        - s.nested_sweeping.outer_up.skipped_nested_levels__prune;
 
       o << indent << label << "skipped (non-pruning)" << unpruned_skipped << " = "
         << internal::percent_frac(unpruned_skipped, total_nested) << percent << endl;
 
       o << indent << label << "skipped (pruning)"
-        << internal::nested_sweeping::stats.outer_up.skipped_nested_levels__prune << " = "
+        << s.nested_sweeping.outer_up.skipped_nested_levels__prune << " = "
         << internal::percent_frac(
-             internal::nested_sweeping::stats.outer_up.skipped_nested_levels__prune, total_nested)
+             s.nested_sweeping.outer_up.skipped_nested_levels__prune, total_nested)
         << percent << endl;
 
       indent_level--;
 
       o << indent << endl;
       o << indent << bold_on << label << "collapse to terminal" << bold_off
-        << internal::nested_sweeping::stats.outer_up.collapse_to_terminal << endl;
+        << s.nested_sweeping.outer_up.collapse_to_terminal << endl;
 
       o << indent << endl;
 
       o << indent << bold_on << label << "reduced levels" << bold_off
-        << internal::nested_sweeping::stats.outer_up.reduced_levels << endl;
+        << s.nested_sweeping.outer_up.reduced_levels << endl;
 
       indent_level++;
 
-      const uintwide canonical_levels = internal::nested_sweeping::stats.outer_up.reduced_levels
-        - internal::nested_sweeping::stats.outer_up.reduced_levels__fast;
+      const uintwide canonical_levels = s.nested_sweeping.outer_up.reduced_levels
+        - s.nested_sweeping.outer_up.reduced_levels__fast;
 
       o << indent << label << "canonical" << canonical_levels << " = "
         << internal::percent_frac(canonical_levels,
-                                  internal::nested_sweeping::stats.outer_up.reduced_levels)
+                                  s.nested_sweeping.outer_up.reduced_levels)
         << percent << endl;
 
       o << indent << label << "fast"
-        << internal::nested_sweeping::stats.outer_up.reduced_levels__fast << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.outer_up.reduced_levels__fast,
-                                  internal::nested_sweeping::stats.outer_up.reduced_levels)
+        << s.nested_sweeping.outer_up.reduced_levels__fast << " = "
+        << internal::percent_frac(s.nested_sweeping.outer_up.reduced_levels__fast,
+                                  s.nested_sweeping.outer_up.reduced_levels)
         << percent << endl;
       indent_level--;
 
       o << indent << endl;
 
-      __printstat_reduce(o, internal::nested_sweeping::stats.outer_up);
+      __printstat_reduce(o, s.nested_sweeping.outer_up);
 
       indent_level--;
     }
@@ -908,20 +1404,20 @@ namespace adiar
     o << indent << endl;
 
     {
-      const uintwide total_sweeps = internal::nested_sweeping::stats.inner_down.ra_runs
-        + internal::nested_sweeping::stats.inner_down.pq_runs;
+      const uintwide total_sweeps = s.nested_sweeping.inner_down.ra_runs
+        + s.nested_sweeping.inner_down.pq_runs;
 
       o << indent << bold_on << label << "inner down sweep" << bold_off << total_sweeps << endl;
       indent_level++;
 
       o << indent << bold_on << label << "case [random access]" << bold_off
-        << internal::nested_sweeping::stats.inner_down.ra_runs << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_down.ra_runs, total_sweeps)
+        << s.nested_sweeping.inner_down.ra_runs << " = "
+        << internal::percent_frac(s.nested_sweeping.inner_down.ra_runs, total_sweeps)
         << percent << endl;
 
       o << indent << bold_on << label << "case [priority queues]" << bold_off
-        << internal::nested_sweeping::stats.inner_down.pq_runs << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_down.pq_runs, total_sweeps)
+        << s.nested_sweeping.inner_down.pq_runs << " = "
+        << internal::percent_frac(s.nested_sweeping.inner_down.pq_runs, total_sweeps)
         << percent << endl;
 
       o << indent << endl;
@@ -934,84 +1430,84 @@ namespace adiar
 
       indent_level++;
       o << indent << label << "accumulated"
-        << internal::nested_sweeping::stats.inner_down.inputs.acc_size << endl;
+        << s.nested_sweeping.inner_down.inputs.acc_size << endl;
       o << indent << label << "maximum"
-        << internal::nested_sweeping::stats.inner_down.inputs.max_size << endl;
+        << s.nested_sweeping.inner_down.inputs.max_size << endl;
       indent_level--;
 
       o << indent << "width" << endl;
 
       indent_level++;
       o << indent << label << "accumulated"
-        << internal::nested_sweeping::stats.inner_down.inputs.acc_width << endl;
+        << s.nested_sweeping.inner_down.inputs.acc_width << endl;
       o << indent << label << "maximum"
-        << internal::nested_sweeping::stats.inner_down.inputs.max_width << endl;
+        << s.nested_sweeping.inner_down.inputs.max_width << endl;
       indent_level--;
 
       o << indent << "levels" << endl;
 
       indent_level++;
       o << indent << label << "accumulated"
-        << internal::nested_sweeping::stats.inner_down.inputs.acc_levels << endl;
+        << s.nested_sweeping.inner_down.inputs.acc_levels << endl;
       o << indent << label << "maximum"
-        << internal::nested_sweeping::stats.inner_down.inputs.max_levels << endl;
+        << s.nested_sweeping.inner_down.inputs.max_levels << endl;
       indent_level--;
 
       indent_level--;
 
       o << indent << endl;
 
-      const uintwide total_arcs = internal::nested_sweeping::stats.inner_up.outer_arcs
-        + internal::nested_sweeping::stats.inner_up.inner_arcs;
+      const uintwide total_arcs = s.nested_sweeping.inner_up.outer_arcs
+        + s.nested_sweeping.inner_up.inner_arcs;
 
       o << indent << bold_on << label << "output origin (arcs)" << bold_off << total_arcs << endl;
 
       indent_level++;
 
-      o << indent << label << "outer sweep" << internal::nested_sweeping::stats.inner_up.outer_arcs
+      o << indent << label << "outer sweep" << s.nested_sweeping.inner_up.outer_arcs
         << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_up.outer_arcs, total_arcs)
+        << internal::percent_frac(s.nested_sweeping.inner_up.outer_arcs, total_arcs)
         << percent << endl;
 
-      o << indent << label << "inner sweep" << internal::nested_sweeping::stats.inner_up.inner_arcs
+      o << indent << label << "inner sweep" << s.nested_sweeping.inner_up.inner_arcs
         << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_up.inner_arcs, total_arcs)
+        << internal::percent_frac(s.nested_sweeping.inner_up.inner_arcs, total_arcs)
         << percent << endl;
 
       indent_level--;
 
       o << indent << endl;
 
-      const uintwide total_requests = internal::nested_sweeping::stats.inner_down.requests.terminals
-        + internal::nested_sweeping::stats.inner_down.requests.preserving
-        + internal::nested_sweeping::stats.inner_down.requests.modifying;
+      const uintwide total_requests = s.nested_sweeping.inner_down.requests.terminals
+        + s.nested_sweeping.inner_down.requests.preserving
+        + s.nested_sweeping.inner_down.requests.modifying;
 
       o << indent << bold_on << label << "root requests" << bold_off << total_requests << endl;
 
       indent_level++;
       o << indent << label << "reduce rule 1"
-        << internal::nested_sweeping::stats.inner_down.removed_by_rule_1 << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_down.removed_by_rule_1,
+        << s.nested_sweeping.inner_down.removed_by_rule_1 << " = "
+        << internal::percent_frac(s.nested_sweeping.inner_down.removed_by_rule_1,
                                   total_requests)
         << percent << endl;
 
       o << indent << endl;
 
       o << indent << label << "terminals"
-        << internal::nested_sweeping::stats.inner_down.requests.terminals << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_down.requests.terminals,
+        << s.nested_sweeping.inner_down.requests.terminals << " = "
+        << internal::percent_frac(s.nested_sweeping.inner_down.requests.terminals,
                                   total_requests)
         << percent << endl;
 
       o << indent << label << "modifying"
-        << internal::nested_sweeping::stats.inner_down.requests.modifying << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_down.requests.modifying,
+        << s.nested_sweeping.inner_down.requests.modifying << " = "
+        << internal::percent_frac(s.nested_sweeping.inner_down.requests.modifying,
                                   total_requests)
         << percent << endl;
 
       o << indent << label << "preserving"
-        << internal::nested_sweeping::stats.inner_down.requests.preserving << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_down.requests.preserving,
+        << s.nested_sweeping.inner_down.requests.preserving << " = "
+        << internal::percent_frac(s.nested_sweeping.inner_down.requests.preserving,
                                   total_requests)
         << percent << endl;
 
@@ -1026,29 +1522,29 @@ namespace adiar
       indent_level++;
 
       o << indent << bold_on << label << "reduced levels" << bold_off
-        << internal::nested_sweeping::stats.inner_up.reduced_levels << endl;
+        << s.nested_sweeping.inner_up.reduced_levels << endl;
 
       indent_level++;
 
-      const uintwide canonical_levels = internal::nested_sweeping::stats.inner_up.reduced_levels
-        - internal::nested_sweeping::stats.inner_up.reduced_levels__fast;
+      const uintwide canonical_levels = s.nested_sweeping.inner_up.reduced_levels
+        - s.nested_sweeping.inner_up.reduced_levels__fast;
 
       o << indent << label << "canonical" << canonical_levels << " = "
         << internal::percent_frac(canonical_levels,
-                                  internal::nested_sweeping::stats.inner_up.reduced_levels)
+                                  s.nested_sweeping.inner_up.reduced_levels)
         << percent << endl;
 
       o << indent << label << "fast"
-        << internal::nested_sweeping::stats.inner_up.reduced_levels__fast << " = "
-        << internal::percent_frac(internal::nested_sweeping::stats.inner_up.reduced_levels__fast,
-                                  internal::nested_sweeping::stats.inner_up.reduced_levels)
+        << s.nested_sweeping.inner_up.reduced_levels__fast << " = "
+        << internal::percent_frac(s.nested_sweeping.inner_up.reduced_levels__fast,
+                                  s.nested_sweeping.inner_up.reduced_levels)
         << percent << endl;
 
       indent_level--;
 
       o << indent << endl;
 
-      __printstat_reduce(o, internal::nested_sweeping::stats.inner_up);
+      __printstat_reduce(o, s.nested_sweeping.inner_up);
 
       indent_level--;
     }
@@ -1062,66 +1558,82 @@ namespace adiar
 #ifndef ADIAR_STATS
     o << indent << "Not gathered; please compile with 'ADIAR_STATS'." << endl;
 #else
+    const statistics s = statistics_get();
+
     o << std::fixed << std::setprecision(FLOAT_PRECISION);
 
     o << bold_on << "--== I/O ==--" << bold_off << endl << endl;
 
-    __printstat_arc_file(o);
+    __printstat_arc_file(o, s);
     o << endl;
 
-    __printstat_node_file(o);
+    __printstat_node_file(o, s);
     o << endl;
 
     o << bold_on << "--== Data Structures ==--" << bold_off << endl << endl;
 
-    __printstat_lpq(o, internal::stats_levelized_priority_queue);
+    __printstat_lpq(o, s.levelized_priority_queue);
+    o << endl;
+
+    __printstat_result_cache(o, s);
     o << endl;
 
     o << bold_on << "--== Nested Sweeping Framework ==--" << bold_off << endl << endl;
 
-    __printstat_nested_sweeping(o);
+    __printstat_nested_sweeping(o, s);
     o << endl;
 
     o << bold_on << "--== Top-Down Sweep Algorithms ==--" << bold_off << endl << endl;
 
-    __printstat_count(o);
+    __printstat_count(o, s);
     o << endl;
 
-    __printstat_comparison_check(o);
+    __printstat_comparison_check(o, s);
     o << endl;
 
-    __printstat_intercut(o);
+    __printstat_intercut(o, s);
     o << endl;
 
-    __printstat_isomorphism(o);
+    __printstat_isomorphism(o, s);
     o << endl;
 
-    __printstat_optmin(o);
+    __printstat_optmin(o, s);
     o << endl;
 
-    __printstat_prod2b(o);
+    __printstat_prod2b(o, s);
     o << endl;
 
-    __printstat_prod2u(o);
+    __printstat_prod2u(o, s);
     o << endl;
 
-    __printstat_prod3(o);
+    __printstat_prodn(o, s);
     o << endl;
 
-    __printstat_select(o);
+    __printstat_prod3(o, s);
+    o << endl;
+
+    __printstat_select(o, s);
     o << endl;
 
     o << bold_on << "--== Bottom-Up Sweep Algorithms ==--" << bold_off << endl << endl;
 
-    __printstat_reduce(o);
+    __printstat_reduce(o, s.reduce);
     o << endl;
 
     o << bold_on << "--== Mixed Sweep Algorithms ==--" << bold_off << endl << endl;
 
-    __printstat_quantify(o);
+    __printstat_quantify(o, s);
+    o << endl;
+
+    __printstat_replace(o, s);
     o << endl;
 
-    __printstat_replace(o);
+    __printstat_reorder(o, s);
+    o << endl;
+
+    o << bold_on << "--== In-Memory Algorithms ==--" << bold_off << endl << endl;
+
+    __printstat_small(o, s);
 #endif
   }
 }
@@ -9,6 +9,11 @@
 /// \pre   Statistics are by default **not** gathered due to a concern of the performance of Adiar.
 ///        That is, the logic related to updating the statistics is only run when the `ADIAR_STATS`
 ///        CMake variable is set to `ON`.
+///
+/// \remark Statistics are gathered per thread. When a thread exits, its statistics are added to the
+///         ones of all prior exited threads. That is, `statistics_get`, `statistics_print`, and
+///         `statistics_reset` concern the operations run on the calling thread and on all threads
+///         that have exited.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <cstddef>
@@ -63,6 +68,11 @@ namespace adiar
       /// \brief Number of times out-of-order terminal arcs are sorted.
       //////////////////////////////////////////////////////////////////////////////////////////////
       uintwide sort_out_of_order = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Time (in nanoseconds) spent waiting for arcs to be written in the background.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide write_stall = 0;
     }
     /// \copydoc arc_file_t
     arc_file;
@@ -81,6 +91,11 @@ namespace adiar
       /// \brief Number of level informations written.
       //////////////////////////////////////////////////////////////////////////////////////////////
       uintwide push_level = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Time (in nanoseconds) spent waiting for nodes to be written in the background.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide write_stall = 0;
     }
     /// \copydoc node_file_t
     node_file;
@@ -132,10 +147,55 @@ namespace adiar
       ///        queues that have reported their statistics.
       //////////////////////////////////////////////////////////////////////////////////////////////
       size_t sum_destructors = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of levelized priority queues with a helper thread that sorts the next
+      ///        bucket while the current level is processed.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide sort_ahead = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Memory (in bytes) taken from the buckets' share for the helper thread to merge
+      ///        with.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide sort_ahead_memory = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of elements that have been sorted by the helper thread.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide sort_ahead_elements = 0;
     }
     /// \copydoc levelized_priority_queue_t
     levelized_priority_queue;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Result Cache statistics.
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct result_cache_t
+    {
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of operations whose result was already in the cache.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide hits = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of operations whose result had to be computed.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide misses = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of entries removed to make space for a new one.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide evictions = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of entries removed since an operand or the result was garbage collected.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide expired = 0;
+    }
+    /// \copydoc result_cache_t
+    result_cache;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Algorithms
 
@@ -164,13 +224,19 @@ namespace adiar
         ////////////////////////////////////////////////////////////////////////////////////////////
         uintwide external = 0;
 
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        /// \brief Number of *bucketed adaptive* levelized priority queues, i.e. ones that start
+        ///        out in internal memory and only move to external memory if need be.
+        ////////////////////////////////////////////////////////////////////////////////////////////
+        uintwide adaptive = 0;
+
         ////////////////////////////////////////////////////////////////////////////////////////////
         /// \brief Total number of levelized priority queues.
         ////////////////////////////////////////////////////////////////////////////////////////////
         uintwide
         total() const
         {
-          return unbucketed + internal + external;
+          return unbucketed + internal + external + adaptive;
         }
       }
       /// \copydoc __lpq_t
@@ -273,6 +339,11 @@ namespace adiar
       //////////////////////////////////////////////////////////////////////////////////////////////
       uintwide exit_on_terminalcount = 0;
 
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Early *O(1)* termination due to mismatch in the fingerprint of canonical diagrams.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide exit_on_fingerprint = 0;
+
       //////////////////////////////////////////////////////////////////////////////////////////////
       /// \brief Early *O(L)* termination due to per-level meta information does not match.
       //////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,6 +450,11 @@ namespace adiar
       /// \brief Statistics for the double priority queue algorithmic variant.
       //////////////////////////////////////////////////////////////////////////////////////////////
       __pq2_base pq;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of unreduced inputs that were piped in rather than being reduced first.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide piped_inputs = 0;
     }
     /// \copydoc prod2b_t
     prod2b;
@@ -413,6 +489,32 @@ namespace adiar
     /// \copydoc prod2u_t
     prod2u;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief N-ary Product Construction algorithm statistics.
+    ///
+    /// \see bdd_and bdd_or bdd_apply
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct prodn_t : public __alg_base
+    {
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of sweeps of arity 3 and 4.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide sweeps[2] = { 0, 0 };
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of products instead delegated to the 2-ary product construction, e.g. due
+      ///        to memory constraints or a terminal input.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide binary = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of runs stopped early due to reaching a shortcutting terminal.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide shortcut = 0;
+    }
+    /// \copydoc prodn_t
+    prodn;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief 3-ary Product Construction algorithm statistics.
     ///
@@ -543,6 +645,16 @@ namespace adiar
       ///        nodes that have been removed.
       //////////////////////////////////////////////////////////////////////////////////////////////
       uintwide removed_by_rule_2 = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of levels, where reduction rule 2 was applied by sorting the nodes.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide levels_sorted = 0;
+
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of levels, where reduction rule 2 was applied with a hash table.
+      //////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide levels_hashed = 0;
     }
     /// \copydoc reduce_t
     reduce;
@@ -550,6 +662,42 @@ namespace adiar
     ////////////////////////////////////////////////////////////////////////////////////////////////
     // Algorithms: Other
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief Variable reordering statistics.
+    ///
+    /// \see bdd_reorder
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct reorder_t
+    {
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of runs of the sifting heuristic.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide sifting = 0;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of runs of the window permutation heuristic.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide window = 0;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of linear sweeps swapping two adjacent levels.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide swaps = 0;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of swaps not done due to the levels being too wide for internal memory.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide skipped_swaps = 0;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of swaps made canonical with Reduce, since the identifiers of the nodes
+      ///        above the swapped levels did not fit into internal memory.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide reduced_swaps = 0;
+    }
+    /// \copydoc reorder_t
+    reorder;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief Variable replacement statistics.
     ///
@@ -589,14 +737,44 @@ namespace adiar
       uintwide monotonic_reduces = 0;
 
       ////////////////////////////////////////////////////////////////////////////////////////////
-      /// \brief Number of runs where replacement uses the Nested Sweeping framework to handle
-      ///        non-monotonic replacements.
+      /// \brief Number of runs where a non-monotonic replacement is resolved by moving levels with
+      ///        adjacent swaps and jumps, followed by a 2N/B linear copy-paste.
       ////////////////////////////////////////////////////////////////////////////////////////////
-      uintwide nested_sweeps = 0;
+      uintwide level_moves = 0;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of levels moved with a single O(sort(N)) jump rather than adjacent swaps.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide level_jumps = 0;
     }
     /// \copydoc replace_t
     replace;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \brief In-memory algorithms for small decision diagrams statistics.
+    ///
+    /// \see exec_policy::small_threshold
+    ////////////////////////////////////////////////////////////////////////////////////////////////
+    struct small_t
+    {
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of operations computed in internal memory.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide runs = 0;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Number of operations aborted due to the result growing too large.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide aborted = 0;
+
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      /// \brief Total number of nodes created in the unique tables.
+      ////////////////////////////////////////////////////////////////////////////////////////////
+      uintwide nodes = 0;
+    }
+    /// \copydoc small_t
+    small;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////
     /// \brief    Nested Sweeping statistics.
     ///
@@ -765,7 +943,7 @@ namespace adiar
   };
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  /// \brief Obtain a copy of all statistics gathered.
+  /// \brief Obtain a copy of all statistics gathered (by the calling thread and exited threads).
   ///
   /// \copydoc statistics
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -773,7 +951,8 @@ namespace adiar
   statistics_get();
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  /// \brief Print statistics to an output stream (default `std::cout`).
+  /// \brief Print statistics (of the calling thread and exited threads) to an output stream
+  ///        (default `std::cout`).
   ///
   /// \copydoc statistics
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -781,7 +960,7 @@ namespace adiar
   statistics_print(std::ostream& o = std::cout);
 
   //////////////////////////////////////////////////////////////////////////////////////////////////
-  /// \brief Resets all statistics to default value.
+  /// \brief Resets all statistics (of the calling thread and exited threads) to default value.
   ///
   /// \see statistics
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,9 @@ namespace adiar
 
   template <typename A>
   inline constexpr bool is_void = std::is_void<A>::value;
+
+  template <typename A>
+  inline constexpr bool is_pointer = std::is_pointer<A>::value;
 }
 
 #endif // ADIAR_TYPE_TRAITS_H
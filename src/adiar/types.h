@@ -34,7 +34,7 @@ namespace adiar
     Auto = -1,
 
     /** Any variable remapping without any guarantees on `m`. */
-    Non_Monotone = 8, // TODO
+    Non_Monotone = 8,
 
     /* (Combination of 'Jump_Up' and 'Jump_Down'): Variable remapping which only swaps one pair of
                                                    variables in separate blocks.
@@ -68,6 +68,26 @@ namespace adiar
     Identity = 0
   };
 
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief Heuristics to search for a better variable ordering.
+  ///
+  /// \details Each heuristic is built on top of swapping two adjacent levels, where each swap is a
+  ///          single linear sweep through the diagram.
+  ///
+  /// \see bdd_reorder
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  enum class reorder_type : signed char
+  {
+    /** Move each variable, one at a time, through all levels and keep its best position. */
+    Sifting = 0,
+
+    /** Try all permutations of each two adjacent levels until no further improvement is found. */
+    Window_2 = 2,
+
+    /** Try all permutations of each three adjacent levels until no further improvement is found. */
+    Window_3 = 3
+  };
+
   //////////////////////////////////////////////////////////////////////////////////////////////////
   /// \brief A pair of values.
   //////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1757,6 +1757,45 @@ namespace adiar
 
   /// \}
   //////////////////////////////////////////////////////////////////////////////////////////////////
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \addtogroup module__zdd Files
+  ///
+  /// \{
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Save a ZDD to disk, such that it can be loaded again with `zdd_load`.
+  ///
+  /// \details The ZDD is stored as a single file at `path`. It starts with a versioned header
+  ///          with the configuration of Adiar, the ZDD's levels, cuts, terminal counts, and
+  ///          whether it is canonical. This is followed by its nodes. Everything is stored in
+  ///          little-endian byte order.
+  ///
+  /// \param path Path of the file to create.
+  ///
+  /// \throws runtime_error If a file at the given path already exists.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  void
+  zdd_save(const zdd& A, const std::string& path);
+
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  /// \brief   Load a ZDD previously saved with `zdd_save`.
+  ///
+  /// \details The file's header is validated before it is used. If possible, the file is then
+  ///          memory-mapped and its nodes are read in-place rather than being copied. Hence, the
+  ///          file must neither be changed nor removed while the loaded ZDD (or any ZDD that
+  ///          shares its nodes) is in use.
+  ///
+  /// \param path Path given to `zdd_save`.
+  ///
+  /// \throws runtime_error If the file is missing or was saved with an incompatible version or
+  ///                       configuration of Adiar, e.g. a different number of level bits.
+  //////////////////////////////////////////////////////////////////////////////////////////////////
+  zdd
+  zdd_load(const std::string& path);
+
+  /// \}
+  //////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 #endif // ADIAR_ZDD_H
@@ -64,6 +64,8 @@ namespace adiar
 
   public:
     static constexpr bool quantify_onset = false;
+
+    static constexpr bool idempotent = true;
   };
 
   //////////////////////////////////////////////////////////////////////////////
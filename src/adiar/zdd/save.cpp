@@ -0,0 +1,18 @@
+#include <adiar/zdd.h>
+
+#include <adiar/internal/dd_func.h>
+
+namespace adiar
+{
+  void
+  zdd_save(const zdd& A, const std::string& path)
+  {
+    internal::dd_save<zdd>(A, path);
+  }
+
+  zdd
+  zdd_load(const std::string& path)
+  {
+    return internal::dd_load<zdd>(path);
+  }
+}
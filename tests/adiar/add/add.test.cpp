@@ -0,0 +1,159 @@
+#include "../../test.h"
+
+go_bandit([]() {
+  describe("adiar/add.h", []() {
+    const add::pointer_type terminal_0  = add::pointer_type::numeric_terminal(0u);
+    const add::pointer_type terminal_3  = add::pointer_type::numeric_terminal(3u);
+    const add::pointer_type terminal_7  = add::pointer_type::numeric_terminal(7u);
+    const add::pointer_type terminal_42 = add::pointer_type::numeric_terminal(42u);
+
+    shared_levelized_file<add::node_type> nf;
+    /*
+    //            1       ---- x0
+    //           / \
+    //           2  \     ---- x1
+    //          / \  \
+    //          3 7  42
+    */
+    {
+      node_ofstream nw(nf);
+      nw << node(1, node::max_id, terminal_3, terminal_7)
+         << node(0, node::max_id, node::pointer_type(1, node::max_id), terminal_42);
+    }
+
+    describe("add_const(v)", [&]() {
+      it("creates a terminal with value 42", [&]() {
+        const add res = add_const(42u);
+        node_test_ifstream ns(res);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(),
+                   Is().EqualTo(node(node::uid_type(terminal_42),
+                                     node::pointer_type::nil(),
+                                     node::pointer_type::nil())));
+        AssertThat(ns.can_pull(), Is().False());
+
+        AssertThat(add_isconst(res), Is().True());
+        AssertThat(add_valueof(res), Is().EqualTo(42u));
+      });
+
+      it("counts 42 as a numeric terminal rather than as the 'true' terminal", [&]() {
+        const add res = add_const(42u);
+
+        AssertThat(res->number_of_terminals[false], Is().EqualTo(0u));
+        AssertThat(res->number_of_terminals[true], Is().EqualTo(1u));
+        AssertThat(res->number_of_numeric_terminals, Is().EqualTo(1u));
+
+        AssertThat(res->is_terminal(), Is().True());
+        AssertThat(res->is_true(), Is().False());
+        AssertThat(res->is_false(), Is().False());
+      });
+
+      it("creates the same terminal as 'bdd_true()' for 1", [&]() {
+        const add res = add_const(1u);
+
+        AssertThat(res->number_of_numeric_terminals, Is().EqualTo(0u));
+        AssertThat(res->is_true(), Is().True());
+      });
+
+      it("creates the same terminal as 'bdd_false()' for 0", [&]() {
+        const add res = add_const(0u);
+        node_test_ifstream ns(res);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(), Is().EqualTo(node(false)));
+        AssertThat(ns.can_pull(), Is().False());
+      });
+
+      it("is used for default construction", [&]() {
+        const add res;
+        AssertThat(add_valueof(res), Is().EqualTo(0u));
+      });
+
+      it("is used for implicit conversion from a value", [&]() {
+        const add res = 7u;
+        AssertThat(add_valueof(res), Is().EqualTo(7u));
+      });
+    });
+
+    describe("add_ithvar(x)", [&]() {
+      it("creates the node (x, 0, 1)", [&]() {
+        const add res = add_ithvar(2);
+        node_test_ifstream ns(res);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(), Is().EqualTo(node(2, node::max_id, terminal_0,
+                                                add::pointer_type::numeric_terminal(1u))));
+        AssertThat(ns.can_pull(), Is().False());
+      });
+    });
+
+    describe("add_valueof(f)", [&]() {
+      it("throws exception for non-constant ADD",
+         [&]() { AssertThrows(invalid_argument, add_valueof(add(nf))); });
+    });
+
+    describe("add_nodecount(f), add_varcount(f)", [&]() {
+      it("is 0 for a constant ADD", [&]() {
+        AssertThat(add_nodecount(add_const(42u)), Is().EqualTo(0u));
+        AssertThat(add_varcount(add_const(42u)), Is().EqualTo(0u));
+      });
+
+      it("counts the nodes and levels of [1]", [&]() {
+        AssertThat(add_nodecount(nf), Is().EqualTo(2u));
+        AssertThat(add_varcount(nf), Is().EqualTo(2u));
+      });
+
+      it("counts the numeric terminals of [1]", [&]() {
+        AssertThat(nf->number_of_terminals[false], Is().EqualTo(0u));
+        AssertThat(nf->number_of_terminals[true], Is().EqualTo(3u));
+        AssertThat(nf->number_of_numeric_terminals, Is().EqualTo(3u));
+      });
+    });
+
+    describe("add_topvar(f)", [&]() {
+      it("is x0 for [1]", [&]() { AssertThat(add_topvar(nf), Is().EqualTo(0u)); });
+    });
+
+    describe("add_eval(f, af)", [&]() {
+      it("returns the value of a constant ADD", [&]() {
+        AssertThat(add_eval(add_const(3u), [](add::label_type) { return true; }),
+                   Is().EqualTo(3u));
+      });
+
+      it("returns 3 for [1] with x0 = 0, x1 = 0", [&]() {
+        AssertThat(add_eval(nf, [](add::label_type) { return false; }), Is().EqualTo(3u));
+      });
+
+      it("returns 7 for [1] with x0 = 0, x1 = 1", [&]() {
+        AssertThat(add_eval(nf, [](add::label_type x) { return x == 1u; }), Is().EqualTo(7u));
+      });
+
+      it("returns 42 for [1] with x0 = 1", [&]() {
+        AssertThat(add_eval(nf, [](add::label_type x) { return x == 0u; }), Is().EqualTo(42u));
+      });
+    });
+
+    describe("add_equal(f, g)", [&]() {
+      it("accepts the same constant", [&]() {
+        AssertThat(add_const(42u) == add_const(42u), Is().True());
+      });
+
+      it("rejects different constants", [&]() {
+        AssertThat(add_const(42u) == add_const(7u), Is().False());
+        AssertThat(add_const(42u) != add_const(7u), Is().True());
+      });
+
+      it("rejects ADDs that only differ in a terminal value", [&]() {
+        shared_levelized_file<add::node_type> other;
+        {
+          node_ofstream nw(other);
+          nw << node(1, node::max_id, terminal_3, terminal_42)
+             << node(0, node::max_id, node::pointer_type(1, node::max_id), terminal_42);
+        }
+
+        AssertThat(add(nf) == add(other), Is().False());
+      });
+    });
+  });
+});
@@ -0,0 +1,145 @@
+#include "../../test.h"
+
+go_bandit([]() {
+  describe("adiar/add/apply.cpp", []() {
+    const add::pointer_type terminal_1 = add::pointer_type::numeric_terminal(1u);
+    const add::pointer_type terminal_2 = add::pointer_type::numeric_terminal(2u);
+    const add::pointer_type terminal_3 = add::pointer_type::numeric_terminal(3u);
+    const add::pointer_type terminal_5 = add::pointer_type::numeric_terminal(5u);
+
+    shared_levelized_file<add::node_type> nf_x0;
+    /*
+    //            1       ---- x0
+    //           / \
+    //           2 3
+    */
+    {
+      node_ofstream nw(nf_x0);
+      nw << node(0, node::max_id, terminal_2, terminal_3);
+    }
+
+    shared_levelized_file<add::node_type> nf_x1;
+    /*
+    //            1       ---- x1
+    //           / \
+    //           1 5
+    */
+    {
+      node_ofstream nw(nf_x1);
+      nw << node(1, node::max_id, terminal_1, terminal_5);
+    }
+
+    // All four assignments to (x0, x1)
+    const auto eval = [](const add& f, const bool x0, const bool x1) {
+      return add_eval(f, [x0, x1](const add::label_type x) { return x == 0u ? x0 : x1; });
+    };
+
+    describe("add_plus(f, g)", [&]() {
+      it("adds two constants", [&]() {
+        const add res = add_plus(add_const(2u), add_const(40u));
+        AssertThat(add_isconst(res), Is().True());
+        AssertThat(add_valueof(res), Is().EqualTo(42u));
+      });
+
+      it("adds a constant to an ADD", [&]() {
+        const add res = add_plus(nf_x0, add_const(10u));
+
+        AssertThat(add_nodecount(res), Is().EqualTo(1u));
+        AssertThat(eval(res, false, false), Is().EqualTo(12u));
+        AssertThat(eval(res, true, false), Is().EqualTo(13u));
+      });
+
+      it("adds two ADDs on different variables", [&]() {
+        const add res = add_plus(nf_x0, nf_x1);
+
+        AssertThat(add_nodecount(res), Is().EqualTo(3u));
+        AssertThat(eval(res, false, false), Is().EqualTo(3u));
+        AssertThat(eval(res, false, true), Is().EqualTo(7u));
+        AssertThat(eval(res, true, false), Is().EqualTo(4u));
+        AssertThat(eval(res, true, true), Is().EqualTo(8u));
+      });
+
+      it("doubles an ADD added to itself", [&]() {
+        const add f   = nf_x0;
+        const add res = add_plus(f, f);
+
+        AssertThat(eval(res, false, false), Is().EqualTo(4u));
+        AssertThat(eval(res, true, false), Is().EqualTo(6u));
+      });
+    });
+
+    describe("add_times(f, g)", [&]() {
+      it("multiplies two ADDs on different variables", [&]() {
+        const add res = add_times(nf_x0, nf_x1);
+
+        AssertThat(eval(res, false, false), Is().EqualTo(2u));
+        AssertThat(eval(res, false, true), Is().EqualTo(10u));
+        AssertThat(eval(res, true, false), Is().EqualTo(3u));
+        AssertThat(eval(res, true, true), Is().EqualTo(15u));
+      });
+
+      it("collapses to 0 when multiplied with 0", [&]() {
+        const add res = add_times(nf_x0, add_const(0u));
+
+        AssertThat(add_isconst(res), Is().True());
+        AssertThat(add_valueof(res), Is().EqualTo(0u));
+      });
+    });
+
+    describe("add_min(f, g), add_max(f, g)", [&]() {
+      it("computes the minimum of two ADDs", [&]() {
+        const add res = add_min(nf_x0, nf_x1);
+
+        AssertThat(eval(res, false, false), Is().EqualTo(1u));
+        AssertThat(eval(res, false, true), Is().EqualTo(2u));
+        AssertThat(eval(res, true, false), Is().EqualTo(1u));
+        AssertThat(eval(res, true, true), Is().EqualTo(3u));
+      });
+
+      it("computes the maximum of two ADDs", [&]() {
+        const add res = add_max(nf_x0, nf_x1);
+
+        AssertThat(eval(res, false, false), Is().EqualTo(2u));
+        AssertThat(eval(res, false, true), Is().EqualTo(5u));
+        AssertThat(eval(res, true, false), Is().EqualTo(3u));
+        AssertThat(eval(res, true, true), Is().EqualTo(5u));
+      });
+
+      it("reduces nodes with equal children", [&]() {
+        const add res = add_max(nf_x0, add_const(3u));
+
+        AssertThat(add_isconst(res), Is().True());
+        AssertThat(add_valueof(res), Is().EqualTo(3u));
+      });
+    });
+
+    describe("add_apply(f, g, op)", [&]() {
+      it("respects the order of a non-commutative operator", [&]() {
+        const add res = add_apply(nf_x0, nf_x1, [](add::value_type a, add::value_type b) {
+          return 10u * a + b;
+        });
+
+        AssertThat(eval(res, false, false), Is().EqualTo(21u));
+        AssertThat(eval(res, false, true), Is().EqualTo(25u));
+        AssertThat(eval(res, true, false), Is().EqualTo(31u));
+        AssertThat(eval(res, true, true), Is().EqualTo(35u));
+      });
+    });
+
+    describe("add_map(f, op)", [&]() {
+      it("maps every terminal", [&]() {
+        const add res = add_map(nf_x0, [](add::value_type v) { return v * v; });
+
+        AssertThat(eval(res, false, false), Is().EqualTo(4u));
+        AssertThat(eval(res, true, false), Is().EqualTo(9u));
+      });
+
+      it("collapses to a constant if all values are mapped to the same", [&]() {
+        const add res = add_map(nf_x0, [](add::value_type) { return 7u; });
+
+        AssertThat(add_isconst(res), Is().True());
+        AssertThat(add_valueof(res), Is().EqualTo(7u));
+      });
+    });
+  });
+});
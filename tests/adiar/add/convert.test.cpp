@@ -0,0 +1,69 @@
+#include "../../test.h"
+
+go_bandit([]() {
+  describe("adiar/add/convert.cpp", []() {
+    const add::pointer_type terminal_0 = add::pointer_type::numeric_terminal(0u);
+    const add::pointer_type terminal_3 = add::pointer_type::numeric_terminal(3u);
+    const add::pointer_type terminal_7 = add::pointer_type::numeric_terminal(7u);
+
+    describe("add_from(f)", [&]() {
+      it("shares the file of a BDD", [&]() {
+        const bdd f   = bdd_ithvar(0);
+        const add res = add_from(f);
+
+        AssertThat(res.file_ptr(), Is().EqualTo(f.file_ptr()));
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(1u));
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(0u));
+      });
+
+      it("applies the negation of a BDD", [&]() {
+        const bdd f   = bdd_not(bdd_ithvar(0));
+        const add res = add_from(f);
+
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(0u));
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(1u));
+      });
+
+      it("converts the 'true' terminal into 1", [&]() {
+        const add res = add_from(bdd_true());
+        AssertThat(add_valueof(res), Is().EqualTo(1u));
+      });
+    });
+
+    shared_levelized_file<add::node_type> nf;
+    /*
+    //            1       ---- x0
+    //           / \
+    //           2  \     ---- x1
+    //          / \  \
+    //          3 0  7
+    */
+    {
+      node_ofstream nw(nf);
+      nw << node(1, node::max_id, terminal_3, terminal_0)
+         << node(0, node::max_id, node::pointer_type(1, node::max_id), terminal_7);
+    }
+
+    describe("bdd_from(f)", [&]() {
+      it("is the set of non-zero values", [&]() {
+        const bdd res = bdd_from(add(nf));
+
+        AssertThat(bdd_nodecount(res), Is().EqualTo(2u));
+        AssertThat(bdd_eval(res, [](bdd::label_type) { return false; }), Is().True());
+        AssertThat(bdd_eval(res, [](bdd::label_type x) { return x == 1u; }), Is().False());
+        AssertThat(bdd_eval(res, [](bdd::label_type x) { return x == 0u; }), Is().True());
+      });
+
+      it("is the set of values satisfying the predicate", [&]() {
+        const bdd res = bdd_from(add(nf), [](add::value_type v) { return v > 5u; });
+
+        AssertThat(bdd_equal(res, bdd_ithvar(0)), Is().True());
+      });
+
+      it("converts a constant into a terminal", [&]() {
+        AssertThat(bdd_istrue(bdd_from(add_const(42u))), Is().True());
+        AssertThat(bdd_isfalse(bdd_from(add_const(0u))), Is().True());
+      });
+    });
+  });
+});
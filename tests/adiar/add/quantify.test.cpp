@@ -0,0 +1,135 @@
+#include "../../test.h"
+
+go_bandit([]() {
+  describe("adiar/add/quantify.cpp", []() {
+    const add::pointer_type terminal_0 = add::pointer_type::numeric_terminal(0u);
+    const add::pointer_type terminal_2 = add::pointer_type::numeric_terminal(2u);
+    const add::pointer_type terminal_3 = add::pointer_type::numeric_terminal(3u);
+    const add::pointer_type terminal_5 = add::pointer_type::numeric_terminal(5u);
+
+    shared_levelized_file<add::node_type> nf;
+    /*
+    //            1       ---- x0
+    //           / \
+    //           2  3     ---- x1
+    //          / \/ \
+    //          2 0  5
+    */
+    {
+      node_ofstream nw(nf);
+      nw << node(1, node::max_id, terminal_0, terminal_5)
+         << node(1, node::max_id - 1, terminal_2, terminal_0)
+         << node(0, node::max_id, node::pointer_type(1, node::max_id - 1),
+                 node::pointer_type(1, node::max_id));
+    }
+
+    describe("add_exists(f, x)", [&]() {
+      it("sums over x1", [&]() {
+        const add res = add_exists(nf, 1u);
+
+        AssertThat(add_nodecount(res), Is().EqualTo(1u));
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(2u));
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(5u));
+      });
+
+      it("sums over x0", [&]() {
+        const add res = add_exists(nf, 0u);
+
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(2u));
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(5u));
+      });
+
+      it("doubles the function for a variable it does not depend on", [&]() {
+        const add res = add_exists(nf, 2u);
+
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(4u));
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(10u));
+      });
+
+      it("doubles a constant", [&]() {
+        const add res = add_exists(add_const(21u), 0u);
+        AssertThat(add_valueof(res), Is().EqualTo(42u));
+      });
+
+      it("sums over all variables of a generator", [&]() {
+        std::vector<add::label_type> vars = { 1u, 0u };
+        const add res = add_exists(nf, make_generator(vars.begin(), vars.end()));
+
+        AssertThat(add_isconst(res), Is().True());
+        AssertThat(add_valueof(res), Is().EqualTo(7u));
+      });
+
+      it("doubles the function for each variable of a generator it does not depend on", [&]() {
+        std::vector<add::label_type> vars = { 3u, 2u };
+        const add res = add_exists(nf, make_generator(vars.begin(), vars.end()));
+
+        AssertThat(add_nodecount(res), Is().EqualTo(3u));
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(8u));
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(20u));
+      });
+
+      it("sums over variables of a generator with and without nodes", [&]() {
+        std::vector<add::label_type> vars = { 2u, 1u };
+        const add res = add_exists(nf, make_generator(vars.begin(), vars.end()));
+
+        AssertThat(add_nodecount(res), Is().EqualTo(1u));
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(4u));
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(10u));
+      });
+
+      it("multiplies a constant by two for each variable of a generator", [&]() {
+        std::vector<add::label_type> vars = { 2u, 1u, 0u };
+        const add res = add_exists(add_const(3u), make_generator(vars.begin(), vars.end()));
+
+        AssertThat(add_valueof(res), Is().EqualTo(24u));
+      });
+
+      it("sums over a generator as repeated single variables would", [&]() {
+        // (x0 + 3*x2 + 5*x4) * (1 + x3)
+        const add sum = add_plus(add_ithvar(0u),
+                                 add_plus(add_times(add_const(3u), add_ithvar(2u)),
+                                          add_times(add_const(5u), add_ithvar(4u))));
+        const add f   = add_times(sum, add_plus(add_const(1u), add_ithvar(3u)));
+
+        std::vector<add::label_type> vars = { 5u, 3u, 2u, 1u };
+
+        add expected = f;
+        for (const add::label_type x : vars) { expected = add_exists(expected, x); }
+
+        for (const exec_policy ep : { exec_policy(exec_policy::access::Random_Access),
+                                      exec_policy(exec_policy::access::Priority_Queue) }) {
+          const add res = add_exists(ep, f, make_generator(vars.begin(), vars.end()));
+          AssertThat(add_equal(res, expected), Is().True());
+        }
+      });
+
+      it("throws if the generator is not in descending order", [&]() {
+        std::vector<add::label_type> vars = { 0u, 1u };
+        AssertThrows(invalid_argument,
+                     add_exists(nf, make_generator(vars.begin(), vars.end())));
+      });
+    });
+
+    describe("add_maxabstract(f, x)", [&]() {
+      it("takes the maximum over x1", [&]() {
+        const add res = add_maxabstract(nf, 1u);
+
+        AssertThat(add_nodecount(res), Is().EqualTo(1u));
+        AssertThat(add_eval(res, [](add::label_type) { return false; }), Is().EqualTo(2u));
+        AssertThat(add_eval(res, [](add::label_type) { return true; }), Is().EqualTo(5u));
+      });
+
+      it("is the identity for a variable it does not depend on", [&]() {
+        const add res = add_maxabstract(nf, 2u);
+        AssertThat(add_equal(res, nf), Is().True());
+      });
+
+      it("takes the maximum over all variables of a predicate", [&]() {
+        const add res = add_maxabstract(nf, [](add::label_type) { return true; });
+
+        AssertThat(add_isconst(res), Is().True());
+        AssertThat(add_valueof(res), Is().EqualTo(5u));
+      });
+    });
+  });
+});
@@ -0,0 +1,116 @@
+#include "../test.h"
+
+#include <thread>
+
+#include <adiar/internal/parallel.h>
+
+go_bandit([]() {
+  describe("adiar/adiar.h", []() {
+    describe("adiar_thread_init(...), adiar_thread_deinit()", []() {
+      it("throws exception when given 'minimum_memory - 1' memory for a thread",
+         [&]() { AssertThrows(invalid_argument, adiar_thread_init(minimum_memory - 1)); });
+
+      it("throws exception when threads are given more memory than available", [&]() {
+        AssertThrows(invalid_argument, adiar_thread_init(2u * 1024 * 1024 * 1024));
+      });
+
+      it("gives the thread its own partition of the memory", [&]() {
+        size_t partition = 0u;
+
+        std::thread t([&partition]() {
+          adiar_thread_init(256 * 1024 * 1024);
+          partition = internal::thread_memory_partition();
+          adiar_thread_deinit();
+        });
+        t.join();
+
+        AssertThat(partition, Is().EqualTo(256u * 1024 * 1024));
+        AssertThat(internal::thread_memory_partition(), Is().EqualTo(0u));
+      });
+
+      it("charges helper threads to the partition of the thread starting them", [&]() {
+        size_t partition        = 0u;
+        size_t helper_partition = 0u;
+        size_t helper_available = 0u;
+
+        std::thread t([&]() {
+          adiar_thread_init(128 * 1024 * 1024);
+          partition = internal::thread_memory_partition();
+
+          std::thread h = internal::helper_thread([&]() {
+            helper_partition = internal::thread_memory_partition();
+            helper_available = internal::memory_available();
+          });
+          h.join();
+
+          adiar_thread_deinit();
+        });
+        t.join();
+
+        AssertThat(helper_partition, Is().EqualTo(partition));
+        AssertThat(helper_partition, Is().EqualTo(128u * 1024 * 1024));
+        AssertThat(helper_available, Is().LessThanOrEqualTo(128u * 1024 * 1024));
+      });
+
+      it("does not charge helper threads of the main thread to any partition", [&]() {
+        size_t helper_partition = 1u;
+
+        std::thread h = internal::helper_thread(
+          [&]() { helper_partition = internal::thread_memory_partition(); });
+        h.join();
+
+        AssertThat(helper_partition, Is().EqualTo(0u));
+      });
+
+      it("can run operations on multiple threads with their own memory", [&]() {
+        bool results[2] = { false, false };
+
+        const auto work = [&results](const int i) {
+          adiar_thread_init(256 * 1024 * 1024);
+
+          const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(i + 1));
+          results[i]  = bdd_nodecount(f) == 2u && bdd_varcount(f) == 2u;
+
+          adiar_thread_deinit();
+        };
+
+        std::thread t0(work, 0);
+        std::thread t1(work, 1);
+
+        t0.join();
+        t1.join();
+
+        AssertThat(results[0], Is().True());
+        AssertThat(results[1], Is().True());
+      });
+
+      it("can run operations with helper threads on a thread with its own memory", [&]() {
+        bool result = false;
+
+        std::thread t([&result]() {
+          adiar_thread_init(256 * 1024 * 1024);
+
+          const exec_policy ep = exec_policy::threads(4);
+
+          bdd f = bdd_ithvar(0);
+          for (int x = 1; x < 16; ++x) { f = bdd_xor(ep, f, bdd_ithvar(x)); }
+          result = bdd_nodecount(f) == 31u;
+
+          adiar_thread_deinit();
+        });
+        t.join();
+
+        AssertThat(result, Is().True());
+      });
+    });
+
+    describe("adiar_cache_init(...)", []() {
+      it("throws exception when the result cache is given too little memory",
+         [&]() { AssertThrows(invalid_argument, adiar_cache_init(0)); });
+
+      it("throws exception when the result cache is given more memory than available", [&]() {
+        AssertThrows(invalid_argument, adiar_cache_init(2u * 1024 * 1024 * 1024));
+      });
+    });
+  });
+});
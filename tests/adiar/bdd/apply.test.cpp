@@ -2889,6 +2889,315 @@ go_bandit([]() {
       });
     });
 
+    describe("access mode: priority queues [multi-threaded]", [&]() {
+      const exec_policy ep_seq = exec_policy::access::Priority_Queue;
+      const exec_policy ep_par = ep_seq & exec_policy::threads(4);
+
+      // Check the output of the multi-threaded variant is the same as the single-threaded one.
+      const auto assert_same = [](const __bdd& expected, const __bdd& actual) {
+        arc_test_ifstream expected_arcs(expected);
+        arc_test_ifstream actual_arcs(actual);
+
+        while (expected_arcs.can_pull_internal()) {
+          AssertThat(actual_arcs.can_pull_internal(), Is().True());
+          AssertThat(actual_arcs.pull_internal(), Is().EqualTo(expected_arcs.pull_internal()));
+        }
+        AssertThat(actual_arcs.can_pull_internal(), Is().False());
+
+        while (expected_arcs.can_pull_terminal()) {
+          AssertThat(actual_arcs.can_pull_terminal(), Is().True());
+          AssertThat(actual_arcs.pull_terminal(), Is().EqualTo(expected_arcs.pull_terminal()));
+        }
+        AssertThat(actual_arcs.can_pull_terminal(), Is().False());
+
+        level_info_test_ifstream expected_levels(expected);
+        level_info_test_ifstream actual_levels(actual);
+
+        while (expected_levels.can_pull()) {
+          AssertThat(actual_levels.can_pull(), Is().True());
+          AssertThat(actual_levels.pull(), Is().EqualTo(expected_levels.pull()));
+        }
+        AssertThat(actual_levels.can_pull(), Is().False());
+
+        const shared_levelized_file<arc> expected_file =
+          expected.get<__bdd::shared_arc_file_type>();
+        const shared_levelized_file<arc> actual_file = actual.get<__bdd::shared_arc_file_type>();
+
+        AssertThat(actual_file->max_1level_cut, Is().EqualTo(expected_file->max_1level_cut));
+        AssertThat(actual_file->number_of_terminals[false],
+                   Is().EqualTo(expected_file->number_of_terminals[false]));
+        AssertThat(actual_file->number_of_terminals[true],
+                   Is().EqualTo(expected_file->number_of_terminals[true]));
+      };
+
+      it("computes bdd_1 /\\ bdd_2 as single-threaded", [&]() {
+        assert_same(bdd_and(ep_seq, bdd_1, bdd_2), bdd_and(ep_par, bdd_1, bdd_2));
+      });
+
+      it("computes bdd_1 \\/ bdd_2 as single-threaded", [&]() {
+        assert_same(bdd_or(ep_seq, bdd_1, bdd_2), bdd_or(ep_par, bdd_1, bdd_2));
+      });
+
+      it("computes bdd_1 ^ bdd_3 as single-threaded", [&]() {
+        assert_same(bdd_xor(ep_seq, bdd_1, bdd_3), bdd_xor(ep_par, bdd_1, bdd_3));
+      });
+
+      it("computes bdd_wide -> bdd_thin as single-threaded", [&]() {
+        assert_same(bdd_imp(ep_seq, bdd_wide, bdd_thin), bdd_imp(ep_par, bdd_wide, bdd_thin));
+      });
+
+      it("computes x0 /\\ !x0 as single-threaded", [&]() {
+        assert_same(bdd_and(ep_seq, bdd_x0, bdd_not_x0), bdd_and(ep_par, bdd_x0, bdd_not_x0));
+      });
+    });
+
+    describe("chain: pipe", [&]() {
+      const exec_policy ep_pipe = exec_policy::chain::Pipe;
+
+      const bdd f_1    = bdd_1;
+      const bdd f_2    = bdd_2;
+      const bdd f_3    = bdd_3;
+      const bdd f_thin = bdd_thin;
+      const bdd f_wide = bdd_wide;
+
+      it("computes (bdd_1 /\\ bdd_2) \\/ bdd_3 [piped lhs]", [&]() {
+        const bdd expected = bdd(bdd_and(f_1, f_2)) | f_3;
+        const bdd out      = bdd_and(ep_pipe, f_1, f_2) | f_3;
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("computes bdd_3 \\/ (bdd_1 /\\ bdd_2) [piped rhs]", [&]() {
+        const bdd expected = f_3 | bdd(bdd_and(f_1, f_2));
+        const bdd out      = f_3 | bdd_and(ep_pipe, f_1, f_2);
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("computes (bdd_1 ^ bdd_3) /\\ (bdd_wide \\/ bdd_thin) [piped lhs and rhs]", [&]() {
+        const bdd expected = bdd(bdd_xor(f_1, f_3)) & bdd(bdd_or(f_wide, f_thin));
+        const bdd out      = bdd_xor(ep_pipe, f_1, f_3) & bdd_or(ep_pipe, f_wide, f_thin);
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("computes ((bdd_1 /\\ bdd_2) \\/ bdd_3) ^ bdd_thin [piped twice]", [&]() {
+        const bdd expected = bdd(bdd(bdd_and(f_1, f_2)) | f_3) ^ f_thin;
+        const bdd out      = (bdd_and(ep_pipe, f_1, f_2) | f_3) ^ f_thin;
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("computes (x0 /\\ !x0) \\/ x1 [piped unreduced node]", [&]() {
+        const bdd out = bdd_and(ep_pipe, bdd(bdd_x0), bdd(bdd_not_x0)) | bdd(bdd_x1);
+
+        AssertThat(bdd_equal(out, bdd(bdd_x1)), Is().True());
+      });
+
+      it("computes (bdd_1 /\\ bdd_2) /\\ T [terminal rhs]", [&]() {
+        const bdd expected = bdd_and(f_1, f_2);
+        const bdd out      = bdd_and(ep_pipe, f_1, f_2) & bdd(bdd_T);
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("sorts the arcs of a piped result once when it is produced", [&]() {
+        const __bdd f = bdd_and(ep_pipe, f_1, f_2);
+        AssertThat(f.get<__bdd::shared_arc_file_type>()->semi_transposed, Is().False());
+      });
+
+      it("can pipe an unshared result that was not produced to be piped", [&]() {
+        const bdd expected = bdd(bdd_and(f_1, f_2)) | f_3;
+        const bdd out      = bdd_apply(ep_pipe, bdd_and(f_1, f_2), f_3, adiar::or_op);
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("can reduce an unreduced result after it has been piped", [&]() {
+        const __bdd f = bdd_and(ep_pipe, f_1, f_2);
+
+        const bdd out = bdd_apply(__bdd(f), f_3, adiar::or_op);
+        AssertThat(bdd_equal(out, bdd(bdd_and(f_1, f_2)) | f_3), Is().True());
+
+        // The shared arc file is not sorted again by either reader.
+        AssertThat(f.get<__bdd::shared_arc_file_type>()->semi_transposed, Is().False());
+
+        const bdd f_reduced = __bdd(f);
+        AssertThat(bdd_equal(f_reduced, bdd_and(f_1, f_2)), Is().True());
+        AssertThat(f.get<__bdd::shared_arc_file_type>()->semi_transposed, Is().False());
+      });
+
+      it("can reduce a piped result that is not shared", [&]() {
+        const bdd out = bdd_and(ep_pipe, f_1, f_2);
+        AssertThat(bdd_equal(out, bdd_and(f_1, f_2)), Is().True());
+      });
+
+      it("does not pipe with 'chain::Reduce'", [&]() {
+        const exec_policy ep_reduce = exec_policy::chain::Reduce;
+
+        const bdd expected = bdd(bdd_and(f_1, f_2)) | f_3;
+        const bdd out      = bdd_apply(ep_reduce, bdd_and(f_1, f_2), f_3, adiar::or_op);
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+    });
+
+    describe("n-ary product construction", [&]() {
+      const exec_policy ep;
+
+      const std::vector<bdd> xs = { bdd_x0, bdd_x1, bdd_x2 };
+      const std::vector<bdd> fs = { bdd_1, bdd_2, bdd_3, bdd_thin, bdd_wide, bdd_x1 };
+
+      it("returns T for an empty conjunction", [&]() {
+        const std::vector<bdd> empty;
+        AssertThat(bdd_equal(bdd_and(ep, empty.begin(), empty.end()), bdd_top()), Is().True());
+      });
+
+      it("returns F for an empty disjunction", [&]() {
+        const std::vector<bdd> empty;
+        AssertThat(bdd_equal(bdd_or(ep, empty.begin(), empty.end()), bdd_bot()), Is().True());
+      });
+
+      it("throws 'invalid_argument' on an empty range in 'bdd_apply'", [&]() {
+        const std::vector<bdd> empty;
+        AssertThrows(invalid_argument, bdd_apply(empty.begin(), empty.end(), adiar::xor_op));
+      });
+
+      it("returns the only BDD given", [&]() {
+        const std::vector<bdd> single = { bdd_2 };
+        AssertThat(bdd_equal(bdd_and(ep, single.begin(), single.end()), bdd(bdd_2)),
+                   Is().True());
+      });
+
+      it("computes x0 /\\ x1 /\\ x2 in a single sweep", [&]() {
+        const bdd expected = bdd(bdd_and(bdd(bdd_x0), bdd(bdd_x1))) & bdd(bdd_x2);
+        const bdd out      = bdd_and(ep, xs.begin(), xs.end());
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("computes x0 \\/ x1 \\/ x2 in a single sweep", [&]() {
+        const bdd expected = bdd(bdd_or(bdd(bdd_x0), bdd(bdd_x1))) | bdd(bdd_x2);
+        const bdd out      = bdd_or(ep, xs.begin(), xs.end());
+
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("computes the conjunction of many BDDs as a pairwise fold", [&]() {
+        bdd expected = fs[0];
+        for (size_t i = 1u; i < fs.size(); ++i) { expected = expected & fs[i]; }
+
+        AssertThat(bdd_equal(bdd_and(ep, fs.begin(), fs.end()), expected), Is().True());
+        AssertThat(bdd_equal(bdd_and(fs.begin(), fs.end()), expected), Is().True());
+      });
+
+      it("computes the disjunction of many BDDs as a pairwise fold", [&]() {
+        bdd expected = fs[0];
+        for (size_t i = 1u; i < fs.size(); ++i) { expected = expected | fs[i]; }
+
+        AssertThat(bdd_equal(bdd_or(ep, fs.begin(), fs.end()), expected), Is().True());
+      });
+
+      it("accepts pointers into a plain array of BDDs", [&]() {
+        const bdd in[3] = { bdd_1, bdd_2, bdd_3 };
+
+        const bdd expected_and = bdd_and(bdd_and(bdd_1, bdd_2), bdd_3);
+        AssertThat(bdd_equal(bdd_and(ep, in, in + 3), expected_and), Is().True());
+        AssertThat(bdd_equal(bdd_and(std::begin(in), std::end(in)), expected_and), Is().True());
+
+        const bdd expected_or = bdd_or(bdd_or(bdd_1, bdd_2), bdd_3);
+        AssertThat(bdd_equal(bdd_or(ep, in, in + 3), expected_or), Is().True());
+        AssertThat(bdd_equal(bdd_or(std::begin(in), std::end(in)), expected_or), Is().True());
+      });
+
+      it("computes the exclusive-or of many BDDs as a pairwise fold", [&]() {
+        bdd expected = fs[0];
+        for (size_t i = 1u; i < fs.size(); ++i) { expected = expected ^ fs[i]; }
+
+        const bdd out = bdd_apply(fs.begin(), fs.end(), adiar::xor_op);
+        AssertThat(bdd_equal(out, expected), Is().True());
+      });
+
+      it("computes a non-associative operator from left to right", [&]() {
+        bdd expected = fs[0];
+        for (size_t i = 1u; i < fs.size(); ++i) { expected = bdd_imp(expected, fs[i]); }
+
+        AssertThat(bdd_equal(bdd_apply(fs.begin(), fs.end(), imp_op), expected), Is().True());
+      });
+
+      it("shortcuts on F in a conjunction", [&]() {
+        const std::vector<bdd> in = { bdd_1, bdd_2, bdd_F, bdd_3, bdd_x0 };
+        AssertThat(bdd_isfalse(bdd_and(ep, in.begin(), in.end())), Is().True());
+      });
+
+      it("shortcuts on x0 /\\ !x0 in a conjunction", [&]() {
+        const std::vector<bdd> in = { bdd_x0, bdd_x1, bdd_not_x0, bdd_2 };
+        AssertThat(bdd_isfalse(bdd_and(ep, in.begin(), in.end())), Is().True());
+      });
+
+      it("ignores T in a conjunction", [&]() {
+        const std::vector<bdd> in = { bdd_T, bdd_x0, bdd_T, bdd_x1, bdd_x2 };
+        const bdd expected        = bdd_and(ep, xs.begin(), xs.end());
+
+        AssertThat(bdd_equal(bdd_and(ep, in.begin(), in.end()), expected), Is().True());
+      });
+
+      it("accepts a generator of BDDs", [&]() {
+        auto it        = fs.begin();
+        const auto gen = [&]() -> optional<bdd> {
+          if (it == fs.end()) { return {}; }
+          return *(it++);
+        };
+
+        bdd expected = fs[0];
+        for (size_t i = 1u; i < fs.size(); ++i) { expected = expected & fs[i]; }
+
+        AssertThat(bdd_equal(bdd_and(ep, gen), expected), Is().True());
+      });
+    });
+
+    describe("in-memory algorithms for small BDDs", [&]() {
+      const exec_policy ep = exec_policy::small_threshold(64);
+
+      const std::vector<bdd> fs = { bdd_F, bdd_T, bdd_x0, bdd_not_x0, bdd_x1,   bdd_x2,
+                                    bdd_1, bdd_2, bdd_3,  bdd_thin,   bdd_wide };
+
+      it("computes the same conjunctions as the default algorithm", [&]() {
+        for (const bdd& f : fs) {
+          for (const bdd& g : fs) {
+            AssertThat(bdd_equal(bdd_and(ep, f, g), bdd_and(f, g)), Is().True());
+          }
+        }
+      });
+
+      it("computes the same exclusive-ors as the default algorithm", [&]() {
+        for (const bdd& f : fs) {
+          for (const bdd& g : fs) {
+            AssertThat(bdd_equal(bdd_xor(ep, f, g), bdd_xor(f, g)), Is().True());
+          }
+        }
+      });
+
+      it("computes the same implications as the default algorithm", [&]() {
+        for (const bdd& f : fs) {
+          for (const bdd& g : fs) {
+            AssertThat(bdd_equal(bdd_imp(ep, f, g), bdd_imp(f, g)), Is().True());
+          }
+        }
+      });
+
+      it("outputs a canonical BDD", [&]() {
+        const bdd out = bdd_xor(ep, bdd_wide, bdd_3);
+        AssertThat(out.file_ptr()->is_canonical(), Is().True());
+      });
+
+      it("falls back to the default algorithm if an input is too large", [&]() {
+        const exec_policy ep_tiny = exec_policy::small_threshold(1);
+        AssertThat(bdd_equal(bdd_or(ep_tiny, bdd_wide, bdd_3), bdd_or(bdd_wide, bdd_3)),
+                   Is().True());
+      });
+    });
+
     describe("access mode: random access", [&]() {
       // Set access mode to random access for this batch of tests
       const exec_policy ep = exec_policy::access::Random_Access;
@@ -3118,5 +3118,27 @@ go_bandit([]() {
                    Is().EqualTo(5u));
       });
     });
+
+    describe("in-memory algorithm for small BDDs", [&]() {
+      const exec_policy ep = exec_policy::small_threshold(64);
+
+      const std::vector<bdd> fs = { bdd_F, bdd_T, bdd_x0, bdd_not_x1, bdd_x0_xor_x2,
+                                    bdd_1, bdd_2, bdd_3,  bdd_4,      bdd_8 };
+
+      it("computes the same if-then-else as the default algorithm", [&]() {
+        for (const bdd& f : fs) {
+          for (const bdd& g : fs) {
+            for (const bdd& h : fs) {
+              AssertThat(bdd_equal(bdd_ite(ep, f, g, h), bdd_ite(f, g, h)), Is().True());
+            }
+          }
+        }
+      });
+
+      it("outputs a canonical BDD", [&]() {
+        const bdd out = bdd_ite(ep, bdd_x0_xor_x1, bdd_2, bdd_4);
+        AssertThat(out.file_ptr()->is_canonical(), Is().True());
+      });
+    });
   });
 });
@@ -7227,5 +7227,47 @@ go_bandit([]() {
         });
       });
     });
+
+    describe("in-memory algorithm for small BDDs", [&]() {
+      const exec_policy ep = exec_policy::small_threshold(64);
+
+      const std::vector<bdd> fs = { terminal_F, terminal_T, bdd_x2, bdd_1, bdd_2,
+                                    bdd_3,      bdd_4,      bdd_6,  bdd_7, bdd_15 };
+
+      it("computes the same 'bdd_exists' for a single variable", [&]() {
+        for (const bdd& f : fs) {
+          for (bdd::label_type x = 0u; x < 5u; ++x) {
+            AssertThat(bdd_equal(bdd_exists(ep, f, x), bdd_exists(f, x)), Is().True());
+          }
+        }
+      });
+
+      it("computes the same 'bdd_forall' for a single variable", [&]() {
+        for (const bdd& f : fs) {
+          for (bdd::label_type x = 0u; x < 5u; ++x) {
+            AssertThat(bdd_equal(bdd_forall(ep, f, x), bdd_forall(f, x)), Is().True());
+          }
+        }
+      });
+
+      it("computes the same 'bdd_exists' for a predicate", [&]() {
+        const predicate<bdd::label_type> odd = [](const bdd::label_type x) { return x % 2u; };
+        for (const bdd& f : fs) {
+          AssertThat(bdd_equal(bdd_exists(ep, f, odd), bdd_exists(f, odd)), Is().True());
+        }
+      });
+
+      it("computes the same 'bdd_forall' for a predicate", [&]() {
+        const predicate<bdd::label_type> even = [](const bdd::label_type x) { return !(x % 2u); };
+        for (const bdd& f : fs) {
+          AssertThat(bdd_equal(bdd_forall(ep, f, even), bdd_forall(f, even)), Is().True());
+        }
+      });
+
+      it("outputs a canonical BDD", [&]() {
+        const bdd out = bdd_exists(ep, bdd_4, 1u);
+        AssertThat(out.file_ptr()->is_canonical(), Is().True());
+      });
+    });
   });
 });
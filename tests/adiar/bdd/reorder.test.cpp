@@ -0,0 +1,166 @@
+#include "../../test.h"
+
+#include <adiar/bdd/bdd_policy.h>
+#include <adiar/internal/algorithms/reorder.h>
+
+#include <vector>
+
+go_bandit([]() {
+  describe("adiar/bdd/reorder.cpp", []() {
+    const bdd::pointer_type terminal_T = bdd::pointer_type(true);
+    const bdd::pointer_type terminal_F = bdd::pointer_type(false);
+
+    const exec_policy ep;
+
+    // Evaluate `f` and `g` on all assignments to the variables `0, ..., vars-1`, where `g` is `f`
+    // with its variables permuted by `perm`.
+    const auto equivalent = [](const bdd& f,
+                               const bdd& g,
+                               const std::vector<bdd::label_type>& perm,
+                               const bdd::label_type vars) -> bool {
+      std::vector<bdd::label_type> inv(vars);
+      for (bdd::label_type x = 0u; x < vars; ++x) { inv[x < perm.size() ? perm[x] : x] = x; }
+
+      for (uint64_t a = 0u; a < (1u << vars); ++a) {
+        const bool f_a = bdd_eval(f, [a](const bdd::label_type x) { return (a >> x) & 1u; });
+        const bool g_a =
+          bdd_eval(g, [a, &inv](const bdd::label_type x) { return (a >> inv[x]) & 1u; });
+        if (f_a != g_a) { return false; }
+      }
+      return true;
+    };
+
+    shared_levelized_file<bdd::node_type> bdd_1_nf;
+    /*
+    //           1       ---- x0
+    //          / \
+    //          2  \     ---- x1
+    //         / \  \
+    //         F  3  4   ---- x2
+    //           / \/ \
+    //           T F  T
+    */
+    { // Garbage collect writers early
+      node_ofstream nw(bdd_1_nf);
+      nw << node(2, bdd::max_id, terminal_F, terminal_T)
+         << node(2, bdd::max_id - 1, terminal_T, terminal_F)
+         << node(1, bdd::max_id, terminal_F, bdd::pointer_type(2, bdd::max_id - 1))
+         << node(0, bdd::max_id, bdd::pointer_type(1, bdd::max_id),
+                 bdd::pointer_type(2, bdd::max_id));
+    }
+    const bdd bdd_1(bdd_1_nf);
+
+    // (x0 & x3) | (x1 & x4) | (x2 & x5) which is exponentially smaller with an interleaved order.
+    const bdd bdd_pairs = bdd_or(bdd_or(bdd_and(bdd_ithvar(0), bdd_ithvar(3)),
+                                        bdd_and(bdd_ithvar(1), bdd_ithvar(4))),
+                                 bdd_and(bdd_ithvar(2), bdd_ithvar(5)));
+
+    describe("swap_adjacent(f, x, y)", [&]() {
+      it("swaps x0 and x1 in [1]", [&]() {
+        const bdd out = swap_adjacent<bdd_policy>(ep, bdd_1, 0u, 1u);
+        AssertThat(equivalent(bdd_1, out, { 1u, 0u, 2u }, 3u), Is().True());
+      });
+
+      it("swaps x1 and x2 in [1]", [&]() {
+        const bdd out = swap_adjacent<bdd_policy>(ep, bdd_1, 1u, 2u);
+        AssertThat(equivalent(bdd_1, out, { 0u, 2u, 1u }, 3u), Is().True());
+      });
+
+      it("swaps x1 and x2 in ~[1]", [&]() {
+        const bdd out = swap_adjacent<bdd_policy>(ep, bdd_not(bdd_1), 1u, 2u);
+        AssertThat(equivalent(bdd_not(bdd_1), out, { 0u, 2u, 1u }, 3u), Is().True());
+      });
+
+      it("is its own inverse", [&]() {
+        const bdd tmp = swap_adjacent<bdd_policy>(ep, bdd_1, 0u, 1u);
+        const bdd out = swap_adjacent<bdd_policy>(ep, tmp, 0u, 1u);
+        AssertThat(bdd_equal(out, bdd_1), Is().True());
+      });
+
+      it("outputs a reduced BDD", [&]() {
+        // f[x1 <-> x2] = ite(x1, ite(x2, f_11, f_01), ite(x2, f_10, f_00))
+        const auto cofactor = [&](const bool x1, const bool x2) -> bdd {
+          return bdd_restrict(bdd_restrict(bdd_pairs, 1u, x1), 2u, x2);
+        };
+        const bdd x2       = bdd_ithvar(2);
+        const bdd expected = bdd_ite(bdd_ithvar(1),
+                                     bdd_ite(x2, cofactor(true, true), cofactor(false, true)),
+                                     bdd_ite(x2, cofactor(true, false), cofactor(false, false)));
+
+        const bdd out = swap_adjacent<bdd_policy>(ep, bdd_pairs, 1u, 2u);
+        AssertThat(bdd_equal(out, expected), Is().True());
+        AssertThat(bdd_nodecount(out), Is().EqualTo(bdd_nodecount(expected)));
+      });
+
+      it("outputs a canonical BDD when swapping x1 and x2 in [1]", [&]() {
+        const bdd out = swap_adjacent<bdd_policy>(ep, bdd_1, 1u, 2u);
+        AssertThat(out->is_canonical(), Is().True());
+      });
+
+      it("outputs a canonical BDD when swapping the bottom levels of (x0 & x3) | ...", [&]() {
+        const bdd out = swap_adjacent<bdd_policy>(ep, bdd_pairs, 4u, 5u);
+        AssertThat(out->is_canonical(), Is().True());
+        AssertThat(equivalent(bdd_pairs, out, { 0u, 1u, 2u, 3u, 5u, 4u }, 6u), Is().True());
+      });
+
+      it("throws 'invalid_argument' if levels are not adjacent", [&]() {
+        AssertThrows(invalid_argument, swap_adjacent<bdd_policy>(ep, bdd_1, 0u, 2u));
+      });
+    });
+
+    describe("bdd_reorder(f, r_type)", [&]() {
+      it("returns a terminal as-is", [&]() {
+        const auto [out, perm] = bdd_reorder(bdd_top());
+        AssertThat(bdd_istrue(out), Is().True());
+        AssertThat(perm.size(), Is().EqualTo(0u));
+      });
+
+      it("shrinks (x0 & x3) | (x1 & x4) | (x2 & x5) with sifting", [&]() {
+        const auto [out, perm] = bdd_reorder(bdd_pairs, reorder_type::Sifting);
+
+        AssertThat(bdd_nodecount(out), Is().LessThan(bdd_nodecount(bdd_pairs)));
+        AssertThat(perm.size(), Is().EqualTo(6u));
+        AssertThat(equivalent(bdd_pairs, out, perm, 6u), Is().True());
+      });
+
+      it("shrinks (x0 & x3) | (x1 & x4) | (x2 & x5) with a window of size 2", [&]() {
+        const auto [out, perm] = bdd_reorder(bdd_pairs, reorder_type::Window_2);
+
+        AssertThat(bdd_nodecount(out), Is().LessThan(bdd_nodecount(bdd_pairs)));
+        AssertThat(equivalent(bdd_pairs, out, perm, 6u), Is().True());
+      });
+
+      it("shrinks (x0 & x3) | (x1 & x4) | (x2 & x5) with a window of size 3", [&]() {
+        const auto [out, perm] = bdd_reorder(bdd_pairs, reorder_type::Window_3);
+
+        AssertThat(bdd_nodecount(out), Is().LessThan(bdd_nodecount(bdd_pairs)));
+        AssertThat(equivalent(bdd_pairs, out, perm, 6u), Is().True());
+      });
+
+      it("never increases the size of [1]", [&]() {
+        for (const reorder_type r : { reorder_type::Sifting, reorder_type::Window_2,
+                                      reorder_type::Window_3 }) {
+          const auto [out, perm] = bdd_reorder(bdd_1, r);
+
+          AssertThat(bdd_nodecount(out), Is().LessThanOrEqualTo(bdd_nodecount(bdd_1)));
+          AssertThat(equivalent(bdd_1, out, perm, 3u), Is().True());
+        }
+      });
+
+      it("outputs a canonical BDD", [&]() {
+        for (const reorder_type r : { reorder_type::Sifting, reorder_type::Window_2,
+                                      reorder_type::Window_3 }) {
+          const auto [out, perm] = bdd_reorder(bdd_pairs, r);
+          AssertThat(out->is_canonical(), Is().True());
+        }
+      });
+
+      it("does not move beyond the size bound", [&]() {
+        const auto [out, perm] = bdd_reorder(bdd_pairs, reorder_type::Sifting, 0u);
+
+        AssertThat(bdd_nodecount(out), Is().LessThanOrEqualTo(bdd_nodecount(bdd_pairs)));
+        AssertThat(equivalent(bdd_pairs, out, perm, 6u), Is().True());
+      });
+    });
+  });
+});
@@ -185,18 +185,94 @@ go_bandit([]() {
           AssertThat(out_meta.can_pull(), Is().False());
         });
 
-        it("throws exception if levels have to be swapped [bdd_1]", [&]() {
+        it("swaps levels of 'x0' and 'x4' [bdd_1]", [&]() {
           const mapping_type m = [](const int x) { return 4 - x; };
-          AssertThrows(invalid_argument, bdd_replace(bdd_1, m));
+          const bdd out        = bdd_replace(bdd_1, m);
+
+          const bdd expected = bdd_or(bdd_ithvar(0), bdd_and(bdd_ithvar(2), bdd_ithvar(4)));
+          AssertThat(bdd_equal(out, expected), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
         });
 
-        it("throws exception if levels have to be swapped [bdd_2]", [&]() {
+        it("swaps levels of 'x0' and 'x1' into 'x4' and 'x3' [bdd_2]", [&]() {
           const mapping_type m = [](const int x) { return 4 - x; };
-          AssertThrows(invalid_argument, bdd_replace(bdd_2, m));
+          const bdd out        = bdd_replace(bdd_2, m);
+
+          const bdd expected = bdd_xor(bdd_ithvar(3), bdd_ithvar(4));
+          AssertThat(bdd_equal(out, expected), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
+        });
+
+        it("reverses all levels [bdd_3]", [&]() {
+          const mapping_type m = [](const int x) { return 2 - x; };
+          const bdd out        = bdd_replace(bdd_3, m);
+
+          // ~x2 & (x0 <-> x1) becomes ~x0 & (x2 <-> x1)
+          const bdd expected =
+            bdd_and(bdd_nithvar(0), bdd_equiv(bdd_ithvar(1), bdd_ithvar(2)));
+          AssertThat(bdd_equal(out, expected), Is().True());
         });
 
-        // TODO: Add more complex inputs that test for all relevant behaviours of applying the
-        //       Nested Sweeping framework to move levels.
+        it("rotates levels [bdd_1]", [&]() {
+          const mapping_type m = [](const int x) { return x == 0 ? 5 : x - 1; };
+          const bdd out        = bdd_replace(bdd_1, m);
+
+          // x4 | (x0 & x2) becomes x3 | (x5 & x1), where 'x1' now is above 'x3'.
+          const bdd expected = bdd_or(bdd_ithvar(3), bdd_and(bdd_ithvar(1), bdd_ithvar(5)));
+          AssertThat(bdd_equal(out, expected), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(4u));
+        });
+
+        it("moves a variable far down [x0 ^ ... ^ x19]", [&]() {
+          bdd in = bdd_ithvar(0);
+          for (int x = 1; x < 20; ++x) { in = bdd_xor(in, bdd_ithvar(x)); }
+
+          const mapping_type m = [](const int x) { return x == 0 ? 20 : x; };
+          const bdd out        = bdd_replace(in, m);
+
+          bdd expected = bdd_ithvar(1);
+          for (int x = 2; x < 21; ++x) { expected = bdd_xor(expected, bdd_ithvar(x)); }
+          AssertThat(bdd_equal(out, expected), Is().True());
+        });
+
+        it("moves a variable far up [x0 & x1 | x20]", [&]() {
+          bdd in = bdd_ithvar(20);
+          for (int x = 0; x < 20; ++x) { in = bdd_or(in, bdd_and(bdd_ithvar(x), bdd_ithvar(x + 1))); }
+
+          const mapping_type m = [](const int x) { return x == 20 ? 0 : x + 1; };
+          const bdd out        = bdd_replace(in, m);
+
+          bdd expected = bdd_ithvar(0);
+          for (int x = 1; x < 21; ++x) {
+            expected = bdd_or(expected, bdd_and(bdd_ithvar(x), bdd_ithvar(x == 20 ? 0 : x + 1)));
+          }
+          AssertThat(bdd_equal(out, expected), Is().True());
+        });
+
+        it("interleaves two blocks of twelve variables", [&]() {
+          // (x0 <-> x12) & (x1 <-> x13) & ... & (x11 <-> x23)
+          bdd in = bdd_true();
+          for (int x = 0; x < 12; ++x) {
+            in = bdd_and(in, bdd_equiv(bdd_ithvar(x), bdd_ithvar(x + 12)));
+          }
+          AssertThat(bdd_nodecount(in), Is().GreaterThan(4096u));
+
+          const mapping_type m = [](const int x) { return x < 12 ? 2 * x : 2 * (x - 12) + 1; };
+          const bdd out        = bdd_replace(in, m);
+
+          // (x0 <-> x1) & (x2 <-> x3) & ... & (x22 <-> x23)
+          bdd expected = bdd_true();
+          for (int x = 0; x < 12; ++x) {
+            expected = bdd_and(expected, bdd_equiv(bdd_ithvar(2 * x), bdd_ithvar(2 * x + 1)));
+          }
+          AssertThat(bdd_equal(out, expected), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(3u * 12u));
+        });
+
+        it("throws exception if two levels are mapped to the same level [bdd_1]", [&]() {
+          const mapping_type m = [](const int x) { return x == 4 ? 2 : x; };
+          AssertThrows(invalid_argument, bdd_replace(bdd_1, m));
+        });
       });
 
       describe("<monotonic>", [&]() {
@@ -726,27 +802,43 @@ go_bandit([]() {
         AssertThat(out.is_negated(), Is().False());
       });
 
-      // TODO: Replace AssertThrows tests with checks for the output is correct (and reduced because
-      //       it uses the most general algorithm).
-
-      it("throws exception if 'replace_type' is 'Non_Monotone' [x0]", [&]() {
+      it("shifts 'x0' if 'replace_type' is 'Non_Monotone' [x0]", [&]() {
         // NOTE: This function is in fact 'Affine'/'Shift'
         const mapping_type m = [](const int x) { return x + 1; };
+        const bdd out        = bdd_replace(bdd_x0, m, replace_type::Non_Monotone);
+
+        node_test_ifstream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(1, bdd::max_id, terminal_F, terminal_T)));
 
-        AssertThrows(invalid_argument, bdd_replace(bdd_x0, m, replace_type::Non_Monotone));
+        AssertThat(out_nodes.can_pull(), Is().False());
+
+        level_info_test_ifstream out_meta(out);
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull(), Is().EqualTo(level_info(1, 1u)));
+
+        AssertThat(out_meta.can_pull(), Is().False());
       });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [bdd_1]", [&]() {
+      it("swaps levels if 'replace_type' is 'Non_Monotone' [bdd_1]", [&]() {
         // NOTE: This mapping proves it can swap levels
         const mapping_type m = [](const int x) { return 4 - x; };
-        AssertThrows(invalid_argument, bdd_replace(bdd_1, m, replace_type::Non_Monotone));
+        const bdd out        = bdd_replace(bdd_1, m, replace_type::Non_Monotone);
+
+        const bdd expected = bdd_or(bdd_ithvar(0), bdd_and(bdd_ithvar(2), bdd_ithvar(4)));
+        AssertThat(bdd_equal(out, expected), Is().True());
+        AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
       });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [bdd_2]", [&]() {
-        // NOTE: This function is in fact 'Affine'/'Shift'; the BDD should end up reduced.
+      it("shifts variables if 'replace_type' is 'Non_Monotone' [bdd_2]", [&]() {
+        // NOTE: This function is in fact 'Affine'/'Shift'
         const mapping_type m = [](const int x) { return x + 1; };
+        const bdd out        = bdd_replace(bdd_2, m, replace_type::Non_Monotone);
 
-        AssertThrows(invalid_argument, bdd_replace(bdd_2, m, replace_type::Non_Monotone));
+        const bdd expected = bdd_xor(bdd_ithvar(1), bdd_ithvar(2));
+        AssertThat(bdd_equal(out, expected), Is().True());
       });
 
       it("shifts variables in 'BDD 1' if 'replace_type' is 'Monotone'", [&]() {
@@ -1282,31 +1374,45 @@ go_bandit([]() {
           AssertThat(out->number_of_terminals[true], Is().EqualTo(1u));
         });
 
-        it("throws exception if level-swapping is potentially necessary [__bdd_x0_unreduced]",
-           [&]() {
-             const mapping_type m = [](const int x) { return 4 - x; };
-             AssertThrows(invalid_argument,
-                          bdd_replace(__bdd(__bdd_x0_unreduced, exec_policy()), m));
-           });
+        it("reduces and reverses 'x0' into 'x4' [__bdd_x0_unreduced]", [&]() {
+          const mapping_type m = [](const int x) { return 4 - x; };
+          const bdd out        = bdd_replace(__bdd(__bdd_x0_unreduced, exec_policy()), m);
 
-        it("throws exception if levels have to be swapped [bdd_1]", [&]() {
+          AssertThat(bdd_equal(out, bdd_ithvar(4)), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(1u));
+        });
+
+        it("swaps levels [bdd_1]", [&]() {
           const mapping_type m = [](const int x) { return 4 - x; };
-          AssertThrows(invalid_argument, bdd_replace(__bdd(__bdd_1, exec_policy()), m));
+          const bdd out        = bdd_replace(__bdd(bdd_1), m);
+
+          const bdd expected = bdd_or(bdd_ithvar(0), bdd_and(bdd_ithvar(2), bdd_ithvar(4)));
+          AssertThat(bdd_equal(out, expected), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
         });
 
-        it("throws exception if levels have to be swapped [__bdd_1]", [&]() {
+        it("reduces and swaps levels [__bdd_1]", [&]() {
           const mapping_type m = [](const int x) { return 4 - x; };
-          AssertThrows(invalid_argument, bdd_replace(__bdd(__bdd_1, exec_policy()), m));
+          const bdd out        = bdd_replace(__bdd(__bdd_1, exec_policy()), m);
+
+          const bdd expected = bdd_or(bdd_ithvar(0), bdd_and(bdd_ithvar(2), bdd_ithvar(4)));
+          AssertThat(bdd_equal(out, expected), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
         });
 
-        it("throws exception if levels have to be swapped [bdd_2]", [&]() {
+        it("swaps levels [bdd_2]", [&]() {
           const mapping_type m = [](const int x) { return 4 - x; };
-          AssertThrows(invalid_argument, bdd_replace(__bdd(__bdd_2, exec_policy()), m));
+          const bdd out        = bdd_replace(__bdd(bdd_2), m);
+
+          AssertThat(bdd_equal(out, bdd_xor(bdd_ithvar(3), bdd_ithvar(4))), Is().True());
         });
 
-        it("throws exception if levels have to be swapped [__bdd_2]", [&]() {
+        it("reduces and swaps levels [__bdd_2]", [&]() {
           const mapping_type m = [](const int x) { return 4 - x; };
-          AssertThrows(invalid_argument, bdd_replace(__bdd(__bdd_2, exec_policy()), m));
+          const bdd out        = bdd_replace(__bdd(__bdd_2, exec_policy()), m);
+
+          AssertThat(bdd_equal(out, bdd_xor(bdd_ithvar(3), bdd_ithvar(4))), Is().True());
+          AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
         });
       });
 
@@ -1865,61 +1971,76 @@ go_bandit([]() {
         AssertThat(out.is_negated(), Is().False());
       });
 
-      // TODO: Replace AssertThrows tests with checks for the output is correct (and reduced because
-      //       it uses the most general algorithm).
-
-      it("throws exception if 'replace_type' is 'Non_Monotone' [bdd_x0]", [&]() {
+      it("shifts 'x0' if 'replace_type' is 'Non_Monotone' [bdd_x0]", [&]() {
         // NOTE: This function is in fact 'Affine'/'Shift'
         const mapping_type m = [](const int x) { return x + 1; };
+        const bdd out =
+          bdd_replace(exec_policy(), __bdd(bdd_x0_nf), m, replace_type::Non_Monotone);
 
-        AssertThrows(invalid_argument,
-                     bdd_replace(exec_policy(), __bdd(bdd_x0_nf), m, replace_type::Non_Monotone));
+        AssertThat(bdd_equal(out, bdd_ithvar(1)), Is().True());
       });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [__bdd_x0]", [&]() {
+      it("reduces and shifts 'x0' if 'replace_type' is 'Non_Monotone' [__bdd_x0]", [&]() {
         // NOTE: This function is in fact 'Affine'/'Shift'
         const mapping_type m = [](const int x) { return x + 1; };
+        const bdd out =
+          bdd_replace(__bdd(__bdd_x0, exec_policy()), m, replace_type::Non_Monotone);
 
-        AssertThrows(invalid_argument,
-                     bdd_replace(__bdd(__bdd_x0, exec_policy()), m, replace_type::Non_Monotone));
+        AssertThat(bdd_equal(out, bdd_ithvar(1)), Is().True());
+        AssertThat(bdd_nodecount(out), Is().EqualTo(1u));
       });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [__bdd_x0_unreduced]", [&]() {
-        // NOTE: This function is in fact 'Affine'/'Shift'
-        const mapping_type m = [](const int x) { return x + 1; };
+      it("reduces and shifts 'x0' if 'replace_type' is 'Non_Monotone' [__bdd_x0_unreduced]",
+         [&]() {
+           // NOTE: This function is in fact 'Affine'/'Shift'
+           const mapping_type m = [](const int x) { return x + 1; };
+           const bdd out =
+             bdd_replace(__bdd(__bdd_x0_unreduced, exec_policy()), m, replace_type::Non_Monotone);
 
-        AssertThrows(
-          invalid_argument,
-          bdd_replace(__bdd(__bdd_x0_unreduced, exec_policy()), m, replace_type::Non_Monotone));
-      });
+           AssertThat(bdd_equal(out, bdd_ithvar(1)), Is().True());
+           AssertThat(bdd_nodecount(out), Is().EqualTo(1u));
+         });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [bdd_1]", [&]() {
+      it("swaps levels if 'replace_type' is 'Non_Monotone' [bdd_1]", [&]() {
         // NOTE: This mapping proves it can swap levels
         const mapping_type m = [](const int x) { return 4 - x; };
-        AssertThrows(invalid_argument, bdd_replace(__bdd(bdd_1_nf), m, replace_type::Non_Monotone));
+        const bdd out        = bdd_replace(__bdd(bdd_1_nf), m, replace_type::Non_Monotone);
+
+        const bdd expected = bdd_or(bdd_ithvar(0), bdd_and(bdd_ithvar(2), bdd_ithvar(4)));
+        AssertThat(bdd_equal(out, expected), Is().True());
+        AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
       });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [__bdd_1]", [&]() {
+      it("reduces and swaps levels if 'replace_type' is 'Non_Monotone' [__bdd_1]", [&]() {
         // NOTE: This mapping proves it can swap levels
         const mapping_type m = [](const int x) { return 4 - x; };
-        AssertThrows(invalid_argument,
-                     bdd_replace(__bdd(__bdd_1, exec_policy()), m, replace_type::Non_Monotone));
+        const bdd out =
+          bdd_replace(__bdd(__bdd_1, exec_policy()), m, replace_type::Non_Monotone);
+
+        const bdd expected = bdd_or(bdd_ithvar(0), bdd_and(bdd_ithvar(2), bdd_ithvar(4)));
+        AssertThat(bdd_equal(out, expected), Is().True());
+        AssertThat(bdd_nodecount(out), Is().EqualTo(3u));
       });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [bdd_3]", [&]() {
-        // NOTE: This function is in fact 'Affine'/'Shift'; the BDD should end up reduced.
+      it("shifts variables if 'replace_type' is 'Non_Monotone' [bdd_3]", [&]() {
+        // NOTE: This function is in fact 'Affine'/'Shift'
         const mapping_type m = [](const int x) { return x + 1; };
+        const bdd out        = bdd_replace(__bdd(bdd_3), m, replace_type::Non_Monotone);
 
-        AssertThrows(invalid_argument, bdd_replace(__bdd(bdd_3), m, replace_type::Non_Monotone));
+        // ~x2 & (x0 <-> x1) becomes ~x3 & (x1 <-> x2)
+        const bdd expected = bdd_and(bdd_nithvar(3), bdd_equiv(bdd_ithvar(1), bdd_ithvar(2)));
+        AssertThat(bdd_equal(out, expected), Is().True());
       });
 
-      it("throws exception if 'replace_type' is 'Non_Monotone' [__bdd_3_unreduced]", [&]() {
+      it("reduces and shifts if 'replace_type' is 'Non_Monotone' [__bdd_3_unreduced]", [&]() {
         // NOTE: This function is in fact 'Affine'/'Shift'; the BDD should end up reduced.
         const mapping_type m = [](const int x) { return x + 1; };
+        const bdd out =
+          bdd_replace(__bdd(__bdd_3_unreduced, exec_policy()), m, replace_type::Non_Monotone);
 
-        AssertThrows(
-          invalid_argument,
-          bdd_replace(__bdd(__bdd_3_unreduced, exec_policy()), m, replace_type::Non_Monotone));
+        const bdd expected = bdd_and(bdd_nithvar(3), bdd_equiv(bdd_ithvar(1), bdd_ithvar(2)));
+        AssertThat(bdd_equal(out, expected), Is().True());
+        AssertThat(bdd_nodecount(out), Is().EqualTo(4u));
       });
 
       it("reduces and affinely maps 'x0' if 'replace_type' is 'Monotone'", [&]() {
@@ -0,0 +1,363 @@
+#include "../../test.h"
+
+#include <cstring>
+#include <fstream>
+
+#include <adiar/internal/io/node_raccess.h>
+#include <adiar/internal/io/saved_file.h>
+
+go_bandit([]() {
+  describe("adiar/bdd/save.cpp", []() {
+    const std::string path = tpie::tempname::get_actual_path() + "/bdd-save-test.adiar";
+
+    const auto cleanup = [&path]() {
+      if (std::filesystem::exists(path)) { std::filesystem::remove(path); }
+    };
+
+    // Overwrite the 32-bit value at the given offset of the saved file's header.
+    const auto tamper = [&path](const std::streamoff offset, const uint32_t value) {
+      std::fstream fs(path, std::ios::binary | std::ios::in | std::ios::out);
+      fs.seekp(offset);
+      const unsigned char bytes[4] = { static_cast<unsigned char>(value & 0xFFu),
+                                       static_cast<unsigned char>((value >> 8) & 0xFFu),
+                                       static_cast<unsigned char>((value >> 16) & 0xFFu),
+                                       static_cast<unsigned char>((value >> 24) & 0xFFu) };
+      fs.write(reinterpret_cast<const char*>(bytes), sizeof(bytes));
+    };
+
+    shared_levelized_file<bdd::node_type> nf;
+    /*
+    //            1       ---- x0
+    //           / \
+    //           | 2      ---- x1
+    //           |/ \
+    //           F  T
+    */
+    {
+      node_ofstream nw(nf);
+      nw << node(1, bdd::max_id, bdd::pointer_type(false), bdd::pointer_type(true))
+         << node(0, bdd::max_id, bdd::pointer_type(false), bdd::pointer_type(1, bdd::max_id));
+    }
+
+    describe("bdd_save(f, path), bdd_load(path)", [&]() {
+      it("restores the nodes", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+
+        const bdd res = bdd_load(path);
+        node_test_ifstream ns(res);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(),
+                   Is().EqualTo(
+                     node(1, bdd::max_id, bdd::pointer_type(false), bdd::pointer_type(true))));
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(),
+                   Is().EqualTo(node(0,
+                                     bdd::max_id,
+                                     bdd::pointer_type(false),
+                                     bdd::pointer_type(1, bdd::max_id))));
+        AssertThat(ns.can_pull(), Is().False());
+        cleanup();
+      });
+
+      it("restores the meta information", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+
+        const bdd res = bdd_load(path);
+
+        AssertThat(res->sorted, Is().EqualTo(nf->sorted));
+        AssertThat(res->indexable, Is().EqualTo(nf->indexable));
+        AssertThat(res->fingerprint[0], Is().EqualTo(nf->fingerprint[0]));
+        AssertThat(res->fingerprint[1], Is().EqualTo(nf->fingerprint[1]));
+        AssertThat(res->width, Is().EqualTo(nf->width));
+        AssertThat(res->number_of_terminals[false], Is().EqualTo(nf->number_of_terminals[false]));
+        AssertThat(res->number_of_terminals[true], Is().EqualTo(nf->number_of_terminals[true]));
+        AssertThat(res->number_of_numeric_terminals, Is().EqualTo(nf->number_of_numeric_terminals));
+        AssertThat(res->max_1level_cut[cut::All], Is().EqualTo(nf->max_1level_cut[cut::All]));
+        AssertThat(res->max_1level_cut[cut::Internal],
+                   Is().EqualTo(nf->max_1level_cut[cut::Internal]));
+        AssertThat(res->max_2level_cut[cut::All], Is().EqualTo(nf->max_2level_cut[cut::All]));
+        AssertThat(bdd_nodecount(res), Is().EqualTo(2u));
+        cleanup();
+      });
+
+      it("leaves the saved BDD temporary", [&]() {
+        cleanup();
+        const bdd f = nf;
+        bdd_save(f, path);
+
+        AssertThat(f->is_persistent(), Is().False());
+        AssertThat(f.file_ptr(), Is().EqualTo(nf));
+        cleanup();
+      });
+
+      it("applies the negation of a BDD", [&]() {
+        cleanup();
+        bdd_save(bdd_not(nf), path);
+
+        const bdd res = bdd_load(path);
+
+        AssertThat(res.is_negated(), Is().False());
+        AssertThat(bdd_equal(res, bdd_not(nf)), Is().True());
+        cleanup();
+      });
+
+      it("can save and load a terminal", [&]() {
+        cleanup();
+        bdd_save(bdd_true(), path);
+
+        AssertThat(bdd_istrue(bdd_load(path)), Is().True());
+        cleanup();
+      });
+
+      it("throws an exception when saving on top of an existing BDD", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+
+        AssertThrows(runtime_error, bdd_save(bdd_true(), path));
+        cleanup();
+      });
+
+      it("throws an exception when loading a non-existing BDD", [&]() {
+        cleanup();
+        AssertThrows(runtime_error, bdd_load(path));
+      });
+
+      it("writes a single file", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+
+        AssertThat(std::filesystem::exists(path), Is().True());
+        AssertThat(std::filesystem::file_size(path),
+                   Is().EqualTo(saved_file::header_size + 2u * saved_file::level_info_size
+                                + 2u * saved_file::node_size));
+        cleanup();
+      });
+
+      it("starts the file with the magic bytes and the version in little-endian", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+
+        unsigned char bytes[12];
+        std::ifstream in(path, std::ios::binary);
+        in.read(reinterpret_cast<char*>(bytes), sizeof(bytes));
+
+        AssertThat(std::memcmp(bytes, "ADIARDD", 8), Is().EqualTo(0));
+        AssertThat(bytes[8], Is().EqualTo(saved_file::current_version));
+        AssertThat(bytes[9], Is().EqualTo(0u));
+        AssertThat(bytes[10], Is().EqualTo(0u));
+        AssertThat(bytes[11], Is().EqualTo(0u));
+        cleanup();
+      });
+
+      it("throws an exception when loading a corrupted header", [&]() {
+        cleanup();
+        std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a header";
+
+        AssertThrows(runtime_error, bdd_load(path));
+        cleanup();
+      });
+
+      it("throws an exception when loading an unknown version", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+        tamper(8, saved_file::current_version + 1u);
+
+        AssertThrows(runtime_error, bdd_load(path));
+        cleanup();
+      });
+
+      it("throws an exception when loading with a different number of level bits", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+        tamper(12, ADIAR_LEVEL_BITS - 1u);
+
+        AssertThrows(runtime_error, bdd_load(path));
+        cleanup();
+      });
+
+      it("throws an exception when loading with a different node size", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+        tamper(16, 2u * sizeof(node));
+
+        AssertThrows(runtime_error, bdd_load(path));
+        cleanup();
+      });
+
+      it("throws an exception when loading a truncated file", [&]() {
+        cleanup();
+        bdd_save(bdd(nf), path);
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1u);
+
+        AssertThrows(runtime_error, bdd_load(path));
+        cleanup();
+      });
+    });
+
+    describe("bdd_load(path) [memory-mapped]", [&]() {
+      shared_levelized_file<bdd::node_type> nf_wide;
+      /*
+      //            1       ---- x0
+      //           / \
+      //          2   3     ---- x1
+      //         / \ / \
+      //         F  4  T    ---- x2
+      //           / \
+      //           F T
+      */
+      {
+        node_ofstream nw(nf_wide);
+        nw << node(2, bdd::max_id, bdd::pointer_type(false), bdd::pointer_type(true))
+           << node(1, bdd::max_id, bdd::pointer_type(2, bdd::max_id), bdd::pointer_type(true))
+           << node(1, bdd::max_id - 1, bdd::pointer_type(false), bdd::pointer_type(2, bdd::max_id))
+           << node(0,
+                   bdd::max_id,
+                   bdd::pointer_type(1, bdd::max_id - 1),
+                   bdd::pointer_type(1, bdd::max_id));
+      }
+
+      it("reads the nodes in-place from the saved file", [&]() {
+        cleanup();
+        bdd_save(bdd(nf_wide), path);
+
+        const bdd res = bdd_load(path);
+
+        AssertThat(res->is_mapped(), Is().EqualTo(saved_file::can_map()));
+        AssertThat(res->is_persistent(), Is().EqualTo(saved_file::can_map()));
+        AssertThat(bdd_equal(res, bdd(nf_wide)), Is().True());
+        cleanup();
+      });
+
+      it("does not create any other files", [&]() {
+        cleanup();
+        bdd_save(bdd(nf_wide), path);
+        {
+          const bdd res = bdd_load(path);
+
+          if (res->is_mapped()) {
+            for (const std::string& p : res->paths()) { AssertThat(p, Is().EqualTo(path)); }
+          }
+        }
+        AssertThat(std::filesystem::exists(path), Is().True());
+        cleanup();
+      });
+
+      it("provides random access to the nodes in-place", [&]() {
+        cleanup();
+        bdd_save(bdd(nf_wide), path);
+
+        const bdd res = bdd_load(path);
+        node_raccess ra(res);
+
+        AssertThat(ra.root(), Is().EqualTo(node::uid_type(0, bdd::max_id)));
+
+        AssertThat(ra.has_next_level(), Is().True());
+        AssertThat(ra.next_level(), Is().EqualTo(0));
+        ra.setup_next_level();
+        AssertThat(ra.current_width(), Is().EqualTo(1u));
+        AssertThat(ra.at(0u),
+                   Is().EqualTo(node(0,
+                                     bdd::max_id,
+                                     bdd::pointer_type(1, bdd::max_id - 1),
+                                     bdd::pointer_type(1, bdd::max_id))));
+
+        AssertThat(ra.has_next_level(), Is().True());
+        ra.setup_next_level(1);
+        AssertThat(ra.current_width(), Is().EqualTo(2u));
+        AssertThat(ra.at(0u),
+                   Is().EqualTo(node(1,
+                                     bdd::max_id - 1,
+                                     bdd::pointer_type(false),
+                                     bdd::pointer_type(2, bdd::max_id))));
+        AssertThat(ra.at(node::uid_type(1, bdd::max_id)),
+                   Is().EqualTo(node(1,
+                                     bdd::max_id,
+                                     bdd::pointer_type(2, bdd::max_id),
+                                     bdd::pointer_type(true))));
+
+        AssertThat(ra.has_next_level(), Is().True());
+        ra.setup_next_level(2);
+        AssertThat(ra.current_width(), Is().EqualTo(1u));
+        AssertThat(ra.at(0u),
+                   Is().EqualTo(
+                     node(2, bdd::max_id, bdd::pointer_type(false), bdd::pointer_type(true))));
+
+        AssertThat(ra.has_next_level(), Is().False());
+        cleanup();
+      });
+
+      it("provides random access to a skipped level in-place", [&]() {
+        cleanup();
+        bdd_save(bdd(nf_wide), path);
+
+        const bdd res = bdd_load(path);
+        node_raccess ra(res);
+
+        ra.setup_next_level(2);
+        AssertThat(ra.current_width(), Is().EqualTo(1u));
+        AssertThat(ra.at(0u),
+                   Is().EqualTo(
+                     node(2, bdd::max_id, bdd::pointer_type(false), bdd::pointer_type(true))));
+        AssertThat(ra.has_next_level(), Is().False());
+        cleanup();
+      });
+
+      it("provides random access to a negated BDD", [&]() {
+        cleanup();
+        bdd_save(bdd(nf_wide), path);
+
+        node_raccess ra(bdd_not(bdd_load(path)));
+        ra.setup_next_level(1);
+        AssertThat(ra.current_width(), Is().EqualTo(2u));
+        AssertThat(ra.at(1u),
+                   Is().EqualTo(node(1,
+                                     bdd::max_id,
+                                     bdd::pointer_type(2, bdd::max_id),
+                                     bdd::pointer_type(false))));
+        cleanup();
+      });
+
+      it("can be used by operations on the loaded BDD", [&]() {
+        cleanup();
+        bdd_save(bdd(nf_wide), path);
+
+        const bdd res = bdd_load(path);
+        AssertThat(bdd_equal(bdd_and(res, bdd_ithvar(1)), bdd_and(nf_wide, bdd_ithvar(1))),
+                   Is().True());
+        AssertThat(bdd_equal(bdd_exists(res, 2), bdd_exists(nf_wide, 2)), Is().True());
+        AssertThat(bdd_satcount(res, 3), Is().EqualTo(bdd_satcount(nf_wide, 3)));
+        cleanup();
+      });
+
+      it("can load a terminal in-place", [&]() {
+        cleanup();
+        bdd_save(bdd_false(), path);
+
+        const bdd res = bdd_load(path);
+        node_raccess ra(res);
+        AssertThat(ra.root(), Is().EqualTo(node(false).uid()));
+        AssertThat(ra.has_next_level(), Is().False());
+        AssertThat(bdd_isfalse(res), Is().True());
+        cleanup();
+      });
+
+      it("cannot write to the loaded nodes", [&]() {
+        cleanup();
+        bdd_save(bdd(nf_wide), path);
+
+        const bdd res = bdd_load(path);
+        if (res->is_mapped()) {
+          shared_levelized_file<bdd::node_type> f = res.file_ptr();
+          AssertThrows(runtime_error, node_ofstream{ f });
+        }
+        AssertThat(std::filesystem::file_size(path),
+                   Is().EqualTo(saved_file::header_size + 3u * saved_file::level_info_size
+                                + 4u * saved_file::node_size));
+        cleanup();
+      });
+    });
+  });
+});
@@ -4,7 +4,7 @@ go_bandit([]() {
   describe("adiar/exec_policy.h", []() {
     describe("exec_policy", []() {
       it("uses expected number of bytes",
-         []() { AssertThat(sizeof(exec_policy), Is().EqualTo(3u)); });
+         []() { AssertThat(sizeof(exec_policy), Is().EqualTo(12u)); });
 
       describe("exec_policy(const __ &)", [&]() {
         it("is default constructed with default settings", [&]() {
@@ -18,6 +18,15 @@ go_bandit([]() {
 
           AssertThat(ep.template get<exec_policy::quantify::algorithm>(),
                      Is().EqualTo(exec_policy::quantify::Nested));
+
+          AssertThat(ep.template get<exec_policy::threads>().value(),
+                     Is().EqualTo(exec_policy::threads::Sequential));
+
+          AssertThat(ep.template get<exec_policy::chain>(),
+                     Is().EqualTo(exec_policy::chain::Reduce));
+
+          AssertThat(ep.template get<exec_policy::small_threshold>().value(),
+                     Is().EqualTo(exec_policy::small_threshold::Off));
         });
 
         it("can be conversion constructed from 'access mode'", [&]() {
@@ -55,6 +64,39 @@ go_bandit([]() {
           AssertThat(ep.template get<exec_policy::quantify::algorithm>(),
                      Is().EqualTo(exec_policy::quantify::Singleton));
         });
+
+        it("can be conversion constructed from 'threads'", [&]() {
+          exec_policy ep = exec_policy::threads(4);
+
+          AssertThat(ep.template get<exec_policy::access>(),
+                     Is().EqualTo(exec_policy::access::Auto));
+          AssertThat(ep.template get<exec_policy::memory>(),
+                     Is().EqualTo(exec_policy::memory::Auto));
+          AssertThat(ep.template get<exec_policy::quantify::algorithm>(),
+                     Is().EqualTo(exec_policy::quantify::Nested));
+
+          AssertThat(ep.template get<exec_policy::threads>().value(), Is().EqualTo(4u));
+        });
+
+        it("can be conversion constructed from 'chain'", [&]() {
+          exec_policy ep = exec_policy::chain::Pipe;
+
+          AssertThat(ep.template get<exec_policy::access>(),
+                     Is().EqualTo(exec_policy::access::Auto));
+          AssertThat(ep.template get<exec_policy::memory>(),
+                     Is().EqualTo(exec_policy::memory::Auto));
+
+          AssertThat(ep.template get<exec_policy::chain>(), Is().EqualTo(exec_policy::chain::Pipe));
+        });
+
+        it("can be conversion constructed from 'small_threshold'", [&]() {
+          exec_policy ep = exec_policy::small_threshold(1024);
+
+          AssertThat(ep.template get<exec_policy::memory>(),
+                     Is().EqualTo(exec_policy::memory::Auto));
+
+          AssertThat(ep.template get<exec_policy::small_threshold>().value(), Is().EqualTo(1024u));
+        });
       });
 
       describe("set(const __ &)", [&]() {
@@ -108,6 +150,49 @@ go_bandit([]() {
                      Is().EqualTo(exec_policy::quantify::Nested));
         });
 
+        it("can set 'threads'", [&]() {
+          exec_policy ep;
+          AssertThat(ep.template get<exec_policy::threads>().value(),
+                     Is().EqualTo(exec_policy::threads::Sequential));
+
+          ep.set(exec_policy::threads(exec_policy::threads::Auto));
+          AssertThat(ep.template get<exec_policy::threads>().value(),
+                     Is().EqualTo(exec_policy::threads::Auto));
+
+          ep.set(exec_policy::threads(8));
+          AssertThat(ep.template get<exec_policy::threads>().value(), Is().EqualTo(8u));
+
+          ep.set(exec_policy::threads());
+          AssertThat(ep.template get<exec_policy::threads>().value(),
+                     Is().EqualTo(exec_policy::threads::Sequential));
+        });
+
+        it("can set 'chain'", [&]() {
+          exec_policy ep;
+          AssertThat(ep.template get<exec_policy::chain>(),
+                     Is().EqualTo(exec_policy::chain::Reduce));
+
+          ep.set(exec_policy::chain::Pipe);
+          AssertThat(ep.template get<exec_policy::chain>(), Is().EqualTo(exec_policy::chain::Pipe));
+
+          ep.set(exec_policy::chain::Reduce);
+          AssertThat(ep.template get<exec_policy::chain>(),
+                     Is().EqualTo(exec_policy::chain::Reduce));
+        });
+
+        it("can set 'small_threshold'", [&]() {
+          exec_policy ep;
+          AssertThat(ep.template get<exec_policy::small_threshold>().value(),
+                     Is().EqualTo(exec_policy::small_threshold::Off));
+
+          ep.set(exec_policy::small_threshold(4096));
+          AssertThat(ep.template get<exec_policy::small_threshold>().value(), Is().EqualTo(4096u));
+
+          ep.set(exec_policy::small_threshold());
+          AssertThat(ep.template get<exec_policy::small_threshold>().value(),
+                     Is().EqualTo(exec_policy::small_threshold::Off));
+        });
+
         it("can set settigs with a builder pattern syntax", [&]() {
           exec_policy ep;
 
@@ -168,6 +253,27 @@ go_bandit([]() {
 
           AssertThat(ep1, Is().Not().EqualTo(ep2));
         });
+
+        it("mismatches on 'threads'", [&]() {
+          exec_policy ep1 = exec_policy::threads(1);
+          exec_policy ep2 = exec_policy::threads(2);
+
+          AssertThat(ep1, Is().Not().EqualTo(ep2));
+        });
+
+        it("mismatches on 'chain'", [&]() {
+          exec_policy ep1 = exec_policy::chain::Reduce;
+          exec_policy ep2 = exec_policy::chain::Pipe;
+
+          AssertThat(ep1, Is().Not().EqualTo(ep2));
+        });
+
+        it("mismatches on 'small_threshold'", [&]() {
+          exec_policy ep1 = exec_policy::small_threshold(16);
+          exec_policy ep2 = exec_policy::small_threshold(32);
+
+          AssertThat(ep1, Is().Not().EqualTo(ep2));
+        });
       });
 
       describe("operator &(const exec_policy&)", [&]() {
@@ -203,6 +309,28 @@ go_bandit([]() {
                      Is().EqualTo(exec_policy::quantify::Singleton));
         });
 
+        it("can create a copy with another 'threads'", [&]() {
+          const exec_policy in  = exec_policy::memory::Internal;
+          const exec_policy out = in & exec_policy::threads(2);
+
+          AssertThat(in.template get<exec_policy::threads>().value(),
+                     Is().EqualTo(exec_policy::threads::Sequential));
+          AssertThat(out.template get<exec_policy::threads>().value(), Is().EqualTo(2u));
+          AssertThat(out.template get<exec_policy::memory>(),
+                     Is().EqualTo(exec_policy::memory::Internal));
+        });
+
+        it("can create a copy with another 'chain'", [&]() {
+          const exec_policy in  = exec_policy::memory::Internal;
+          const exec_policy out = in & exec_policy::chain::Pipe;
+
+          AssertThat(in.template get<exec_policy::chain>(),
+                     Is().EqualTo(exec_policy::chain::Reduce));
+          AssertThat(out.template get<exec_policy::chain>(), Is().EqualTo(exec_policy::chain::Pipe));
+          AssertThat(out.template get<exec_policy::memory>(),
+                     Is().EqualTo(exec_policy::memory::Internal));
+        });
+
         it("can lift enum values [access]", [&]() {
           const exec_policy ep = exec_policy::access::Random_Access & exec_policy::memory::Internal;
 
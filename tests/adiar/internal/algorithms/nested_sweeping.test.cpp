@@ -202,6 +202,7 @@ public:
   ////////////////////////////////////////////////////////////////////////////////////////////////
   static constexpr bool final_canonical = FinalCanonical;
   static constexpr bool fast_reduce     = FastReduce;
+  static constexpr bool idempotent      = true;
 };
 
 class test_terminal_sweep
@@ -369,6 +370,7 @@ public:
   ////////////////////////////////////////////////////////////////////////////////////////////////
   static constexpr bool final_canonical = true;
   static constexpr bool fast_reduce     = false;
+  static constexpr bool idempotent      = true;
 };
 
 go_bandit([]() {
@@ -1,5 +1,8 @@
 #include "../../../test.h"
 
+#include <adiar/bdd/bdd_policy.h>
+#include <adiar/internal/algorithms/reduce.h>
+
 go_bandit([]() {
   describe("adiar/internal/algorithms/reduce.h", [&]() {
     // The reduce<dd_policy> function is used within the constructors of the BDD
@@ -524,6 +527,96 @@ go_bandit([]() {
         AssertThat(out->number_of_terminals[true], Is().EqualTo(3u));
       });
 
+      it("applies to both node and terminal arcs with multiple threads", [&]() {
+        // Same as above, but with the terminal arcs grouped by another thread.
+
+        const arc::uid_type n1(0, 0);
+        const arc::uid_type n2(1, 0);
+        const arc::uid_type n3(2, 0);
+        const arc::uid_type n4(2, 1);
+        const arc::uid_type n5(3, 0);
+
+        shared_levelized_file<arc> in;
+
+        { // Garbage collect writer to free write-lock
+          arc_ofstream aw(in);
+
+          aw.push_internal({ n1, true, n2 });
+          aw.push_internal({ n1, false, n3 });
+          aw.push_internal({ n2, false, n4 });
+          aw.push_internal({ n3, false, n5 });
+          aw.push_internal({ n4, false, n5 });
+
+          aw.push_terminal({ n2, true, terminal_T });
+          aw.push_terminal({ n3, true, terminal_T });
+          aw.push_terminal({ n4, true, terminal_T });
+          aw.push_terminal({ n5, false, terminal_F });
+          aw.push_terminal({ n5, true, terminal_T });
+
+          aw.push(level_info(0, 1u));
+          aw.push(level_info(1, 1u));
+          aw.push(level_info(2, 2u));
+          aw.push(level_info(3, 1u));
+        }
+
+        in->max_1level_cut = 4;
+
+        // Reduce it
+        bdd out(__bdd(in, exec_policy::threads(2)));
+
+        AssertThat(out->sorted, Is().True());
+        AssertThat(out->indexable, Is().True());
+        AssertThat(bdd_iscanonical(out), Is().True());
+
+        // Check it looks all right
+        node_test_ifstream out_nodes(out);
+
+        AssertThat(out_nodes.can_pull(), Is().True());
+
+        // n5
+        AssertThat(out_nodes.pull(), Is().EqualTo(node(3, node::max_id, terminal_F, terminal_T)));
+        AssertThat(out_nodes.can_pull(), Is().True());
+
+        // n4
+        AssertThat(
+          out_nodes.pull(),
+          Is().EqualTo(node(2, node::max_id, node::pointer_type(3, node::max_id), terminal_T)));
+        AssertThat(out_nodes.can_pull(), Is().True());
+
+        // n2
+        AssertThat(
+          out_nodes.pull(),
+          Is().EqualTo(node(1, node::max_id, node::pointer_type(2, node::max_id), terminal_T)));
+        AssertThat(out_nodes.can_pull(), Is().True());
+
+        // n1
+        AssertThat(out_nodes.pull(),
+                   Is().EqualTo(node(0,
+                                     node::max_id,
+                                     node::pointer_type(2, node::max_id),
+                                     node::pointer_type(1, node::max_id))));
+        AssertThat(out_nodes.can_pull(), Is().False());
+
+        level_info_test_ifstream out_meta(out);
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull(), Is().EqualTo(level_info(3, 1u)));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull(), Is().EqualTo(level_info(2, 1u)));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull(), Is().EqualTo(level_info(1, 1u)));
+
+        AssertThat(out_meta.can_pull(), Is().True());
+        AssertThat(out_meta.pull(), Is().EqualTo(level_info(0, 1u)));
+
+        AssertThat(out_meta.can_pull(), Is().False());
+
+        AssertThat(out->number_of_terminals[false], Is().EqualTo(1u));
+        AssertThat(out->number_of_terminals[true], Is().EqualTo(3u));
+      });
+
       it("applies to 'disjoint' branches", [&]() {
         /*
         //               1                        1         ---- x0
@@ -3424,5 +3517,94 @@ go_bandit([]() {
         AssertThat(out->number_of_terminals[true], Is().EqualTo(1u));
       });
     });
+
+    describe("reduce_rule2__hashing", [&]() {
+      // Nodes on level x1 (in the order of the internal arcs) where n3 is a duplicate of n5 (but
+      // with a child tainted by Reduction Rule 1) and n1 is a duplicate of n4.
+      const node::pointer_type c0(2, 0);
+      const node::pointer_type c1(2, 1);
+
+      const std::vector<node> level = { node(1, 5, terminal_F, c0),
+                                        node(1, 4, terminal_F, terminal_T),
+                                        node(1, 3, terminal_F, flag(c0)),
+                                        node(1, 2, c1, terminal_T),
+                                        node(1, 1, terminal_F, terminal_T),
+                                        node(1, 0, c1, c0) };
+
+      shared_levelized_file<node> sorted_file;
+      std::vector<mapping> sorted_mappings;
+      size_t sorted_width;
+
+      { // Garbage collect writer to free write-lock
+        node_ofstream out(sorted_file);
+        cuts_t local_cut   = { { 0u, 0u, 0u, 0u } };
+        cuts_t tainted_cut = { { 0u, 0u, 0u, 0u } };
+
+        reduce_rule2__sorting<internal_sorter> rule2(memory_available(), level.size());
+        for (const node& n : level) { rule2.push(n); }
+        sorted_width =
+          rule2.template apply<bdd_policy>(1, out, local_cut, tainted_cut, stats_reduce);
+        while (rule2.can_pull()) { sorted_mappings.push_back(rule2.pull()); }
+
+        out.unsafe_push(level_info(1, sorted_width));
+      }
+
+      it("removes the same duplicates as sorting", [&]() {
+        shared_levelized_file<node> out_file;
+        size_t width;
+
+        { // Garbage collect writer to free write-lock
+          node_ofstream out(out_file);
+          cuts_t local_cut   = { { 0u, 0u, 0u, 0u } };
+          cuts_t tainted_cut = { { 0u, 0u, 0u, 0u } };
+
+          reduce_rule2__hashing rule2(memory_available(), level.size());
+          for (const node& n : level) { rule2.push(n); }
+          width = rule2.template apply<bdd_policy>(1, out, local_cut, tainted_cut, stats_reduce);
+
+          out.unsafe_push(level_info(1, width));
+        }
+
+        AssertThat(width, Is().EqualTo(4u));
+        AssertThat(width, Is().EqualTo(sorted_width));
+
+        node_test_ifstream out_nodes(out_file);
+        node_test_ifstream sorted_nodes(sorted_file);
+
+        while (sorted_nodes.can_pull()) {
+          AssertThat(out_nodes.can_pull(), Is().True());
+          AssertThat(out_nodes.pull(), Is().EqualTo(sorted_nodes.pull()));
+        }
+        AssertThat(out_nodes.can_pull(), Is().False());
+      });
+
+      it("provides the same mappings as sorting (in the order of the internal arcs)", [&]() {
+        shared_levelized_file<node> out_file;
+        std::vector<mapping> mappings;
+
+        { // Garbage collect writer to free write-lock
+          node_ofstream out(out_file);
+          cuts_t local_cut   = { { 0u, 0u, 0u, 0u } };
+          cuts_t tainted_cut = { { 0u, 0u, 0u, 0u } };
+
+          reduce_rule2__hashing rule2(memory_available(), level.size());
+          for (const node& n : level) { rule2.push(n); }
+          rule2.template apply<bdd_policy>(1, out, local_cut, tainted_cut, stats_reduce);
+          while (rule2.can_pull()) { mappings.push_back(rule2.pull()); }
+        }
+
+        AssertThat(mappings.size(), Is().EqualTo(level.size()));
+        AssertThat(mappings.size(), Is().EqualTo(sorted_mappings.size()));
+
+        for (size_t i = 0u; i < mappings.size(); ++i) {
+          AssertThat(mappings[i].old_uid, Is().EqualTo(level[i].uid()));
+          AssertThat(mappings[i].old_uid, Is().EqualTo(sorted_mappings[i].old_uid));
+          AssertThat(mappings[i].new_uid, Is().EqualTo(sorted_mappings[i].new_uid));
+        }
+
+        AssertThat(mappings[2].new_uid, Is().EqualTo(mappings[0].new_uid));
+        AssertThat(mappings[4].new_uid, Is().EqualTo(mappings[1].new_uid));
+      });
+    });
   });
 });
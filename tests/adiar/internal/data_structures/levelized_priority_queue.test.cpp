@@ -81,6 +81,27 @@ using test_priority_queue = levelized_priority_queue<lpq_test_data,
                                                      std::less<>,
                                                      1u>;
 
+// Key that is consistent with `lpq_test_lt`, but leaves ties for the comparator to resolve.
+struct lpq_test_key
+{
+  uint64_t
+  operator()(const lpq_test_data& d) const
+  {
+    return (static_cast<uint64_t>(d.label) << 32) | (d.nonce >> 4);
+  }
+};
+
+template <size_t look_ahead>
+using test_radix_priority_queue =
+  levelized_priority_queue<lpq_test_data,
+                           lpq_test_lt,
+                           look_ahead,
+                           memory_mode::Internal,
+                           1u,
+                           std::less<>,
+                           1u,
+                           radix_priority_queue<lpq_test_data, lpq_test_lt, lpq_test_key>>;
+
 go_bandit([]() {
   describe("adiar/internal/levelized_priority_queue.h", []() {
     ////////////////////////////////////////////////////////////////////////////
@@ -5343,5 +5364,187 @@ go_bandit([]() {
         });
       });
     });
+
+    describe("levelized_priority_queue<..., look_ahead=1, ...> [sort ahead]", []() {
+      // With many elements for the next level, the helper thread has to sort them in parts while
+      // the current level is still being processed.
+      const uint64_t elements = 5 * sort_ahead_min_elements;
+
+      it("provides elements in order when the next bucket is sorted ahead", [&]() {
+        lpq_test_file f;
+
+        { // Garbage collect the writer early
+          lpq_test_ofstream fw(f);
+
+          fw.push(level_info(4, 1u)); // overflow
+          fw.push(level_info(3, 1u)); // bucket
+          fw.push(level_info(2, 1u)); // bucket
+          fw.push(level_info(1, 1u)); // skipped
+        }
+
+        test_priority_queue<1> pq(
+          { f }, memory_available(), 3 * elements, stats_lpq_tests, exec_policy::threads(2));
+
+        // Push in a scrambled order to level 2
+        for (uint64_t i = 0; i < elements; ++i) {
+          pq.push(lpq_test_data{ 2, (i * 7919u) % elements });
+        }
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(2u));
+
+        // While pulling level 2, push in reverse to level 3 and 4 (the latter to the overflow)
+        for (uint64_t i = 0; i < elements; ++i) {
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 2, i }));
+
+          pq.push(lpq_test_data{ 3, elements - i - 1 });
+          pq.push(lpq_test_data{ 4, elements - i - 1 });
+        }
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(3u));
+
+        for (uint64_t i = 0; i < elements; ++i) {
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 3, i }));
+        }
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(4u));
+
+        for (uint64_t i = 0; i < elements; ++i) {
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 4, i }));
+        }
+        AssertThat(pq.can_pull(), Is().False());
+        AssertThat(pq.empty(), Is().True());
+      });
+
+      it("provides elements in order when merged with the overflow queue", [&]() {
+        lpq_test_file f;
+
+        { // Garbage collect the writer early
+          lpq_test_ofstream fw(f);
+
+          fw.push(level_info(4, 1u)); // overflow
+          fw.push(level_info(3, 1u)); // bucket
+          fw.push(level_info(2, 1u)); // bucket
+          fw.push(level_info(1, 1u)); // skipped
+        }
+
+        test_priority_queue<1> pq(
+          { f }, memory_available(), 2 * elements, stats_lpq_tests, exec_policy::threads(2));
+
+        pq.push(lpq_test_data{ 2, 0 });
+        pq.setup_next_level();
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 2, 0 }));
+
+        // Level 4 does not have a bucket yet, so the even elements end up in the overflow queue.
+        pq.push(lpq_test_data{ 3, 0 });
+        for (uint64_t i = 0; i < elements; ++i) {
+          pq.push(lpq_test_data{ 4, 2 * ((i * 7919u) % elements) });
+        }
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(3u));
+        AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 3, 0 }));
+
+        // Level 4 now has a bucket, which is sorted ahead.
+        for (uint64_t i = 0; i < elements; ++i) {
+          pq.push(lpq_test_data{ 4, 2 * ((i * 7919u) % elements) + 1 });
+        }
+        AssertThat(pq.can_pull(), Is().False());
+
+        pq.setup_next_level();
+        AssertThat(pq.current_level(), Is().EqualTo(4u));
+
+        for (uint64_t i = 0; i < 2 * elements; ++i) {
+          AssertThat(pq.can_pull(), Is().True());
+          AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ 4, i }));
+        }
+        AssertThat(pq.can_pull(), Is().False());
+      });
+    });
+
+    describe("levelized_priority_queue<..., radix_priority_queue<...>>", []() {
+      const uint64_t elements = 1000u;
+
+      it("provides elements in order from buckets and the overflow queue [look_ahead=1]", [&]() {
+        lpq_test_file f;
+
+        { // Garbage collect the writer early
+          lpq_test_ofstream fw(f);
+
+          fw.push(level_info(5, 1u)); // overflow
+          fw.push(level_info(4, 1u)); // overflow
+          fw.push(level_info(3, 1u)); // bucket
+          fw.push(level_info(2, 1u)); // bucket
+          fw.push(level_info(1, 1u)); // skipped
+        }
+
+        test_radix_priority_queue<1> pq({ f }, memory_available(), 4 * elements, stats_lpq_tests);
+
+        // Push to levels 2, 5, and 4 (the latter two into the overflow queue) in scrambled order.
+        for (uint64_t i = 0; i < elements; ++i) {
+          pq.push(lpq_test_data{ 2, (i * 7919u) % elements });
+          pq.push(lpq_test_data{ 5, (i * 7919u) % elements });
+          pq.push(lpq_test_data{ 4, (i * 7907u) % elements });
+        }
+
+        for (ptr_uint64::label_type l = 2; l <= 5; ++l) {
+          pq.setup_next_level();
+          AssertThat(pq.current_level(), Is().EqualTo(l));
+
+          for (uint64_t i = 0; i < elements; ++i) {
+            AssertThat(pq.can_pull(), Is().True());
+            AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ l, i }));
+
+            // While on level 2, also push to level 3 in reverse.
+            if (l == 2) { pq.push(lpq_test_data{ 3, elements - i - 1 }); }
+          }
+          AssertThat(pq.can_pull(), Is().False());
+        }
+        AssertThat(pq.empty(), Is().True());
+      });
+
+      it("provides elements in order [look_ahead=0]", [&]() {
+        lpq_test_file f;
+
+        { // Garbage collect the writer early
+          lpq_test_ofstream fw(f);
+
+          fw.push(level_info(4, 1u));
+          fw.push(level_info(3, 1u));
+          fw.push(level_info(2, 1u));
+          fw.push(level_info(1, 1u)); // skipped
+        }
+
+        test_radix_priority_queue<0> pq({ f }, memory_available(), 3 * elements, stats_lpq_tests);
+
+        for (uint64_t i = 0; i < elements; ++i) {
+          pq.push(lpq_test_data{ 4, (i * 7919u) % elements });
+          pq.push(lpq_test_data{ 2, (i * 7907u) % elements });
+        }
+
+        for (ptr_uint64::label_type l = 2; l <= 4; ++l) {
+          pq.setup_next_level();
+          AssertThat(pq.current_level(), Is().EqualTo(l));
+
+          for (uint64_t i = 0; i < elements; ++i) {
+            AssertThat(pq.can_pull(), Is().True());
+            AssertThat(pq.top(), Is().EqualTo(lpq_test_data{ l, i }));
+            AssertThat(pq.pull(), Is().EqualTo(lpq_test_data{ l, i }));
+
+            // While on level 2, push to level 3 below the top of the queue.
+            if (l == 2) { pq.push(lpq_test_data{ 3, elements - i - 1 }); }
+          }
+          AssertThat(pq.can_pull(), Is().False());
+        }
+        AssertThat(pq.empty(), Is().True());
+      });
+    });
   });
 });
@@ -162,6 +162,67 @@ go_bandit([]() {
       });
     });
 
+    describe("priority_queue<memory_mode::Adaptive, int, std::less<>>", []() {
+      it("stays in internal memory if all elements fit", []() {
+        priority_queue<memory_mode::Adaptive, int, std::less<>> pq(8 * 1024 * 1024, 16);
+
+        AssertThat(pq.empty(), Is().True());
+        AssertThat(pq.has_top(), Is().False());
+
+        pq.push(3);
+        pq.push(1);
+        pq.push(4);
+        AssertThat(pq.size(), Is().EqualTo(3u));
+        AssertThat(pq.is_spilled(), Is().False());
+
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(1));
+        pq.pop();
+
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(3));
+        pq.pop();
+
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(4));
+        pq.pop();
+
+        AssertThat(pq.has_top(), Is().False());
+      });
+
+      it("moves to external memory when pushing beyond its bound", []() {
+        priority_queue<memory_mode::Adaptive, int, std::less<>> pq(8 * 1024 * 1024, 2);
+
+        pq.push(3);
+        pq.push(5);
+        AssertThat(pq.is_spilled(), Is().False());
+
+        pq.push(4);
+        AssertThat(pq.is_spilled(), Is().True());
+        AssertThat(pq.size(), Is().EqualTo(3u));
+
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(3));
+        pq.pop();
+
+        pq.push(1);
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(1));
+        pq.pop();
+
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(4));
+        pq.pop();
+
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(5));
+        pq.pop();
+
+        AssertThat(pq.has_top(), Is().False());
+        AssertThat(pq.size(), Is().EqualTo(0u));
+      });
+    });
+
     describe("priority_queue<memory_mode::Internal, int, std::greater<>>", []() {
       priority_queue<memory_mode::Internal, int, std::greater<>> pq(1024, 16);
 
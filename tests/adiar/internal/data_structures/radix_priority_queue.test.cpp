@@ -0,0 +1,185 @@
+#include "../../../test.h"
+
+#include <adiar/internal/data_structures/radix_priority_queue.h>
+
+struct radix_test_key
+{
+  uint64_t
+  operator()(const int x) const
+  {
+    return static_cast<uint64_t>(x);
+  }
+};
+
+// Key without the two least significant bits, such that the comparator has to resolve ties.
+struct radix_test_coarse_key
+{
+  uint64_t
+  operator()(const int x) const
+  {
+    return static_cast<uint64_t>(x) >> 2;
+  }
+};
+
+go_bandit([]() {
+  describe("adiar/internal/radix_priority_queue.h", []() {
+    describe("radix_priority_queue<int, std::less<>, radix_test_key>", []() {
+      radix_priority_queue<int, std::less<>, radix_test_key> pq(1024, 16);
+
+      it("is initially empty", [&pq]() {
+        AssertThat(pq.empty(), Is().True());
+        AssertThat(pq.size(), Is().EqualTo(0u));
+        AssertThat(pq.has_top(), Is().False());
+      });
+
+      it("can push elements", [&pq]() {
+        pq.push(3);
+        AssertThat(pq.empty(), Is().False());
+        AssertThat(pq.size(), Is().EqualTo(1u));
+        AssertThat(pq.has_top(), Is().True());
+
+        pq.push(1);
+        AssertThat(pq.size(), Is().EqualTo(2u));
+
+        pq.push(4);
+        AssertThat(pq.size(), Is().EqualTo(3u));
+
+        pq.push(42);
+        AssertThat(pq.size(), Is().EqualTo(4u));
+      });
+
+      it("can peek smallest element", [&pq]() {
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(1));
+        AssertThat(pq.top(), Is().EqualTo(1));
+      });
+
+      it("can pop smallest element", [&pq]() {
+        pq.pop();
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(3));
+        AssertThat(pq.size(), Is().EqualTo(3u));
+      });
+
+      it("can push an element equal to the last popped one", [&pq]() {
+        pq.push(1);
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(1));
+        pq.pop();
+        AssertThat(pq.top(), Is().EqualTo(3));
+      });
+
+      it("can push a new element (< .top())", [&pq]() {
+        pq.push(2);
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(2));
+      });
+
+      it("can push a new element (> .top())", [&pq]() {
+        pq.push(17);
+        AssertThat(pq.has_top(), Is().True());
+        AssertThat(pq.top(), Is().EqualTo(2));
+      });
+
+      it("can pop remaining elements", [&pq]() {
+        AssertThat(pq.size(), Is().EqualTo(5u));
+
+        AssertThat(pq.top(), Is().EqualTo(2));
+        pq.pop();
+
+        AssertThat(pq.top(), Is().EqualTo(3));
+        pq.pop();
+
+        AssertThat(pq.top(), Is().EqualTo(4));
+        pq.pop();
+
+        AssertThat(pq.top(), Is().EqualTo(17));
+        pq.pop();
+
+        AssertThat(pq.top(), Is().EqualTo(42));
+        pq.pop();
+
+        AssertThat(pq.has_top(), Is().False());
+        AssertThat(pq.size(), Is().EqualTo(0u));
+      });
+    });
+
+    describe("radix_priority_queue<int, std::less<>, radix_test_coarse_key>", []() {
+      it("resolves ties on the key with the comparator", []() {
+        radix_priority_queue<int, std::less<>, radix_test_coarse_key> pq(1024, 16);
+
+        pq.push(7);
+        pq.push(5);
+        pq.push(1);
+        pq.push(6);
+        pq.push(0);
+        pq.push(4);
+        pq.push(3);
+
+        for (int i : { 0, 1, 3, 4, 5, 6, 7 }) {
+          AssertThat(pq.has_top(), Is().True());
+          AssertThat(pq.top(), Is().EqualTo(i));
+          pq.pop();
+        }
+        AssertThat(pq.has_top(), Is().False());
+      });
+    });
+
+    describe("radix_priority_queue<int, std::greater<>, ...>", []() {
+      // Key that reverses the order of the integers.
+      struct radix_test_reverse_key
+      {
+        uint64_t
+        operator()(const int x) const
+        {
+          return static_cast<uint64_t>(1024 - x);
+        }
+      };
+
+      it("can be used for a descending order", []() {
+        radix_priority_queue<int, std::greater<>, radix_test_reverse_key> pq(1024, 16);
+
+        pq.push(2);
+        pq.push(8);
+        pq.push(5);
+
+        AssertThat(pq.top(), Is().EqualTo(8));
+        pq.pop();
+
+        pq.push(7);
+        pq.push(1);
+
+        for (int i : { 7, 5, 2, 1 }) {
+          AssertThat(pq.has_top(), Is().True());
+          AssertThat(pq.top(), Is().EqualTo(i));
+          pq.pop();
+        }
+        AssertThat(pq.has_top(), Is().False());
+      });
+    });
+
+    describe("radix_priority_queue<int, std::less<>, radix_test_key> [many elements]", []() {
+      it("pops elements in order while pushing monotonically", []() {
+        const int elements = 10000;
+        radix_priority_queue<int, std::less<>, radix_test_key> pq(
+          radix_priority_queue<int, std::less<>, radix_test_key>::memory_usage(2 * elements),
+          2 * elements);
+
+        // Push even numbers in a scrambled order
+        for (int i = 0; i < elements; ++i) { pq.push(2 * ((i * 7919) % elements)); }
+
+        // Pop them while pushing the odd number right after each
+        for (int i = 0; i < elements; ++i) {
+          AssertThat(pq.has_top(), Is().True());
+          AssertThat(pq.top(), Is().EqualTo(2 * i));
+          pq.pop();
+
+          pq.push(2 * i + 1);
+          AssertThat(pq.top(), Is().EqualTo(2 * i + 1));
+          pq.pop();
+        }
+        AssertThat(pq.has_top(), Is().False());
+      });
+    });
+  });
+});
@@ -0,0 +1,227 @@
+#include "../../../test.h"
+
+#include <adiar/internal/data_structures/result_cache.h>
+
+go_bandit([]() {
+  describe("adiar/internal/data_structures/result_cache.h", []() {
+    using operation = result_cache::operation;
+
+    const bdd x0 = bdd_ithvar(0);
+    const bdd x1 = bdd_ithvar(1);
+    const bdd x2 = bdd_ithvar(2);
+
+    const bdd x0_and_x1 = bdd_and(x0, x1);
+    const bdd x0_or_x1  = bdd_or(x0, x1);
+
+    it("is initially disabled", [&]() {
+      result_cache c;
+      AssertThat(c.enabled(), Is().False());
+
+      c.insert<2>(operation::Apply, 0b1000, { &x0, &x1 }, x0_and_x1);
+      AssertThat(c.size(), Is().EqualTo(0u));
+    });
+
+    it("returns an inserted result", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+      AssertThat(c.enabled(), Is().True());
+
+      c.insert<2>(operation::Apply, 0b1000, { &x0, &x1 }, x0_and_x1);
+      AssertThat(c.size(), Is().EqualTo(1u));
+
+      const auto [file, negate, shift] = c.lookup<2>(operation::Apply, 0b1000, { &x0, &x1 });
+      AssertThat(file.get(), Is().EqualTo(x0_and_x1.file_ptr().get()));
+      AssertThat(negate, Is().EqualTo(x0_and_x1.is_negated()));
+      AssertThat(shift, Is().EqualTo(x0_and_x1.shift()));
+    });
+
+    it("remembers the negation flag of the result", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      const bdd x0_nand_x1 = ~x0_and_x1;
+      c.insert<2>(operation::Apply, 0b0111, { &x0, &x1 }, x0_nand_x1);
+
+      const auto [file, negate, shift] = c.lookup<2>(operation::Apply, 0b0111, { &x0, &x1 });
+      AssertThat(file.get(), Is().EqualTo(x0_and_x1.file_ptr().get()));
+      AssertThat(negate, Is().True());
+    });
+
+    it("misses on another operator", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      c.insert<2>(operation::Apply, 0b1000, { &x0, &x1 }, x0_and_x1);
+
+      const auto [file, negate, shift] = c.lookup<2>(operation::Apply, 0b1110, { &x0, &x1 });
+      AssertThat(file.get(), Is().Null());
+    });
+
+    it("misses on another operation", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      c.insert<2>(operation::Apply, 0u, { &x0, &x1 }, x0_and_x1);
+
+      const auto [file, negate, shift] = c.lookup<2>(operation::Relnext, 0u, { &x0, &x1 });
+      AssertThat(file.get(), Is().Null());
+    });
+
+    it("misses on swapped operands", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      c.insert<2>(operation::Apply, 0b0010, { &x0, &x1 }, x0_and_x1);
+
+      const auto [file, negate, shift] = c.lookup<2>(operation::Apply, 0b0010, { &x1, &x0 });
+      AssertThat(file.get(), Is().Null());
+    });
+
+    it("misses on a negated operand", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      c.insert<2>(operation::Apply, 0b1000, { &x0, &x1 }, x0_and_x1);
+
+      const bdd not_x1 = ~x1;
+      const auto [file, negate, shift] = c.lookup<2>(operation::Apply, 0b1000, { &x0, &not_x1 });
+      AssertThat(file.get(), Is().Null());
+    });
+
+    it("evicts the least recently used entry", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      c.insert<2>(operation::Apply, 0b1000, { &x0, &x1 }, x0_and_x1);
+      c.insert<2>(operation::Apply, 0b1110, { &x0, &x1 }, x0_or_x1);
+
+      // Use the first entry, making the second the least recently used.
+      c.lookup<2>(operation::Apply, 0b1000, { &x0, &x1 });
+
+      const bdd top = bdd_top();
+      c.insert<1>(operation::Exists, 2u, { &x2 }, top);
+      AssertThat(c.size(), Is().EqualTo(2u));
+
+      AssertThat(std::get<0>(c.lookup<2>(operation::Apply, 0b1000, { &x0, &x1 })).get(),
+                 Is().Not().Null());
+      AssertThat(std::get<0>(c.lookup<2>(operation::Apply, 0b1110, { &x0, &x1 })).get(),
+                 Is().Null());
+      AssertThat(std::get<0>(c.lookup<1>(operation::Exists, 2u, { &x2 })).get(),
+                 Is().Not().Null());
+    });
+
+    it("evicts entries when the capacity is decreased", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      c.insert<2>(operation::Apply, 0b1000, { &x0, &x1 }, x0_and_x1);
+      c.insert<2>(operation::Apply, 0b1110, { &x0, &x1 }, x0_or_x1);
+      AssertThat(c.size(), Is().EqualTo(2u));
+
+      c.set_capacity(1u);
+      AssertThat(c.size(), Is().EqualTo(1u));
+      AssertThat(std::get<0>(c.lookup<2>(operation::Apply, 0b1110, { &x0, &x1 })).get(),
+                 Is().Not().Null());
+    });
+
+    it("does not keep the result alive", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      std::weak_ptr<result_cache::node_file_type> result_file;
+      {
+        const bdd x0_xor_x1 = bdd_xor(x0, x1);
+        result_file         = x0_xor_x1.file_ptr();
+
+        c.insert<2>(operation::Apply, 0b0110, { &x0, &x1 }, x0_xor_x1);
+      }
+      AssertThat(result_file.expired(), Is().True());
+
+      const auto [file, negate, shift] = c.lookup<2>(operation::Apply, 0b0110, { &x0, &x1 });
+      AssertThat(file.get(), Is().Null());
+      AssertThat(c.size(), Is().EqualTo(0u));
+    });
+
+    it("does not return results for garbage collected operands", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      {
+        const bdd x3  = bdd_ithvar(3);
+        const bdd bot = bdd_bot();
+        c.insert<1>(operation::Forall, 3u, { &x3 }, bot);
+      }
+      AssertThat(c.size(), Is().EqualTo(1u));
+
+      // A new operand may reuse the address of the old one.
+      const bdd x3 = bdd_ithvar(3);
+      AssertThat(std::get<0>(c.lookup<1>(operation::Forall, 3u, { &x3 })).get(), Is().Null());
+    });
+
+    it("can be cleared", [&]() {
+      result_cache c;
+      c.set_capacity(2u);
+
+      c.insert<2>(operation::Apply, 0b1000, { &x0, &x1 }, x0_and_x1);
+      c.clear();
+
+      AssertThat(c.size(), Is().EqualTo(0u));
+      AssertThat(c.enabled(), Is().True());
+    });
+
+    describe("adiar_cache_init(...)", [&]() {
+      it("reuses the result of 'bdd_and(...)'", [&]() {
+        adiar_cache_init(1024 * 1024);
+
+        const bdd out_1 = bdd_and(x0, x2);
+        const bdd out_2 = bdd_and(x0, x2);
+
+        AssertThat(out_1.file_ptr(), Is().EqualTo(out_2.file_ptr()));
+
+        adiar_cache_deinit();
+      });
+
+      it("does not reuse the result of 'bdd_and(...)' after 'adiar_cache_deinit()'", [&]() {
+        const bdd out_1 = bdd_and(x0, x2);
+        const bdd out_2 = bdd_and(x0, x2);
+
+        AssertThat(out_1.file_ptr(), Is().Not().EqualTo(out_2.file_ptr()));
+      });
+
+      it("reuses the result of 'bdd_ite(...)'", [&]() {
+        adiar_cache_init(1024 * 1024);
+
+        const bdd out_1 = bdd_ite(x0, x1, x2);
+        const bdd out_2 = bdd_ite(x0, x1, x2);
+
+        AssertThat(out_1.file_ptr(), Is().EqualTo(out_2.file_ptr()));
+
+        adiar_cache_deinit();
+      });
+
+      it("reuses the result of 'bdd_exists(...)'", [&]() {
+        adiar_cache_init(1024 * 1024);
+
+        const bdd out_1 = bdd_exists(x0_and_x1, 1);
+        const bdd out_2 = bdd_exists(x0_and_x1, 1);
+
+        AssertThat(out_1.file_ptr(), Is().EqualTo(out_2.file_ptr()));
+
+        adiar_cache_deinit();
+      });
+
+      it("is bypassed when piping results", [&]() {
+        adiar_cache_init(1024 * 1024);
+
+        const exec_policy ep = exec_policy::chain::Pipe;
+
+        const bdd out_1 = bdd_and(ep, x0, x2);
+        const bdd out_2 = bdd_and(ep, x0, x2);
+
+        AssertThat(out_1.file_ptr(), Is().Not().EqualTo(out_2.file_ptr()));
+
+        adiar_cache_deinit();
+      });
+    });
+  });
+});
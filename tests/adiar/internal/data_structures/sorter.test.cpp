@@ -86,6 +86,79 @@ go_bandit([]() {
       });
     });
 
+    describe("sorter<memory_mode::Internal, int, std::less<>> [presort]", []() {
+      it("can sort a prefix ahead of pushing the rest", []() {
+        sorter<memory_mode::Internal, int, std::less<>> s(1024, 16);
+        int buffer[16];
+
+        s.push(5);
+        s.push(2);
+        s.push(7);
+        s.presort(3, buffer);
+        AssertThat(s.presorted(), Is().EqualTo(3u));
+
+        s.push(1);
+        s.push(6);
+        s.push(2);
+        s.sort(buffer);
+        AssertThat(s.presorted(), Is().EqualTo(6u));
+
+        AssertThat(s.pull(), Is().EqualTo(1));
+        AssertThat(s.pull(), Is().EqualTo(2));
+        AssertThat(s.pull(), Is().EqualTo(2));
+        AssertThat(s.pull(), Is().EqualTo(5));
+        AssertThat(s.pull(), Is().EqualTo(6));
+        AssertThat(s.pull(), Is().EqualTo(7));
+        AssertThat(s.can_pull(), Is().False());
+      });
+
+      it("can merge multiple presorted parts", []() {
+        sorter<memory_mode::Internal, int, std::less<>> s(1024, 16);
+        int buffer[16];
+
+        s.push(8);
+        s.push(3);
+        s.presort(2, buffer);
+
+        s.push(9);
+        s.push(1);
+        s.presort(4, buffer);
+
+        s.push(4);
+        s.presort(5, buffer);
+        AssertThat(s.presorted(), Is().EqualTo(5u));
+
+        s.sort(buffer);
+
+        AssertThat(s.pull(), Is().EqualTo(1));
+        AssertThat(s.pull(), Is().EqualTo(3));
+        AssertThat(s.pull(), Is().EqualTo(4));
+        AssertThat(s.pull(), Is().EqualTo(8));
+        AssertThat(s.pull(), Is().EqualTo(9));
+        AssertThat(s.can_pull(), Is().False());
+      });
+
+      it("forgets what was presorted on .reset()", []() {
+        sorter<memory_mode::Internal, int, std::less<>> s(1024, 16);
+        int buffer[16];
+
+        s.push(2);
+        s.push(1);
+        s.presort(2, buffer);
+        s.sort(buffer);
+        s.reset();
+        AssertThat(s.presorted(), Is().EqualTo(0u));
+
+        s.push(4);
+        s.push(3);
+        s.sort();
+
+        AssertThat(s.pull(), Is().EqualTo(3));
+        AssertThat(s.pull(), Is().EqualTo(4));
+        AssertThat(s.can_pull(), Is().False());
+      });
+    });
+
     describe("sorter<memory_mode::External, int, std::less<>>", []() {
       sorter<memory_mode::External, int, std::less<>> s(8 * 1024 * 1024, 16);
 
@@ -150,6 +223,99 @@ go_bandit([]() {
       });
     });
 
+    describe("sorter<memory_mode::Adaptive, int, std::less<>>", []() {
+      it("stays in internal memory if all elements fit", []() {
+        sorter<memory_mode::Adaptive, int, std::less<>> s(8 * 1024 * 1024, 16);
+
+        AssertThat(s.empty(), Is().True());
+
+        s.push(2);
+        s.push(4);
+        s.push(3);
+        s.push(1);
+        AssertThat(s.size(), Is().EqualTo(4u));
+
+        s.sort();
+        AssertThat(s.is_spilled(), Is().False());
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.top(), Is().EqualTo(1));
+        AssertThat(s.pull(), Is().EqualTo(1));
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.pull(), Is().EqualTo(2));
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.pull(), Is().EqualTo(3));
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.pull(), Is().EqualTo(4));
+
+        AssertThat(s.can_pull(), Is().False());
+      });
+
+      it("moves to external memory when pushing beyond its bound", []() {
+        sorter<memory_mode::Adaptive, int, std::less<>> s(8 * 1024 * 1024, 3);
+
+        s.push(5);
+        s.push(2);
+        s.push(4);
+        AssertThat(s.is_spilled(), Is().False());
+
+        s.push(1);
+        AssertThat(s.is_spilled(), Is().True());
+
+        s.push(3);
+        AssertThat(s.size(), Is().EqualTo(5u));
+
+        s.sort();
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.top(), Is().EqualTo(1));
+        AssertThat(s.pull(), Is().EqualTo(1));
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.pull(), Is().EqualTo(2));
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.pull(), Is().EqualTo(3));
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.pull(), Is().EqualTo(4));
+
+        AssertThat(s.can_pull(), Is().True());
+        AssertThat(s.pull(), Is().EqualTo(5));
+
+        AssertThat(s.can_pull(), Is().False());
+      });
+
+      it("is resized by 'reset_unique' with a larger bound", []() {
+        using sorter_t = sorter<memory_mode::Adaptive, int, std::less<>>;
+
+        unique_ptr<sorter_t> s = sorter_t::make_unique(8 * 1024 * 1024, 2);
+        s->push(2);
+        s->push(1);
+        s->sort();
+        AssertThat(s->is_spilled(), Is().False());
+
+        sorter_t::reset_unique(s, 8 * 1024 * 1024, 4);
+        AssertThat(s->empty(), Is().True());
+
+        s->push(4);
+        s->push(3);
+        s->push(2);
+        s->push(1);
+        AssertThat(s->is_spilled(), Is().False());
+
+        s->sort();
+        for (int i = 1; i <= 4; ++i) {
+          AssertThat(s->can_pull(), Is().True());
+          AssertThat(s->pull(), Is().EqualTo(i));
+        }
+        AssertThat(s->can_pull(), Is().False());
+      });
+    });
+
     describe("sorter<memory_mode::Internal, int, std::greater<>>", []() {
       sorter<memory_mode::Internal, int, std::greater<>> s(1024, 16);
 
@@ -78,6 +78,26 @@ go_bandit([]() {
           i -= 1;
         }
       });
+
+      it("can push beyond its capacity", []() {
+        vector<memory_mode::Internal, int> w(2);
+
+        for (int i = 0; i < 5; ++i) { w.push_back(i); }
+
+        AssertThat(w.size(), Is().EqualTo(5u));
+        AssertThat(w.capacity(), Is().GreaterThanOrEqualTo(5u));
+
+        for (int i = 0; i < 5; ++i) { AssertThat(w[i], Is().EqualTo(i)); }
+        AssertThat(*w.rbegin(), Is().EqualTo(4));
+      });
+
+      it("can push onto an initially empty vector", []() {
+        vector<memory_mode::Internal, int> w;
+        w.push_back(42);
+
+        AssertThat(w.size(), Is().EqualTo(1u));
+        AssertThat(w.front(), Is().EqualTo(42));
+      });
     });
 
     describe("vector<memory_mode::External, int>", []() {
@@ -0,0 +1,72 @@
+#include "../../../test.h"
+
+#include <adiar/internal/data_types/node_uint32.h>
+
+go_bandit([]() {
+  describe("adiar/internal/data_types/node_uint32.h", []() {
+    it("should take up half the space of a 'node'",
+       [&]() { AssertThat(2u * sizeof(node_uint32), Is().EqualTo(sizeof(node))); });
+
+    describe("fits_uint32(n)", []() {
+      it("accepts terminal nodes", [&]() {
+        AssertThat(fits_uint32(node(false)), Is().True());
+        AssertThat(fits_uint32(node(true)), Is().True());
+      });
+
+      it("accepts nodes of small diagrams", [&]() {
+        const node n = node(1u,
+                            node::max_id - ptr_uint32::max_id,
+                            ptr_uint64(false),
+                            ptr_uint64(ptr_uint32::max_label, node::max_id));
+
+        AssertThat(fits_uint32(n), Is().True());
+      });
+
+      it("rejects nodes with too large labels", [&]() {
+        // With `ADIAR_LEVEL_BITS` set to 14, all labels fit.
+        if (node::max_label <= ptr_uint32::max_label) { return; }
+
+        const node n =
+          node(ptr_uint32::max_label + 1u, node::max_id, ptr_uint64(false), ptr_uint64(true));
+
+        AssertThat(fits_uint32(n), Is().False());
+      });
+
+      it("rejects nodes with too large level widths", [&]() {
+        const node n1 = node(1u, 0u, ptr_uint64(false), ptr_uint64(true));
+        AssertThat(fits_uint32(n1), Is().False());
+
+        const node n2 = node(1u, node::max_id, ptr_uint64(false), ptr_uint64(2u, 0u));
+        AssertThat(fits_uint32(n2), Is().False());
+      });
+
+      it("rejects nodes with numeric terminals", [&]() {
+        const node n = node(1u, node::max_id, ptr_uint64(false), ptr_uint64::numeric_terminal(2u));
+        AssertThat(fits_uint32(n), Is().False());
+      });
+    });
+
+    describe("narrow(n) / widen(n)", []() {
+      it("preserves terminal nodes", [&]() {
+        AssertThat(widen(narrow(node(false))), Is().EqualTo(node(false)));
+        AssertThat(widen(narrow(node(true))), Is().EqualTo(node(true)));
+      });
+
+      it("preserves internal nodes", [&]() {
+        const node n =
+          node(1u, node::max_id - 42u, ptr_uint64(false), ptr_uint64(2u, node::max_id - 7u));
+
+        AssertThat(widen(narrow(n)), Is().EqualTo(n));
+      });
+
+      it("preserves flagged children", [&]() {
+        const node n = node(0u,
+                            node::max_id - ptr_uint32::max_id,
+                            flag(ptr_uint64(true)),
+                            ptr_uint64(1u, node::max_id));
+
+        AssertThat(widen(narrow(n)), Is().EqualTo(n));
+      });
+    });
+  });
+});
@@ -6,6 +6,16 @@ go_bandit([]() {
       it("should take up same amount of space as a 'uint64_t'",
          [&]() { AssertThat(sizeof(ptr_uint64), Is().EqualTo(sizeof(uint64_t))); });
 
+      it("has 'ADIAR_LEVEL_BITS' bits for the level", [&]() {
+        const uint64_t levels = 1ull << ADIAR_LEVEL_BITS;
+        AssertThat(ptr_uint64::max_label + 3u, Is().EqualTo(levels));
+      });
+
+      it("has the remaining bits for the level identifier", [&]() {
+        const uint64_t ids = 1ull << (64u - ADIAR_LEVEL_BITS - 2u);
+        AssertThat(ptr_uint64::max_id + 1u, Is().EqualTo(ids));
+      });
+
       describe("nil", [&]() {
         describe(".is_flagged() and flag(...)/unflag(...)", []() {
           it("is not flagged by default",
@@ -174,6 +184,51 @@ go_bandit([]() {
           });
         });
 
+        describe("numeric_terminal(...), .numeric_value()", []() {
+          it("coincides with 'false' terminal for 0", [&]() {
+            const ptr_uint64 p = ptr_uint64::numeric_terminal(0u);
+
+            AssertThat(p, Is().EqualTo(ptr_uint64(false)));
+            AssertThat(p.numeric_value(), Is().EqualTo(0u));
+          });
+
+          it("coincides with 'true' terminal for 1", [&]() {
+            const ptr_uint64 p = ptr_uint64::numeric_terminal(1u);
+
+            AssertThat(p, Is().EqualTo(ptr_uint64(true)));
+            AssertThat(p.numeric_value(), Is().EqualTo(1u));
+          });
+
+          it("retrieves value from '42' terminal", [&]() {
+            const ptr_uint64 p = ptr_uint64::numeric_terminal(42u);
+
+            AssertThat(p.is_terminal(), Is().True());
+            AssertThat(p.numeric_value(), Is().EqualTo(42u));
+            AssertThat(flag(p).numeric_value(), Is().EqualTo(42u));
+          });
+
+          it("retrieves value from maximal terminal", [&]() {
+            using numeric_type = ptr_uint64::numeric_type;
+
+            const numeric_type max = std::numeric_limits<numeric_type>::max();
+            const ptr_uint64 p     = ptr_uint64::numeric_terminal(max);
+
+            AssertThat(p.is_terminal(), Is().True());
+            AssertThat(p.numeric_value(), Is().EqualTo(max));
+          });
+
+          it("is non-zero according to '.value()'", [&]() {
+            AssertThat(ptr_uint64::numeric_terminal(42u).value(), Is().True());
+          });
+
+          it("is ordered by value", [&]() {
+            const ptr_uint64 p2 = ptr_uint64::numeric_terminal(2u);
+            const ptr_uint64 p3 = ptr_uint64::numeric_terminal(3u);
+
+            AssertThat(p2, Is().LessThan(p3));
+          });
+        });
+
         describe(".is_false()", []() {
           it("accepts 'false' terminal", [&]() {
             const ptr_uint64 p = ptr_uint64(false);
@@ -0,0 +1,135 @@
+#include "../../../test.h"
+
+#include <adiar/internal/data_types/ptr_uint32.h>
+
+go_bandit([]() {
+  describe("adiar/internal/data_types/ptr_uint32.h", []() {
+    it("should take up same amount of space as a 'uint32_t'",
+       [&]() { AssertThat(sizeof(ptr_uint32), Is().EqualTo(sizeof(uint32_t))); });
+
+    it("has 2^16 level identifiers",
+       [&]() { AssertThat(ptr_uint32::max_id, Is().EqualTo(65535u)); });
+
+    describe("nil", []() {
+      it("is nil", [&]() { AssertThat(ptr_uint32::nil().is_nil(), Is().True()); });
+
+      it("is not a terminal", [&]() { AssertThat(ptr_uint32::nil().is_terminal(), Is().False()); });
+
+      it("is not a node", [&]() { AssertThat(ptr_uint32::nil().is_node(), Is().False()); });
+    });
+
+    describe("terminals", []() {
+      it("has the given value", [&]() {
+        AssertThat(ptr_uint32(false).is_terminal(), Is().True());
+        AssertThat(ptr_uint32(false).value(), Is().False());
+
+        AssertThat(ptr_uint32(true).is_terminal(), Is().True());
+        AssertThat(ptr_uint32(true).value(), Is().True());
+      });
+
+      it("is sorted after nodes and before nil", [&]() {
+        const ptr_uint32 n = ptr_uint32(ptr_uint32::max_label, ptr_uint32::max_id, 1u);
+
+        AssertThat(n, Is().LessThan(ptr_uint32(false)));
+        AssertThat(ptr_uint32(false), Is().LessThan(ptr_uint32(true)));
+        AssertThat(ptr_uint32(true), Is().LessThan(ptr_uint32::nil()));
+      });
+    });
+
+    describe("nodes", []() {
+      it("stores label, id, and out-index", [&]() {
+        const ptr_uint32 p = ptr_uint32(42u, 1337u, 1u);
+
+        AssertThat(p.is_node(), Is().True());
+        AssertThat(p.label(), Is().EqualTo(42u));
+        AssertThat(p.id(), Is().EqualTo(1337u));
+        AssertThat(p.out_idx(), Is().EqualTo(1u));
+        AssertThat(p.is_flagged(), Is().False());
+      });
+
+      it("is sorted by label first and id second", [&]() {
+        AssertThat(ptr_uint32(0u, ptr_uint32::max_id), Is().LessThan(ptr_uint32(1u, 0u)));
+        AssertThat(ptr_uint32(1u, 0u), Is().LessThan(ptr_uint32(1u, 1u)));
+      });
+    });
+
+    describe("fits_uint32(p)", []() {
+      it("accepts terminals and nil", [&]() {
+        AssertThat(fits_uint32(ptr_uint64(false)), Is().True());
+        AssertThat(fits_uint32(ptr_uint64(true)), Is().True());
+        AssertThat(fits_uint32(ptr_uint64::nil()), Is().True());
+      });
+
+      it("accepts small nodes", [&]() {
+        AssertThat(fits_uint32(ptr_uint64(ptr_uint32::max_label, ptr_uint64::max_id)),
+                   Is().True());
+        AssertThat(
+          fits_uint32(ptr_uint64(ptr_uint32::max_label, ptr_uint64::max_id - ptr_uint32::max_id)),
+          Is().True());
+      });
+
+      it("rejects numeric terminals", [&]() {
+        AssertThat(fits_uint32(ptr_uint64::numeric_terminal(2u)), Is().False());
+        AssertThat(fits_uint32(ptr_uint64::numeric_terminal(42u)), Is().False());
+      });
+
+      it("rejects too large labels", [&]() {
+        // With `ADIAR_LEVEL_BITS` set to 14, all labels fit.
+        if (ptr_uint64::max_label <= ptr_uint32::max_label) { return; }
+
+        AssertThat(fits_uint32(ptr_uint64(ptr_uint32::max_label + 1u, ptr_uint64::max_id)),
+                   Is().False());
+      });
+
+      it("rejects too many ids on a level", [&]() {
+        AssertThat(fits_uint32(ptr_uint64(0u, ptr_uint64::max_id - ptr_uint32::max_id - 1u)),
+                   Is().False());
+        AssertThat(fits_uint32(ptr_uint64(0u, 0u)), Is().False());
+      });
+    });
+
+    describe("narrow(p) / widen(p)", []() {
+      it("preserves nil", [&]() {
+        AssertThat(widen(narrow(ptr_uint64::nil())), Is().EqualTo(ptr_uint64::nil()));
+        AssertThat(narrow(ptr_uint64::nil()).is_nil(), Is().True());
+      });
+
+      it("preserves terminals", [&]() {
+        AssertThat(widen(narrow(ptr_uint64(false))), Is().EqualTo(ptr_uint64(false)));
+        AssertThat(widen(narrow(ptr_uint64(true))), Is().EqualTo(ptr_uint64(true)));
+      });
+
+      it("preserves flags", [&]() {
+        const ptr_uint64 p = ptr_uint64(3u, ptr_uint64::max_id - 2u);
+
+        AssertThat(widen(narrow(flag(ptr_uint64(true)))), Is().EqualTo(flag(ptr_uint64(true))));
+        AssertThat(widen(narrow(flag(p))), Is().EqualTo(flag(p)));
+      });
+
+      it("preserves nodes with out-index", [&]() {
+        const ptr_uint64 p = ptr_uint64(ptr_uint32::max_label, ptr_uint64::max_id, 1u);
+        AssertThat(widen(narrow(p)), Is().EqualTo(p));
+
+        const ptr_uint64 q = ptr_uint64(2u, ptr_uint64::max_id - ptr_uint32::max_id, 1u);
+        AssertThat(widen(narrow(q)), Is().EqualTo(q));
+      });
+
+      it("counts down the ids from the maximal id", [&]() {
+        AssertThat(narrow(ptr_uint64(1u, ptr_uint64::max_id)).id(),
+                   Is().EqualTo(ptr_uint32::max_id));
+        AssertThat(narrow(ptr_uint64(1u, ptr_uint64::max_id - 1u)).id(),
+                   Is().EqualTo(ptr_uint32::max_id - 1u));
+      });
+
+      it("preserves the ordering", [&]() {
+        const ptr_uint64 p = ptr_uint64(1u, ptr_uint64::max_id - 1u);
+        const ptr_uint64 q = ptr_uint64(1u, ptr_uint64::max_id);
+        const ptr_uint64 r = ptr_uint64(2u, ptr_uint64::max_id - 1u);
+
+        AssertThat(narrow(p), Is().LessThan(narrow(q)));
+        AssertThat(narrow(q), Is().LessThan(narrow(r)));
+        AssertThat(narrow(r), Is().LessThan(narrow(ptr_uint64(false))));
+      });
+    });
+  });
+});
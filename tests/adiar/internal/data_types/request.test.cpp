@@ -854,5 +854,56 @@ go_bandit([]() {
         });
       });
     });
+
+    describe("request_first_key", []() {
+      it("is consistent with 'request_data_first_lt' on request_data<with_parent>", []() {
+        using rt2 = request_data<2, with_parent>;
+
+        const std::vector<rt2> reqs = {
+          { { rt2::pointer_type(1, 0), rt2::pointer_type(2, 0) }, {}, { rt2::pointer_type(0, 0) } },
+          { { rt2::pointer_type(2, 1), rt2::pointer_type(1, 0) }, {}, { rt2::pointer_type(0, 0) } },
+          { { rt2::pointer_type(1, 1), rt2::pointer_type(1, 0) }, {}, { rt2::pointer_type(0, 1) } },
+          { { rt2::pointer_type(1, 1), rt2::pointer_type(1, 0) }, {}, { rt2::pointer_type(0, 0) } },
+          { { rt2::pointer_type(3, 0), rt2::pointer_type(true) }, {}, { rt2::pointer_type(2, 0) } },
+          { { rt2::pointer_type(false), rt2::pointer_type(2, 3) },
+            {},
+            { rt2::pointer_type(1, 0) } },
+          { { rt2::pointer_type(2, 0), rt2::pointer_type(2, 0) }, {}, { rt2::pointer_type(1, 0) } },
+        };
+
+        request_data_first_lt<rt2> lt;
+        const request_first_key<rt2> key;
+
+        for (const rt2& a : reqs) {
+          for (const rt2& b : reqs) {
+            if (key(a) < key(b)) { AssertThat(lt(a, b), Is().True()); }
+            if (lt(a, b)) { AssertThat(key(a), Is().LessThanOrEqualTo(key(b))); }
+          }
+        }
+      });
+
+      it("is consistent with 'request_data_first_lt' on request_data<with_level>", []() {
+        using rt2 = request_data<2, with_level>;
+
+        const std::vector<rt2> reqs = {
+          { { rt2::pointer_type(4, 2), rt2::pointer_type(3, 0) }, {}, { 2 } },
+          { { rt2::pointer_type(4, 0), rt2::pointer_type(4, 1) }, {}, { 2 } },
+          { { rt2::pointer_type(3, 1), rt2::pointer_type(5, 0) }, {}, { with_level::no_level } },
+          { { rt2::pointer_type(3, 0), rt2::pointer_type(3, 0) }, {}, { 1 } },
+          { { rt2::pointer_type(2, 5), rt2::pointer_type(true) }, {}, { 7 } },
+          { { rt2::pointer_type(2, 4), rt2::pointer_type(3, 2) }, {}, { with_level::no_level } },
+        };
+
+        request_data_first_lt<rt2> lt;
+        const request_first_key<rt2> key;
+
+        for (const rt2& a : reqs) {
+          for (const rt2& b : reqs) {
+            if (key(a) < key(b)) { AssertThat(lt(a, b), Is().True()); }
+            if (lt(a, b)) { AssertThat(key(a), Is().LessThanOrEqualTo(key(b))); }
+          }
+        }
+      });
+    });
   });
 });
@@ -464,7 +464,6 @@ go_bandit([]() {
         AssertThat(ns.can_pull(), Is().True());
       });
 
-      /*
       it("can read single-node BDD [negated]", [&]() {
         narc_ifstream ns(x0_ordered, true);
 
@@ -474,7 +473,16 @@ go_bandit([]() {
 
         AssertThat(ns.can_pull(), Is().False());
       });
-      */
+
+      it("can read single-node BDD [shifted]", [&]() {
+        narc_ifstream ns(x0_ordered, false, +2);
+
+        AssertThat(ns.can_pull(), Is().True());
+        AssertThat(ns.pull(),
+                   Is().EqualTo(node(2, 0, node::pointer_type(false), node::pointer_type(true))));
+
+        AssertThat(ns.can_pull(), Is().False());
+      });
 
       it("can pull after peek of single-node BDD", [&]() {
         narc_ifstream ns(x0_ordered);
@@ -752,7 +760,6 @@ go_bandit([]() {
         AssertThat(ns.can_pull(), Is().False());
       });
 
-      /*
       it("can pull larger BDD [negated + reverse]", [&]() {
         AssertThat(large_untransposed2.semi_transposed, Is().False());
 
@@ -780,7 +787,6 @@ go_bandit([]() {
 
         AssertThat(ns.can_pull(), Is().False());
       });
-      */
     });
 
     describe("arc_ofstream + narc_raccess", []() {
@@ -1,5 +1,6 @@
 #include "../../../test.h"
 #include <filesystem>
+#include <vector>
 
 #include <adiar/internal/io/file.h>
 #include <adiar/internal/io/ifstream.h>
@@ -1321,5 +1322,1195 @@ go_bandit([]() {
         std::filesystem::remove(path);
       });
     });
+
+    describe("file() [in-memory]", []() {
+      it("is on disk if no memory is set aside", []() {
+        file<int> f;
+        AssertThat(f.is_in_memory(), Is().False());
+      });
+
+      it("is in memory and only 'exists' after being touched", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f;
+
+          AssertThat(f.is_in_memory(), Is().True());
+          AssertThat(f.exists(), Is().False());
+
+          f.touch();
+          AssertThat(f.exists(), Is().True());
+          AssertThat(std::filesystem::exists(f.path()), Is().False());
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("'exists' after being written to", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f;
+          { ofstream<int> fw(f); }
+
+          AssertThat(f.exists(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(0u));
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("can be written to and read from", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 1 << 2 << 3;
+            AssertThat(fw.size(), Is().EqualTo(3u));
+          }
+          AssertThat(f.is_in_memory(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(3u));
+
+          ifstream<int> fs(f);
+          AssertThat(fs.can_pull(), Is().True());
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.peek(), Is().EqualTo(2));
+          AssertThat(fs.pull(), Is().EqualTo(2));
+          AssertThat(fs.pull(), Is().EqualTo(3));
+          AssertThat(fs.can_pull(), Is().False());
+
+          ifstream<int, true> fs_r(f);
+          AssertThat(fs_r.pull(), Is().EqualTo(3));
+          AssertThat(fs_r.pull(), Is().EqualTo(2));
+          AssertThat(fs_r.pull(), Is().EqualTo(1));
+          AssertThat(fs_r.can_pull(), Is().False());
+
+          AssertThat(std::filesystem::exists(f.path()), Is().False());
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("gives back its memory when destructed", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f;
+          ofstream<int> fw(f);
+          fw << 1;
+          AssertThat(global_memory_file_pool.used(), Is().GreaterThan(0u));
+        }
+        AssertThat(global_memory_file_pool.used(), Is().EqualTo(0u));
+        adiar_memfile_deinit();
+      });
+
+      it("spills to disk when outgrowing the per-file limit", []() {
+        adiar_memfile_init(1024 * 1024, 64 * sizeof(int));
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            for (int i = 0; i < 1000; ++i) { fw << i; }
+            AssertThat(fw.size(), Is().EqualTo(1000u));
+          }
+          AssertThat(f.is_in_memory(), Is().False());
+          AssertThat(std::filesystem::exists(f.path()), Is().True());
+          AssertThat(f.size(), Is().EqualTo(1000u));
+          AssertThat(global_memory_file_pool.used(), Is().EqualTo(0u));
+
+          ifstream<int> fs(f);
+          for (int i = 0; i < 1000; ++i) { AssertThat(fs.pull(), Is().EqualTo(i)); }
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("spills to disk when the old and the grown buffer do not fit at the same time", []() {
+        // 16 elements fit, but growing to 32 needs 16 + 32 of them at the same time.
+        adiar_memfile_init(40 * sizeof(int), 1024 * 1024);
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            for (int i = 0; i < 16; ++i) { fw << i; }
+            AssertThat(f.is_in_memory(), Is().True());
+            AssertThat(global_memory_file_pool.used(), Is().EqualTo(16u * sizeof(int)));
+
+            fw << 16;
+          }
+          AssertThat(f.is_in_memory(), Is().False());
+          AssertThat(f.size(), Is().EqualTo(17u));
+          AssertThat(global_memory_file_pool.used(), Is().EqualTo(0u));
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("spills to disk when the memory set aside runs out", []() {
+        adiar_memfile_init(64 * sizeof(int), 1024 * 1024);
+        {
+          file<int> f1;
+          {
+            ofstream<int> fw(f1);
+            for (int i = 0; i < 32; ++i) { fw << i; }
+          }
+          AssertThat(f1.is_in_memory(), Is().True());
+
+          file<int> f2;
+          {
+            ofstream<int> fw(f2);
+            for (int i = 0; i < 64; ++i) { fw << i; }
+          }
+          AssertThat(f1.is_in_memory(), Is().True());
+          AssertThat(f2.is_in_memory(), Is().False());
+          AssertThat(f2.size(), Is().EqualTo(64u));
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("can be sorted", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 3 << 1 << 2;
+          }
+          f.sort();
+          AssertThat(f.is_in_memory(), Is().True());
+
+          ifstream<int> fs(f);
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.pull(), Is().EqualTo(2));
+          AssertThat(fs.pull(), Is().EqualTo(3));
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("can be copied", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f1;
+          {
+            ofstream<int> fw(f1);
+            fw << 1 << 2;
+          }
+          file<int> f2 = file<int>::copy(f1);
+          AssertThat(f2.is_in_memory(), Is().True());
+          AssertThat(f2.size(), Is().EqualTo(2u));
+
+          ifstream<int> fs(f2);
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.pull(), Is().EqualTo(2));
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("is moved to disk when made persistent", []() {
+        adiar_memfile_init(1024 * 1024);
+        std::string path;
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 1 << 2;
+          }
+          f.make_persistent();
+          AssertThat(f.is_in_memory(), Is().False());
+          AssertThat(std::filesystem::exists(f.path()), Is().True());
+          AssertThat(f.size(), Is().EqualTo(2u));
+          path = f.path();
+        }
+        AssertThat(std::filesystem::exists(path), Is().True());
+        std::filesystem::remove(path);
+        adiar_memfile_deinit();
+      });
+
+      it("keeps a reader valid when spilled", []() {
+        adiar_memfile_init(1024 * 1024);
+        std::string path;
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 1 << 2 << 3;
+          }
+
+          ifstream<int> fs(f);
+          AssertThat(fs.pull(), Is().EqualTo(1));
+
+          f.make_persistent();
+          path = f.path();
+          AssertThat(f.is_in_memory(), Is().False());
+
+          // The memory is kept until the reader is done with it.
+          AssertThat(global_memory_file_pool.used(), Is().GreaterThan(0u));
+
+          ifstream<int> fs_disk(f);
+          AssertThat(fs_disk.pull(), Is().EqualTo(1));
+
+          AssertThat(fs.pull(), Is().EqualTo(2));
+          AssertThat(fs.pull(), Is().EqualTo(3));
+          AssertThat(fs.can_pull(), Is().False());
+
+          fs.close();
+          AssertThat(global_memory_file_pool.used(), Is().EqualTo(0u));
+
+          AssertThat(fs_disk.pull(), Is().EqualTo(2));
+          AssertThat(fs_disk.pull(), Is().EqualTo(3));
+        }
+        std::filesystem::remove(path);
+        adiar_memfile_deinit();
+      });
+
+      it("keeps a reader of a BDD valid when it is persisted", []() {
+        adiar_memfile_init(1024 * 1024);
+        const std::string path = tpie::tempname::get_actual_path() + "/memfile-persist-test.adiar";
+        {
+          const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(1));
+          AssertThat(f->is_in_memory(), Is().True());
+
+          node_ifstream<> ns(f);
+          AssertThat(ns.pull(),
+                     Is().EqualTo(node(0,
+                                       node::max_id,
+                                       node::pointer_type(false),
+                                       node::pointer_type(1, node::max_id))));
+
+          shared_levelized_file<node> nf = f.file_ptr();
+          nf->make_persistent(path);
+          AssertThat(f->is_in_memory(), Is().False());
+
+          AssertThat(ns.can_pull(), Is().True());
+          AssertThat(ns.pull(),
+                     Is().EqualTo(
+                       node(1, node::max_id, node::pointer_type(false), node::pointer_type(true))));
+          AssertThat(ns.can_pull(), Is().False());
+
+          AssertThat(bdd_satcount(f, 2), Is().EqualTo(1u));
+          AssertThat(bdd_equal(f, bdd_and(bdd_ithvar(1), bdd_ithvar(0))), Is().True());
+        }
+        for (const std::string suffix : { ".file_0", ".levels" }) {
+          std::filesystem::remove(path + suffix);
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("keeps a reader of a BDD valid while operations on it spill", []() {
+        adiar_memfile_init(64 * 1024, 64 * sizeof(node));
+        {
+          bdd f = bdd_ithvar(0);
+          for (bdd::label_type x = 1u; x < 8u; ++x) { f = bdd_xor(f, bdd_ithvar(x)); }
+          AssertThat(f->is_in_memory(), Is().True());
+
+          node_ifstream<> ns(f);
+          AssertThat(ns.pull().label(), Is().EqualTo(0u));
+
+          // The parity of 32 more variables outgrows the per-file limit.
+          bdd g = f;
+          for (bdd::label_type x = 8u; x < 40u; ++x) { g = bdd_xor(g, bdd_ithvar(x)); }
+          AssertThat(g->is_in_memory(), Is().False());
+          AssertThat(bdd_nodecount(g), Is().EqualTo(79u));
+
+          size_t pulled = 1u;
+          while (ns.can_pull()) {
+            ns.pull();
+            ++pulled;
+          }
+          AssertThat(pulled, Is().EqualTo(bdd_nodecount(f)));
+        }
+        AssertThat(global_memory_file_pool.used(), Is().EqualTo(0u));
+        adiar_memfile_deinit();
+      });
+
+      it("supports a BDD operation end-to-end", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(1));
+          AssertThat(f->is_in_memory(), Is().True());
+          AssertThat(bdd_satcount(f, 2), Is().EqualTo(1u));
+        }
+        adiar_memfile_deinit();
+      });
+    });
+
+    describe("file() [compressed]", []() {
+      it("is uncompressed by default", []() {
+        file<node> f;
+        AssertThat(f.is_compressed(), Is().False());
+      });
+
+      it("encodes nodes of the same level in fewer bytes", []() {
+        const node n1(3, 41, ptr_uint64(4, 12), ptr_uint64(5, 7));
+        const node n2(3, 42, ptr_uint64(4, 13), ptr_uint64(5, 8));
+
+        uint8_t out[file_codec<node>::max_bytes];
+        AssertThat(file_codec<node>::encode(n1, n2, out), Is().LessThan(sizeof(node) / 2u));
+
+        node res;
+        file_codec<node>::decode(n1, out, res);
+        AssertThat(res, Is().EqualTo(n2));
+      });
+
+      it("does not exist before being written to", []() {
+        adiar_compression_init();
+        {
+          file<node> f;
+          AssertThat(f.is_compressed(), Is().True());
+          AssertThat(f.exists(), Is().False());
+          AssertThat(f.size(), Is().EqualTo(0u));
+        }
+        adiar_compression_deinit();
+      });
+
+      it("can be written to and read from across several blocks", []() {
+        adiar_compression_init();
+        {
+          file<node> f;
+          {
+            ofstream<node> fw(f);
+            for (node::id_type i = 0; i < 10000; ++i) {
+              fw << node(2, i, ptr_uint64(false), ptr_uint64(i % 2 == 0));
+            }
+            AssertThat(fw.size(), Is().EqualTo(10000u));
+          }
+          AssertThat(f.is_compressed(), Is().True());
+          AssertThat(f.exists(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(10000u));
+
+          ifstream<node> fs(f);
+          for (node::id_type i = 0; i < 10000; ++i) {
+            AssertThat(fs.pull(),
+                       Is().EqualTo(node(2, i, ptr_uint64(false), ptr_uint64(i % 2 == 0))));
+          }
+          AssertThat(fs.can_pull(), Is().False());
+
+          ifstream<node, true> fs_r(f);
+          for (node::id_type i = 10000; 0 < i; --i) {
+            AssertThat(fs_r.pull(),
+                       Is().EqualTo(node(2, i - 1, ptr_uint64(false), ptr_uint64(i % 2 == 1))));
+          }
+          AssertThat(fs_r.can_pull(), Is().False());
+        }
+        adiar_compression_deinit();
+      });
+
+      it("can be appended to", []() {
+        adiar_compression_init();
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 1 << -2;
+          }
+          {
+            ofstream<int> fw(f);
+            fw << 3;
+            AssertThat(fw.size(), Is().EqualTo(3u));
+          }
+
+          ifstream<int> fs(f);
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.pull(), Is().EqualTo(-2));
+          AssertThat(fs.pull(), Is().EqualTo(3));
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_compression_deinit();
+      });
+
+      it("stays compressed when sorted", []() {
+        adiar_compression_init();
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 3 << 1 << 2;
+          }
+          f.sort();
+          AssertThat(f.is_compressed(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(3u));
+
+          ifstream<int> fs(f);
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.pull(), Is().EqualTo(2));
+          AssertThat(fs.pull(), Is().EqualTo(3));
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_compression_deinit();
+      });
+
+      it("can be sorted across several blocks", []() {
+        adiar_compression_init();
+        {
+          file<node> f;
+          {
+            ofstream<node> fw(f);
+            for (node::id_type i = 10000; 0 < i; --i) {
+              fw << node(2, i - 1, ptr_uint64(false), ptr_uint64(true));
+            }
+          }
+          f.sort();
+          AssertThat(f.is_compressed(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(10000u));
+
+          ifstream<node> fs(f);
+          for (node::id_type i = 0; i < 10000; ++i) {
+            AssertThat(fs.pull(), Is().EqualTo(node(2, i, ptr_uint64(false), ptr_uint64(true))));
+          }
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_compression_deinit();
+      });
+
+      it("can be sorted while being written to", []() {
+        adiar_compression_init();
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 3 << 1;
+            fw.sort();
+            fw << 2;
+          }
+          AssertThat(f.is_compressed(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(3u));
+
+          ifstream<int> fs(f);
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.pull(), Is().EqualTo(3));
+          AssertThat(fs.pull(), Is().EqualTo(2));
+        }
+        adiar_compression_deinit();
+      });
+
+      it("can be copied", []() {
+        adiar_compression_init();
+        {
+          file<int> f1;
+          {
+            ofstream<int> fw(f1);
+            fw << 1 << 2;
+          }
+          file<int> f2 = file<int>::copy(f1);
+          AssertThat(f2.is_compressed(), Is().True());
+          AssertThat(f2.size(), Is().EqualTo(2u));
+
+          ifstream<int> fs(f2);
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.pull(), Is().EqualTo(2));
+        }
+        adiar_compression_deinit();
+      });
+
+      it("is uncompressed when made persistent", []() {
+        adiar_compression_init();
+        std::string path;
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 1 << 2;
+          }
+          f.make_persistent();
+          AssertThat(f.is_compressed(), Is().False());
+          AssertThat(std::filesystem::file_size(f.path()),
+                     Is().GreaterThanOrEqualTo(2u * sizeof(int)));
+          AssertThat(f.size(), Is().EqualTo(2u));
+          path = f.path();
+        }
+        AssertThat(std::filesystem::exists(path), Is().True());
+        std::filesystem::remove(path);
+        adiar_compression_deinit();
+      });
+
+      it("is compressed when spilled from internal memory", []() {
+        adiar_memfile_init(1024 * 1024, 64 * sizeof(int));
+        adiar_compression_init();
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            for (int i = 0; i < 1000; ++i) { fw << i; }
+          }
+          AssertThat(f.is_in_memory(), Is().False());
+          AssertThat(f.is_compressed(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(1000u));
+
+          ifstream<int, true> fs(f);
+          for (int i = 1000; 0 < i; --i) { AssertThat(fs.pull(), Is().EqualTo(i - 1)); }
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_compression_deinit();
+        adiar_memfile_deinit();
+      });
+
+      it("supports a BDD operation end-to-end", []() {
+        adiar_compression_init();
+        {
+          const bdd f = bdd_and(bdd_ithvar(0), bdd_ithvar(1));
+          AssertThat(f->is_compressed(), Is().True());
+          AssertThat(bdd_satcount(f, 2), Is().EqualTo(1u));
+          AssertThat(bdd_nodecount(f), Is().EqualTo(2u));
+        }
+        adiar_compression_deinit();
+      });
+
+      // Parity of x0, x2, ..., x18 in conjunction with 'x1 | x3 | ... | x19', i.e. a BDD with
+      // several nodes on each level.
+      const auto bdd_example = []() {
+        bdd parity = bdd_false();
+        bdd some   = bdd_false();
+        for (int x = 0; x < 20; x += 2) {
+          parity = bdd_xor(parity, bdd_ithvar(x));
+          some   = bdd_or(some, bdd_ithvar(x + 1));
+        }
+        return bdd_and(parity, some);
+      };
+
+      it("computes the same BDDs as without compression", [&bdd_example]() {
+        const auto pred = [](bdd::label_type x) { return x % 4 == 0; };
+
+        const bdd expected   = bdd_example();
+        const bdd expected_e = bdd_exists(expected, pred);
+        const bdd expected_r = bdd_restrict(expected, 3, true);
+
+        adiar_compression_init();
+        const bdd f   = bdd_example();
+        const bdd f_e = bdd_exists(f, pred);
+        const bdd f_r = bdd_restrict(f, 3, true);
+        adiar_compression_deinit();
+
+        AssertThat(f->is_compressed(), Is().True());
+        AssertThat(f_e->is_compressed(), Is().True());
+        AssertThat(f_r->is_compressed(), Is().True());
+
+        AssertThat(bdd_nodecount(f), Is().EqualTo(bdd_nodecount(expected)));
+        AssertThat(bdd_satcount(f, 20), Is().EqualTo(bdd_satcount(expected, 20)));
+        AssertThat(bdd_equal(f, expected), Is().True());
+        AssertThat(bdd_equal(f_e, expected_e), Is().True());
+        AssertThat(bdd_equal(f_r, expected_r), Is().True());
+      });
+
+      it("keeps the arcs of a BDD operation compressed", [&bdd_example]() {
+        adiar_compression_init();
+        {
+          const bdd f = bdd_example();
+          __bdd a     = bdd_and(f, bdd_nithvar(7));
+          AssertThat(a.has<__bdd::shared_arc_file_type>(), Is().True());
+          AssertThat(a.get<__bdd::shared_arc_file_type>()->is_compressed(), Is().True());
+
+          const bdd res = std::move(a);
+          AssertThat(res->is_compressed(), Is().True());
+          AssertThat(bdd_equal(res, bdd_and(f, bdd_nithvar(7))), Is().True());
+        }
+        adiar_compression_deinit();
+      });
+
+      // Whether the number of variables set to true among x0, x1, ..., x(vars-1) is divisible by
+      // k, i.e. a BDD with enough nodes to span many blocks.
+      const auto bdd_counter = [](const int vars, const int k) {
+        bdd_builder b;
+
+        std::vector<bdd_ptr> below(k, b.add_node(false));
+        below[0] = b.add_node(true);
+
+        for (int x = vars - 1; 0 <= x; --x) {
+          std::vector<bdd_ptr> level(k, b.add_node(false));
+          for (int r = 0; r < std::min(x + 1, k); ++r) {
+            // Skip residues that cannot be reached or cannot reach 0 with the remaining variables.
+            if (r != 0 && vars - x < k - r) { continue; }
+            level[r] = b.add_node(x, below[r], below[(r + 1) % k]);
+          }
+          below = std::move(level);
+        }
+        return b.build();
+      };
+
+      it("stores the nodes of a BDD in less than half the space", [&bdd_counter]() {
+        const bdd expected = bdd_counter(100, 32);
+
+        adiar_compression_init();
+        const bdd f = bdd_counter(100, 32);
+        adiar_compression_deinit();
+
+        AssertThat(f->is_compressed(), Is().True());
+        AssertThat(expected->is_compressed(), Is().False());
+        AssertThat(2u * f->disk_size(), Is().LessThan(expected->disk_size()));
+      });
+
+      it("stores the arcs of a BDD operation in less than half the space", [&bdd_counter]() {
+        const bdd f = bdd_counter(100, 32);
+        const __bdd expected = bdd_and(f, bdd_nithvar(7));
+
+        adiar_compression_init();
+        const __bdd a = bdd_and(f, bdd_nithvar(7));
+        adiar_compression_deinit();
+
+        const __bdd::shared_arc_file_type& af = a.get<__bdd::shared_arc_file_type>();
+        const __bdd::shared_arc_file_type& ef = expected.get<__bdd::shared_arc_file_type>();
+
+        AssertThat(af->size(), Is().EqualTo(ef->size()));
+        AssertThat(2u * af->disk_size(), Is().LessThan(ef->disk_size()));
+      });
+    });
+
+    describe("file() [narrow]", [&tmp_path]() {
+      // Nodes of a single level with ids counted down from the maximal id, i.e. as they are
+      // created by Reduce.
+      const auto node_at = [](size_t i) -> node {
+        return node(2, node::max_id - i, ptr_uint64(false), ptr_uint64(3, node::max_id - i / 2u));
+      };
+
+      const size_t nodes = 10000u;
+
+      it("is narrow by default for nodes", []() {
+        file<node> f;
+        AssertThat(f.is_narrow(), Is().True());
+      });
+
+      it("is not narrow for other elements", []() {
+        file<int> f;
+        AssertThat(f.is_narrow(), Is().False());
+      });
+
+      it("is not narrow when compressed", []() {
+        adiar_compression_init();
+        {
+          file<node> f;
+          AssertThat(f.is_narrow(), Is().False());
+          AssertThat(f.is_compressed(), Is().True());
+        }
+        adiar_compression_deinit();
+      });
+
+      it("does not exist before being written to", []() {
+        file<node> f;
+        AssertThat(f.exists(), Is().False());
+        AssertThat(f.size(), Is().EqualTo(0u));
+        AssertThat(f.disk_size(), Is().EqualTo(0u));
+
+        f.touch();
+        AssertThat(f.exists(), Is().True());
+        AssertThat(f.size(), Is().EqualTo(0u));
+      });
+
+      it("can be written to and read from in (almost) half the space", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          for (size_t i = 0; i < nodes; ++i) { fw << node_at(i); }
+          AssertThat(fw.size(), Is().EqualTo(nodes));
+        }
+        AssertThat(f.is_narrow(), Is().True());
+        AssertThat(f.size(), Is().EqualTo(nodes));
+        AssertThat(f.disk_size(), Is().LessThan(3u * nodes * sizeof(node) / 4u));
+
+        ifstream<node> fs(f);
+        for (size_t i = 0; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+        AssertThat(fs.can_pull(), Is().False());
+
+        ifstream<node, true> fs_r(f);
+        for (size_t i = nodes; 0 < i; --i) {
+          AssertThat(fs_r.pull(), Is().EqualTo(node_at(i - 1)));
+        }
+        AssertThat(fs_r.can_pull(), Is().False());
+      });
+
+      it("can be read ahead", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          for (size_t i = 0; i < nodes; ++i) { fw << node_at(i); }
+        }
+
+        ifstream<node, true> fs(f);
+        fs.read_ahead(2u);
+        for (size_t i = nodes; 0 < i; --i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i - 1))); }
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("is wide after writing a node that does not fit", [&]() {
+        const node n = node(2, 0, ptr_uint64(false), ptr_uint64(true));
+
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          fw << node_at(0) << node_at(1);
+          AssertThat(f.is_narrow(), Is().True());
+
+          fw << n << node_at(2);
+          AssertThat(f.is_narrow(), Is().False());
+          AssertThat(fw.size(), Is().EqualTo(4u));
+        }
+        AssertThat(f.is_narrow(), Is().False());
+        AssertThat(f.size(), Is().EqualTo(4u));
+
+        ifstream<node> fs(f);
+        AssertThat(fs.pull(), Is().EqualTo(node_at(0)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(1)));
+        AssertThat(fs.pull(), Is().EqualTo(n));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(2)));
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("is wide after writing a node that does not fit behind", [&]() {
+        const node n = node(2, 0, ptr_uint64(false), ptr_uint64(true));
+
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          fw.write_behind(1u);
+          for (size_t i = 0; i < nodes; ++i) { fw << node_at(i); }
+          fw << n;
+          AssertThat(fw.size(), Is().EqualTo(nodes + 1u));
+        }
+        AssertThat(f.is_narrow(), Is().False());
+
+        ifstream<node> fs(f);
+        for (size_t i = 0; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+        AssertThat(fs.pull(), Is().EqualTo(n));
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("can be appended to", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          fw << node_at(0) << node_at(1);
+        }
+        {
+          ofstream<node> fw(f);
+          fw << node_at(2);
+          AssertThat(fw.size(), Is().EqualTo(3u));
+        }
+        AssertThat(f.is_narrow(), Is().True());
+
+        ifstream<node> fs(f);
+        AssertThat(fs.pull(), Is().EqualTo(node_at(0)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(1)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(2)));
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("stays narrow when sorted", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          for (size_t i = 0; i < nodes; ++i) { fw << node_at(i); }
+        }
+        f.sort();
+        AssertThat(f.is_narrow(), Is().True());
+        AssertThat(f.size(), Is().EqualTo(nodes));
+
+        ifstream<node> fs(f);
+        for (size_t i = nodes; 0 < i; --i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i - 1))); }
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("can be sorted while being written to", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          fw << node_at(0) << node_at(2);
+          fw.sort();
+          fw << node_at(1);
+        }
+        AssertThat(f.is_narrow(), Is().True());
+
+        ifstream<node> fs(f);
+        AssertThat(fs.pull(), Is().EqualTo(node_at(2)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(0)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(1)));
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("can be copied", [&]() {
+        file<node> f1;
+        {
+          ofstream<node> fw(f1);
+          fw << node_at(0) << node_at(1);
+        }
+        file<node> f2 = file<node>::copy(f1);
+        AssertThat(f2.is_narrow(), Is().True());
+        AssertThat(f2.size(), Is().EqualTo(2u));
+
+        ifstream<node> fs(f2);
+        AssertThat(fs.pull(), Is().EqualTo(node_at(0)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(1)));
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("is wide when made persistent", [&]() {
+        std::string path;
+        {
+          file<node> f;
+          {
+            ofstream<node> fw(f);
+            fw << node_at(0) << node_at(1);
+          }
+          f.make_persistent();
+          AssertThat(f.is_narrow(), Is().False());
+          AssertThat(std::filesystem::file_size(f.path()),
+                     Is().GreaterThanOrEqualTo(2u * sizeof(node)));
+          AssertThat(f.size(), Is().EqualTo(2u));
+          path = f.path();
+        }
+        AssertThat(std::filesystem::exists(path), Is().True());
+        std::filesystem::remove(path);
+      });
+
+      it("is wide when moved", [&]() {
+        const std::string new_path = tmp_path + "narrow-move-path.adiar";
+        if (std::filesystem::exists(new_path)) {
+          // Clean up after prior test run
+          std::filesystem::remove(new_path);
+        }
+        {
+          file<node> f;
+          {
+            ofstream<node> fw(f);
+            fw << node_at(0) << node_at(1);
+          }
+          f.move(new_path);
+          AssertThat(f.is_narrow(), Is().False());
+          AssertThat(std::filesystem::file_size(f.path()),
+                     Is().GreaterThanOrEqualTo(2u * sizeof(node)));
+
+          ifstream<node> fs(f);
+          AssertThat(fs.pull(), Is().EqualTo(node_at(0)));
+          AssertThat(fs.pull(), Is().EqualTo(node_at(1)));
+          AssertThat(fs.can_pull(), Is().False());
+        }
+      });
+
+      it("is narrow when spilled from internal memory", [&]() {
+        adiar_memfile_init(1024 * 1024, 64 * sizeof(node));
+        {
+          file<node> f;
+          AssertThat(f.is_in_memory(), Is().True());
+          {
+            ofstream<node> fw(f);
+            for (size_t i = 0; i < nodes; ++i) { fw << node_at(i); }
+          }
+          AssertThat(f.is_in_memory(), Is().False());
+          AssertThat(f.is_narrow(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(nodes));
+
+          ifstream<node, true> fs(f);
+          for (size_t i = nodes; 0 < i; --i) {
+            AssertThat(fs.pull(), Is().EqualTo(node_at(i - 1)));
+          }
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("is wide when spilled from internal memory with a node that does not fit", [&]() {
+        const node n = node(2, 0, ptr_uint64(false), ptr_uint64(true));
+
+        adiar_memfile_init(1024 * 1024, 64 * sizeof(node));
+        {
+          file<node> f;
+          {
+            ofstream<node> fw(f);
+            fw << n;
+            for (size_t i = 0; i < nodes; ++i) { fw << node_at(i); }
+          }
+          AssertThat(f.is_in_memory(), Is().False());
+          AssertThat(f.is_narrow(), Is().False());
+          AssertThat(f.size(), Is().EqualTo(nodes + 1u));
+
+          ifstream<node> fs(f);
+          AssertThat(fs.pull(), Is().EqualTo(n));
+          for (size_t i = 0; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("stores the nodes of BDD operations", []() {
+        bdd parity = bdd_false();
+        bdd some   = bdd_false();
+        for (int x = 0; x < 20; x += 2) {
+          parity = bdd_xor(parity, bdd_ithvar(x));
+          some   = bdd_or(some, bdd_ithvar(x + 1));
+        }
+        const bdd f = bdd_and(parity, some);
+        AssertThat(f->is_narrow(), Is().True());
+
+        const bdd f_e = bdd_exists(f, [](bdd::label_type x) { return x % 4 == 0; });
+        AssertThat(f_e->is_narrow(), Is().True());
+
+        AssertThat(bdd_satcount(f, 20), Is().EqualTo(523776u));
+      });
+    });
+
+    describe("file() + ifstream [read-ahead]", []() {
+      // Enough nodes to span several blocks
+      const size_t nodes = 3u * prefetcher<node>::block_elements() + 42u;
+
+      const auto node_at = [](size_t i) -> node {
+        return node(i % 64u, i / 64u, ptr_uint64(false), ptr_uint64(i % 2u == 0u));
+      };
+
+      it("reads nothing ahead with a single thread", []() {
+        const exec_policy ep = exec_policy::threads(1);
+        AssertThat(read_ahead_blocks(ep, 1024u * 1024u * 1024u), Is().EqualTo(0u));
+      });
+
+      it("reads ahead a bounded number of blocks with more threads", []() {
+        const exec_policy ep = exec_policy::threads(2);
+        AssertThat(read_ahead_blocks(ep, 1024u * 1024u * 1024u),
+                   Is().EqualTo(max_read_ahead_blocks));
+        AssertThat(read_ahead_blocks(ep, 3u * get_block_size()), Is().EqualTo(2u));
+        AssertThat(read_ahead_blocks(ep, 3u * get_block_size(), 2u), Is().EqualTo(0u));
+      });
+
+      it("charges the blocks in flight to the memory usage", []() {
+        AssertThat(ifstream<node>::memory_usage(0u), Is().EqualTo(ifstream<node>::memory_usage()));
+        const size_t block_bytes = prefetcher<node>::block_elements() * sizeof(node);
+        AssertThat(ifstream<node>::memory_usage(2u),
+                   Is().GreaterThanOrEqualTo(ifstream<node>::memory_usage() + 2u * block_bytes));
+      });
+
+      it("reads an empty file", []() {
+        file<node> f;
+        ifstream<node> fs(f);
+        fs.read_ahead(2u);
+        AssertThat(fs.is_reading_ahead(), Is().True());
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("reads a file across several blocks", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          for (size_t i = 0u; i < nodes; ++i) { fw << node_at(i); }
+        }
+
+        ifstream<node> fs(f);
+        fs.read_ahead(2u);
+        AssertThat(fs.is_reading_ahead(), Is().True());
+
+        for (size_t i = 0u; i < nodes; ++i) {
+          AssertThat(fs.can_pull(), Is().True());
+          if (i % 1000u == 0u) { AssertThat(fs.peek(), Is().EqualTo(node_at(i))); }
+          AssertThat(fs.pull(), Is().EqualTo(node_at(i)));
+        }
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("reads a file in reverse across several blocks", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          for (size_t i = 0u; i < nodes; ++i) { fw << node_at(i); }
+        }
+
+        ifstream<node, true> fs(f);
+        fs.read_ahead(1u);
+
+        for (size_t i = nodes; 0u < i; --i) {
+          AssertThat(fs.pull(), Is().EqualTo(node_at(i - 1u)));
+        }
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("continues from the read head and restarts on reset", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          for (size_t i = 0u; i < nodes; ++i) { fw << node_at(i); }
+        }
+
+        ifstream<node> fs(f);
+        AssertThat(fs.pull(), Is().EqualTo(node_at(0u)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(1u)));
+
+        fs.read_ahead(2u);
+        AssertThat(fs.pull(), Is().EqualTo(node_at(2u)));
+        AssertThat(fs.pull(), Is().EqualTo(node_at(3u)));
+
+        fs.reset();
+        AssertThat(fs.is_reading_ahead(), Is().True());
+        for (size_t i = 0u; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("stops reading ahead when closed early", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          for (size_t i = 0u; i < nodes; ++i) { fw << node_at(i); }
+        }
+
+        ifstream<node> fs(f);
+        fs.read_ahead(max_read_ahead_blocks);
+        AssertThat(fs.pull(), Is().EqualTo(node_at(0u)));
+
+        fs.close();
+        AssertThat(fs.is_reading_ahead(), Is().False());
+        AssertThat(fs.is_open(), Is().False());
+      });
+
+      it("reads a compressed file", [&]() {
+        adiar_compression_init();
+        {
+          file<node> f;
+          {
+            ofstream<node> fw(f);
+            for (size_t i = 0u; i < nodes; ++i) { fw << node_at(i); }
+          }
+          AssertThat(f.is_compressed(), Is().True());
+
+          ifstream<node> fs(f);
+          fs.read_ahead(2u);
+          for (size_t i = 0u; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_compression_deinit();
+      });
+
+      it("does not read ahead a file in internal memory", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f;
+          {
+            ofstream<int> fw(f);
+            fw << 1 << 2;
+          }
+
+          ifstream<int> fs(f);
+          fs.read_ahead(2u);
+          AssertThat(fs.is_reading_ahead(), Is().False());
+          AssertThat(fs.pull(), Is().EqualTo(1));
+          AssertThat(fs.pull(), Is().EqualTo(2));
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("supports BDD operations with multiple threads end-to-end", []() {
+        const exec_policy ep = exec_policy::threads(2);
+
+        bdd f = bdd_true();
+        for (int x = 15; 0 <= x; --x) { f = bdd_xor(ep, f, bdd_ithvar(x)); }
+
+        AssertThat(bdd_nodecount(f), Is().EqualTo(31u));
+        AssertThat(bdd_satcount(ep, f, 16), Is().EqualTo(32768u));
+      });
+    });
+
+    describe("file() + ofstream [write-behind]", []() {
+      // Enough nodes to span several blocks
+      const size_t nodes = 3u * write_behind<node>::block_elements() + 42u;
+
+      const auto node_at = [](size_t i) -> node {
+        return node(i % 64u, i / 64u, ptr_uint64(false), ptr_uint64(i % 2u == 0u));
+      };
+
+      it("writes nothing behind with a single thread", []() {
+        const exec_policy ep = exec_policy::threads(1);
+        AssertThat(write_behind_blocks(ep, 1024u * 1024u * 1024u), Is().EqualTo(0u));
+      });
+
+      it("charges the queued up blocks to the memory usage", []() {
+        AssertThat(ofstream<node>::memory_usage(0u), Is().EqualTo(ofstream<node>::memory_usage()));
+        const size_t block_bytes = write_behind<node>::block_elements() * sizeof(node);
+        AssertThat(ofstream<node>::memory_usage(2u),
+                   Is().GreaterThanOrEqualTo(ofstream<node>::memory_usage() + 2u * block_bytes));
+      });
+
+      it("writes a file across several blocks", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          fw.write_behind(2u);
+          AssertThat(fw.is_writing_behind(), Is().True());
+
+          for (size_t i = 0u; i < nodes; ++i) { fw << node_at(i); }
+          AssertThat(fw.size(), Is().EqualTo(nodes));
+        }
+        AssertThat(f.size(), Is().EqualTo(nodes));
+
+        ifstream<node> fs(f);
+        for (size_t i = 0u; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("appends to what was written before", [&]() {
+        file<node> f;
+        {
+          ofstream<node> fw(f);
+          fw << node_at(0u) << node_at(1u);
+
+          fw.write_behind(1u);
+          for (size_t i = 2u; i < nodes; ++i) { fw << node_at(i); }
+          AssertThat(fw.size(), Is().EqualTo(nodes));
+
+          fw.flush();
+          AssertThat(fw.is_writing_behind(), Is().False());
+          AssertThat(fw.size(), Is().EqualTo(nodes));
+        }
+
+        ifstream<node> fs(f);
+        for (size_t i = 0u; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("can be sorted while writing behind", []() {
+        file<int> f;
+        {
+          ofstream<int> fw(f);
+          fw.write_behind(1u);
+          fw << 3 << 1 << 2;
+          fw.sort();
+        }
+
+        ifstream<int> fs(f);
+        AssertThat(fs.pull(), Is().EqualTo(1));
+        AssertThat(fs.pull(), Is().EqualTo(2));
+        AssertThat(fs.pull(), Is().EqualTo(3));
+        AssertThat(fs.can_pull(), Is().False());
+      });
+
+      it("writes a compressed file", [&]() {
+        adiar_compression_init();
+        {
+          file<node> f;
+          {
+            ofstream<node> fw(f);
+            fw.write_behind(2u);
+            for (size_t i = 0u; i < nodes; ++i) { fw << node_at(i); }
+          }
+          AssertThat(f.is_compressed(), Is().True());
+          AssertThat(f.size(), Is().EqualTo(nodes));
+
+          ifstream<node> fs(f);
+          for (size_t i = 0u; i < nodes; ++i) { AssertThat(fs.pull(), Is().EqualTo(node_at(i))); }
+          AssertThat(fs.can_pull(), Is().False());
+        }
+        adiar_compression_deinit();
+      });
+
+      it("does not write behind a file in internal memory", []() {
+        adiar_memfile_init(1024 * 1024);
+        {
+          file<int> f;
+          ofstream<int> fw(f);
+          fw.write_behind(2u);
+          AssertThat(fw.is_writing_behind(), Is().False());
+        }
+        adiar_memfile_deinit();
+      });
+
+      it("writes nodes of a levelized file behind", []() {
+        levelized_file<node> nf;
+        {
+          node_ofstream nw(nf);
+          nw.write_behind(1u);
+          nw << node(1, node::max_id, ptr_uint64(false), ptr_uint64(true))
+             << node(0, node::max_id, ptr_uint64(false), ptr_uint64(1, node::max_id));
+        }
+
+        AssertThat(nf.size(), Is().EqualTo(2u));
+        AssertThat(nf.levels(), Is().EqualTo(2u));
+        AssertThat(nf.width, Is().EqualTo(1u));
+      });
+    });
   });
 });
@@ -1,5 +1,6 @@
 #include "../../../test.h"
 #include <filesystem>
+#include <vector>
 
 #include <adiar/internal/io/node_raccess.h>
 
@@ -621,6 +622,79 @@ go_bandit([]() {
         });
       });
 
+      describe("fingerprint", [&]() {
+        it("differs for the False and the True terminal", [&]() {
+          AssertThat(nf_F.fingerprint[false], Is().Not().EqualTo(nf_T.fingerprint[false]));
+        });
+
+        it("matches for the negated False terminal and the True terminal", [&]() {
+          AssertThat(nf_F.fingerprint[true], Is().EqualTo(nf_T.fingerprint[false]));
+          AssertThat(nf_F.fingerprint[false], Is().EqualTo(nf_T.fingerprint[true]));
+        });
+
+        it("matches for files with the same content", [&]() {
+          AssertThat(nf_42.fingerprint[false], Is().EqualTo(nf_not42.fingerprint[false]));
+          AssertThat(nf_42.fingerprint[true], Is().EqualTo(nf_not42.fingerprint[true]));
+        });
+
+        it("differs for single node [1] and single node [2]", [&]() {
+          AssertThat(nf_42.fingerprint[false],
+                     Is().Not().EqualTo(nf_42andnot42.fingerprint[false]));
+        });
+
+        it("differs with and without negated terminals for single node [1]", [&]() {
+          AssertThat(nf_42.fingerprint[false], Is().Not().EqualTo(nf_42.fingerprint[true]));
+        });
+
+        it("differs for x0 & x1 and x0 & x1 & x2", [&]() {
+          AssertThat(nf_0and1.fingerprint[false],
+                     Is().Not().EqualTo(nf_0and1and2.fingerprint[false]));
+        });
+
+        it("is independent of the levels of the diagram", [&]() {
+          /*
+                        1            ---- x1
+                       / \
+                       F 2           ---- x2
+                        / \
+                        F T
+          */
+          levelized_file<node> nf_1and2;
+          {
+            node_ofstream nw(nf_1and2);
+            nw << node(2, node::max_id, node::pointer_type(false), node::pointer_type(true))
+               << node(1,
+                       node::max_id,
+                       node::pointer_type(false),
+                       node::pointer_type(2, node::pointer_type::max_id));
+          }
+
+          AssertThat(nf_1and2.fingerprint[false], Is().EqualTo(nf_0and1.fingerprint[false]));
+          AssertThat(nf_1and2.fingerprint[true], Is().EqualTo(nf_0and1.fingerprint[true]));
+        });
+
+        it("depends on the distance between levels", [&]() {
+          /*
+                        1            ---- x0
+                       / \
+                       F 2           ---- x2
+                        / \
+                        F T
+          */
+          levelized_file<node> nf_0and2;
+          {
+            node_ofstream nw(nf_0and2);
+            nw << node(2, node::max_id, node::pointer_type(false), node::pointer_type(true))
+               << node(0,
+                       node::max_id,
+                       node::pointer_type(false),
+                       node::pointer_type(2, node::pointer_type::max_id));
+          }
+
+          AssertThat(nf_0and2.fingerprint[false], Is().Not().EqualTo(nf_0and1.fingerprint[false]));
+        });
+      });
+
       describe("max 1-level cut", [&]() {
         it("is exact for F", [&]() {
           AssertThat(nf_F.max_1level_cut[cut::Internal], Is().EqualTo(0u));
@@ -813,6 +887,40 @@ go_bandit([]() {
       });
     });
 
+    describe("node_ofstream [ .push_level(...) ]", []() {
+      it("writes a level in canonical order", [&]() {
+        using children_t = node::children_type;
+
+        const std::vector<children_t> children = {
+          children_t(node::pointer_type(false), node::pointer_type(true)),
+          children_t(node::pointer_type(true), node::pointer_type(true)),
+          children_t(node::pointer_type(true), node::pointer_type(false)),
+        };
+        std::vector<size_t> refs                 = { 0u, 1u, 2u };
+        std::vector<node::pointer_type> pointers = { node::pointer_type::nil(),
+                                                     node::pointer_type::nil(),
+                                                     node::pointer_type::nil() };
+
+        levelized_file<node> nf;
+        {
+          node_ofstream nw(nf);
+          nw.push_level(
+            4u,
+            refs.begin(),
+            refs.end(),
+            [&children](const size_t i) { return children[i]; },
+            [&pointers](const size_t i, const node::uid_type& u) { pointers[i] = u; });
+        }
+
+        AssertThat(pointers[1], Is().EqualTo(node::pointer_type(4u, node::max_id)));
+        AssertThat(pointers[0], Is().EqualTo(node::pointer_type(4u, node::max_id - 1)));
+        AssertThat(pointers[2], Is().EqualTo(node::pointer_type(4u, node::max_id - 2)));
+
+        AssertThat(nf.is_canonical(), Is().True());
+        AssertThat(nf.size(), Is().EqualTo(3u));
+      });
+    });
+
     describe("node_file::stats", []() {
       it("Is no terminal when empty", [&]() {
         levelized_file<node> nf;
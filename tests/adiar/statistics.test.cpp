@@ -0,0 +1,88 @@
+#include "../test.h"
+
+#include <thread>
+#include <vector>
+
+go_bandit([]() {
+  describe("adiar/statistics.h", []() {
+    // Parity of the variables i, i+1, ..., i+n
+    const auto parity = [](const int i, const int n) -> bdd {
+      bdd f = bdd_ithvar(i);
+      for (int x = i + 1; x <= i + n; ++x) { f = bdd_xor(f, bdd_ithvar(x)); }
+      return f;
+    };
+
+    // Number of arcs given to Reduce, i.e. the amount of work done by the Apply operations.
+    const auto reduce_arcs = []() -> size_t {
+      const statistics s = statistics_get();
+      return static_cast<size_t>(s.reduce.sum_node_arcs + s.reduce.sum_terminal_arcs);
+    };
+
+    it("keeps the statistics of threads that have exited", [&]() {
+      statistics_reset();
+      AssertThat(bdd_nodecount(parity(0, 8)), Is().EqualTo(17u));
+      const size_t expected = reduce_arcs();
+
+      statistics_reset();
+      AssertThat(reduce_arcs(), Is().EqualTo(0u));
+
+      size_t nodecount = 0u;
+      std::thread t([&]() { nodecount = bdd_nodecount(parity(0, 8)); });
+      t.join();
+
+      AssertThat(nodecount, Is().EqualTo(17u));
+      AssertThat(reduce_arcs(), Is().EqualTo(expected));
+#ifdef ADIAR_STATS
+      AssertThat(expected, Is().GreaterThan(0u));
+#endif
+    });
+
+    it("merges the statistics of many threads running operations at the same time", [&]() {
+      constexpr int threads    = 4;
+      constexpr int iterations = 25;
+
+      // Run all the work on the calling thread to obtain the expected statistics.
+      statistics_reset();
+      for (int i = 0; i < threads; ++i) {
+        for (int j = 0; j < iterations; ++j) { parity(i, j + 1); }
+      }
+      const size_t expected = reduce_arcs();
+#ifdef ADIAR_STATS
+      AssertThat(expected, Is().GreaterThan(0u));
+#endif
+
+      statistics_reset();
+
+      // Run one more operation on the calling thread
+      AssertThat(bdd_nodecount(parity(0, 1)), Is().EqualTo(3u));
+      const size_t expected_caller = reduce_arcs();
+
+      bool results[threads] = { false, false, false, false };
+
+      const auto work = [&results, &parity](const int i) {
+        adiar_thread_init(128 * 1024 * 1024);
+
+        bool result = true;
+        for (int j = 0; j < iterations; ++j) {
+          result &= bdd_nodecount(parity(i, j + 1)) == static_cast<size_t>(2 * (j + 1) + 1);
+        }
+        results[i] = result;
+
+        adiar_thread_deinit();
+      };
+
+      std::vector<std::thread> ts;
+      for (int i = 0; i < threads; ++i) { ts.emplace_back(work, i); }
+      for (std::thread& t : ts) { t.join(); }
+
+      for (int i = 0; i < threads; ++i) { AssertThat(results[i], Is().True()); }
+
+      // Statistics of the calling thread and of all exited threads
+      AssertThat(reduce_arcs(), Is().EqualTo(expected_caller + expected));
+
+      // Reset both the calling thread and the exited threads
+      statistics_reset();
+      AssertThat(reduce_arcs(), Is().EqualTo(0u));
+    });
+  });
+});
@@ -0,0 +1,35 @@
+#include "../../test.h"
+
+go_bandit([]() {
+  describe("adiar/zdd/save.cpp", []() {
+    const std::string path = tpie::tempname::get_actual_path() + "/zdd-save-test.adiar";
+
+    const auto cleanup = [&path]() {
+      if (std::filesystem::exists(path)) { std::filesystem::remove(path); }
+    };
+
+    describe("zdd_save(A, path), zdd_load(path)", [&]() {
+      it("restores the family { {0}, {1} }", [&]() {
+        cleanup();
+        std::vector<zdd::label_type> vars = { 1u, 0u };
+        const zdd A = zdd_vars(vars.begin(), vars.end());
+        const zdd B = zdd_union(zdd_singleton(0u), zdd_singleton(1u));
+        zdd_save(B, path);
+
+        const zdd res = zdd_load(path);
+
+        AssertThat(zdd_equal(res, B), Is().True());
+        AssertThat(zdd_equal(res, A), Is().False());
+        cleanup();
+      });
+
+      it("can save and load the empty family", [&]() {
+        cleanup();
+        zdd_save(zdd_empty(), path);
+
+        AssertThat(zdd_isempty(zdd_load(path)), Is().True());
+        cleanup();
+      });
+    });
+  });
+});
@@ -51,11 +51,15 @@ go_bandit([]() {
 #include "adiar/internal/data_structures/level_merger.test.cpp"
 #include "adiar/internal/data_structures/levelized_priority_queue.test.cpp"
 #include "adiar/internal/data_structures/priority_queue.test.cpp"
+#include "adiar/internal/data_structures/radix_priority_queue.test.cpp"
+#include "adiar/internal/data_structures/result_cache.test.cpp"
 #include "adiar/internal/data_types/arc.test.cpp"
 #include "adiar/internal/data_types/convert.test.cpp"
 #include "adiar/internal/data_types/level_info.test.cpp"
 #include "adiar/internal/data_types/node.test.cpp"
+#include "adiar/internal/data_types/node_uint32.test.cpp"
 #include "adiar/internal/data_types/ptr.test.cpp"
+#include "adiar/internal/data_types/ptr_uint32.test.cpp"
 #include "adiar/internal/data_types/request.test.cpp"
 #include "adiar/internal/data_types/tuple.test.cpp"
 #include "adiar/internal/data_types/uid.test.cpp"
@@ -69,10 +73,19 @@ go_bandit([]() {
 
 ////////////////////////////////////////////////////////////////////////////////
 // Adiar Core unit tests
+#include "adiar/adiar.test.cpp"
 #include "adiar/bool_op.test.cpp"
 #include "adiar/builder.test.cpp"
 #include "adiar/domain.test.cpp"
 #include "adiar/internal/bool_op.test.cpp"
+#include "adiar/statistics.test.cpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// Adiar ADD unit tests
+#include "adiar/add/add.test.cpp"
+#include "adiar/add/apply.test.cpp"
+#include "adiar/add/convert.test.cpp"
+#include "adiar/add/quantify.test.cpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Adiar BDD unit tests
@@ -87,8 +100,10 @@ go_bandit([]() {
 #include "adiar/bdd/pred.test.cpp"
 #include "adiar/bdd/quantify.test.cpp"
 #include "adiar/bdd/relprod.test.cpp"
+#include "adiar/bdd/reorder.test.cpp"
 #include "adiar/bdd/replace.test.cpp"
 #include "adiar/bdd/restrict.test.cpp"
+#include "adiar/bdd/save.test.cpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 // Adiar ZDD unit tests
@@ -102,6 +117,7 @@ go_bandit([]() {
 #include "adiar/zdd/expand.test.cpp"
 #include "adiar/zdd/pred.test.cpp"
 #include "adiar/zdd/project.test.cpp"
+#include "adiar/zdd/save.test.cpp"
 #include "adiar/zdd/subset.test.cpp"
 #include "adiar/zdd/zdd.test.cpp"
 
@@ -47,6 +47,10 @@ public:
   node_test_ifstream(const __zdd& f)
     : node_ifstream<true>(f.get<__zdd::shared_node_file_type>(), f._negate)
   {}
+
+  node_test_ifstream(const add& f)
+    : node_ifstream<true>(f)
+  {}
 };
 
 class arc_test_ifstream : public arc_ifstream<true>